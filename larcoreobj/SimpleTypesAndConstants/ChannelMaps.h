@@ -0,0 +1,696 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/ChannelMaps.h
+ * @brief  Containers with data per readout channel, keyed by channel ID.
+ * @date   October 18, 2026
+ * @see    larcoreobj/SimpleTypesAndConstants/RawTypes.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_CHANNELMAPS_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_CHANNELMAPS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <algorithm> // std::stable_sort(), std::min(), std::max()
+#include <iterator> // std::input_iterator_tag
+#include <utility> // std::pair, std::forward(), std::move()
+#include <type_traits> // std::is_same_v, std::enable_if_t
+#include <stdexcept> // std::out_of_range
+#include <cstdint> // std::uint64_t
+#include <cstddef> // std::size_t, std::ptrdiff_t
+
+
+namespace raw {
+
+  namespace details {
+
+    /// Returns the number of trailing zero bits of `bits` (not `0`).
+    inline unsigned int countTrailingZeros(std::uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+      return static_cast<unsigned int>(__builtin_ctzll(bits));
+#else
+      unsigned int n = 0U;
+      while ((bits & 1U) == 0U) { bits >>= 1U; ++n; }
+      return n;
+#endif
+    }
+
+    /// Iterator to the channels of the channel maps.
+    template <typename Map, typename Value>
+    class ChannelMapIterator;
+
+  } // namespace details
+
+
+  /**
+   * @brief Map from channel ID to data, with dense storage.
+   * @tparam T type of the data for each channel
+   *
+   * The map stores one element for each channel from `0` up to the highest
+   * channel inserted, plus a bitmap recording which channels are present.
+   * Lookup is a single indexing, and iteration proceeds in channel order,
+   * skipping the missing channels. This is the best choice when most of the
+   * channels in a range starting from `0` have data (pedestals, noise,
+   * channel status...); for few channels scattered across a large range,
+   * `raw::SparseChannelMap` uses less memory.
+   *
+   * `raw::InvalidChannelID` is never present in the map, and inserting it is
+   * an error. `T` must be default-constructible: missing channels hold a
+   * default-constructed value. `T` can't be `bool`, since the data is handed
+   * out by reference and `std::vector<bool>` has no `bool` elements to refer
+   * to: use `raw::ChannelMap<char>` for channel flags.
+   *
+   * Since inserting a channel allocates room for all the channels before it,
+   * a single stray channel ID could allocate gigabytes. Insertion therefore
+   * refuses channels from `maxChannels()` on (by default
+   * `DefaultMaxChannels`, which covers any existing detector); the limit can
+   * be changed with `setMaxChannels()`, and does not apply to `reserve()`.
+   *
+   * Iterators dereference to a pair (by value) of channel ID and reference to
+   * the data, so that structured bindings can be used:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * raw::ChannelMap<float> pedestals;
+   * pedestals[channel] = 412.5f;
+   * for (auto [ channel, pedestal ]: pedestals)
+   *   std::cout << channel << ": " << pedestal << std::endl;
+   * if (float const* ped = pedestals.get(channel)) use(*ped);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Insertions invalidate the iterators and the pointers to the data.
+   */
+  template <typename T>
+  class ChannelMap {
+    static_assert(!std::is_same_v<T, bool>,
+      "raw::ChannelMap<bool> is not supported: use raw::ChannelMap<char>.");
+
+    using This_t = ChannelMap<T>;
+    using Word_t = std::uint64_t; ///< Type of a word of the presence bitmap.
+    static constexpr std::size_t WordBits = 64U;
+
+      public:
+    using key_type = ChannelID_t;
+    using mapped_type = T;
+    using size_type = std::size_t;
+    using iterator = details::ChannelMapIterator<This_t, T>;
+    using const_iterator = details::ChannelMapIterator<This_t const, T const>;
+
+    /// Default limit to the number of channels added by insertion.
+    static constexpr size_type DefaultMaxChannels = size_type(1U) << 24U;
+
+    /// Default constructor: an empty map.
+    ChannelMap() = default;
+
+    /// Constructor: empty map with room for channels up to `nChannels - 1`.
+    explicit ChannelMap(size_type nChannels) { reserve(nChannels); }
+
+
+    // --- BEGIN Query ---------------------------------------------------------
+    /// Returns the number of channels in the map.
+    size_type size() const { return fSize; }
+
+    /// Returns whether there is no channel in the map.
+    bool empty() const { return fSize == 0U; }
+
+    /// Returns the number of channels the map can hold without reallocating.
+    size_type channelCapacity() const { return fData.size(); }
+
+    /// Returns the channel from which on insertion is refused.
+    size_type maxChannels() const
+      { return std::max(fMaxChannels, fData.size()); }
+
+    /// Returns whether `channel` is in the map.
+    bool contains(ChannelID_t channel) const
+      { return (channel < fData.size()) && isPresent(channel); }
+
+    /// Returns the number of entries for `channel` (`0` or `1`).
+    size_type count(ChannelID_t channel) const
+      { return contains(channel)? 1U: 0U; }
+    // --- END Query -----------------------------------------------------------
+
+
+    // --- BEGIN Access --------------------------------------------------------
+    /// Returns a pointer to the data of `channel`, `nullptr` if not present.
+    T* get(ChannelID_t channel)
+      { return contains(channel)? &fData[channel]: nullptr; }
+
+    /// Returns a pointer to the data of `channel`, `nullptr` if not present.
+    T const* get(ChannelID_t channel) const
+      { return contains(channel)? &fData[channel]: nullptr; }
+
+    /// Returns the data of `channel`.
+    /// @throw std::out_of_range if `channel` is not present
+    T& at(ChannelID_t channel) { return fData[checkedChannel(channel)]; }
+
+    /// Returns the data of `channel`.
+    /// @throw std::out_of_range if `channel` is not present
+    T const& at(ChannelID_t channel) const
+      { return fData[checkedChannel(channel)]; }
+
+    /// Returns the data of `channel`, adding it (default value) if missing.
+    /// @throw std::out_of_range if `channel` is `raw::InvalidChannelID`
+    T& operator[] (ChannelID_t channel)
+      { return fData[try_emplace(channel).first.channel()]; }
+
+    /// Returns an iterator to `channel`, or `end()` if not present.
+    iterator find(ChannelID_t channel)
+      { return contains(channel)? iterator{ this, channel }: end(); }
+
+    /// Returns an iterator to `channel`, or `end()` if not present.
+    const_iterator find(ChannelID_t channel) const
+      { return contains(channel)? const_iterator{ this, channel }: end(); }
+    // --- END Access ----------------------------------------------------------
+
+
+    // --- BEGIN Modification --------------------------------------------------
+    /**
+     * @brief Adds `channel` with data constructed from `args`, if missing.
+     * @return iterator to the channel, and whether it was added
+     * @throw std::out_of_range if `channel` is `raw::InvalidChannelID`
+     *        or not smaller than `maxChannels()`
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(ChannelID_t channel, Args&&... args);
+
+    /**
+     * @brief Sets the data of `channel`, adding the channel if missing.
+     * @return iterator to the channel, and whether it was added
+     * @throw std::out_of_range if `channel` is `raw::InvalidChannelID`
+     *        or not smaller than `maxChannels()`
+     */
+    template <typename U>
+    std::pair<iterator, bool> insert_or_assign(ChannelID_t channel, U&& value);
+
+    /// Removes `channel` (its data is reset); returns `1` if it was present.
+    size_type erase(ChannelID_t channel);
+
+    /// Removes all the channels, keeping the allocated memory.
+    void clear();
+
+    /// Prepares the map to hold channels up to `nChannels - 1`.
+    void reserve(size_type nChannels);
+
+    /// Makes insertion refuse channels from `nChannels` on.
+    void setMaxChannels(size_type nChannels) { fMaxChannels = nChannels; }
+    // --- END Modification ----------------------------------------------------
+
+
+    // --- BEGIN Iteration -----------------------------------------------------
+    iterator begin() { return { this, nextPresent(0U) }; }
+    iterator end() { return { this, endChannel() }; }
+    const_iterator begin() const { return { this, nextPresent(0U) }; }
+    const_iterator end() const { return { this, endChannel() }; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    // --- END Iteration -------------------------------------------------------
+
+
+      private:
+    template <typename, typename> friend class details::ChannelMapIterator;
+
+    std::vector<T> fData; ///< Data of each channel, present or not.
+    std::vector<Word_t> fPresent; ///< Bit set for each present channel.
+    size_type fSize = 0U; ///< Number of present channels.
+    size_type fMaxChannels = DefaultMaxChannels; ///< Limit to insertion.
+
+    /// Position of the end iterator.
+    ChannelID_t endChannel() const
+      { return static_cast<ChannelID_t>(fData.size()); }
+
+    bool isPresent(ChannelID_t channel) const
+      {
+        return (fPresent[channel / WordBits] >> (channel % WordBits)) & 1U;
+      }
+
+    /// Returns the first present channel from `channel` on, or `endChannel()`.
+    ChannelID_t nextPresent(ChannelID_t channel) const;
+
+    /// Returns the data position for `channel`, throws if not present.
+    size_type checkedChannel(ChannelID_t channel) const
+      {
+        if (contains(channel)) return channel;
+        throw std::out_of_range("raw::ChannelMap: channel not present");
+      }
+
+    /// Makes sure there is room for `channel`, throws if beyond the limit.
+    void makeRoomFor(ChannelID_t channel);
+
+  }; // class ChannelMap<>
+
+
+  /**
+   * @brief Map from channel ID to data, for few channels in a large range.
+   * @tparam T type of the data for each channel
+   * @see `raw::ChannelMap`
+   *
+   * This map has the same interface as `raw::ChannelMap`, but it stores only
+   * the present channels: their IDs sorted in one vector, and their data in
+   * the same order in another. Lookup is a branchless binary search on the
+   * IDs alone, and iteration is in channel order.
+   * Insertion of a channel beyond the last one is fast, while insertion in
+   * the middle moves all the following channels; `assign()` builds the whole
+   * map from an unsorted list in one go.
+   *
+   * Lookup is still a search: with a few thousand channels it is about as
+   * fast as `std::unordered_map`, but with many (e.g. a whole detector) each
+   * lookup misses the cache several times and takes a few times longer.
+   * If most channels have data, `raw::ChannelMap` is much faster.
+   *
+   * `raw::InvalidChannelID` is never present in the map, and inserting it is
+   * an error. As in `raw::ChannelMap`, `T` can't be `bool`.
+   */
+  template <typename T>
+  class SparseChannelMap {
+    static_assert(!std::is_same_v<T, bool>,
+      "raw::SparseChannelMap<bool> is not supported:"
+      " use raw::SparseChannelMap<char>.");
+
+    using This_t = SparseChannelMap<T>;
+    using Entry_t = std::pair<ChannelID_t, T>; ///< Type of `assign()` entries.
+
+      public:
+    using key_type = ChannelID_t;
+    using mapped_type = T;
+    using size_type = std::size_t;
+    using iterator = details::ChannelMapIterator<This_t, T>;
+    using const_iterator = details::ChannelMapIterator<This_t const, T const>;
+
+    /// Default constructor: an empty map.
+    SparseChannelMap() = default;
+
+
+    // --- BEGIN Query ---------------------------------------------------------
+    /// Returns the number of channels in the map.
+    size_type size() const { return fChannels.size(); }
+
+    /// Returns whether there is no channel in the map.
+    bool empty() const { return fChannels.empty(); }
+
+    /// Returns whether `channel` is in the map.
+    bool contains(ChannelID_t channel) const
+      { return position(channel) != fChannels.size(); }
+
+    /// Returns the number of entries for `channel` (`0` or `1`).
+    size_type count(ChannelID_t channel) const
+      { return contains(channel)? 1U: 0U; }
+    // --- END Query -----------------------------------------------------------
+
+
+    // --- BEGIN Access --------------------------------------------------------
+    /// Returns a pointer to the data of `channel`, `nullptr` if not present.
+    T* get(ChannelID_t channel)
+      {
+        size_type const pos = position(channel);
+        return (pos == fChannels.size())? nullptr: &fValues[pos];
+      }
+
+    /// Returns a pointer to the data of `channel`, `nullptr` if not present.
+    T const* get(ChannelID_t channel) const
+      {
+        size_type const pos = position(channel);
+        return (pos == fChannels.size())? nullptr: &fValues[pos];
+      }
+
+    /// Returns the data of `channel`.
+    /// @throw std::out_of_range if `channel` is not present
+    T& at(ChannelID_t channel)
+      { return fValues[checkedPosition(channel)]; }
+
+    /// Returns the data of `channel`.
+    /// @throw std::out_of_range if `channel` is not present
+    T const& at(ChannelID_t channel) const
+      { return fValues[checkedPosition(channel)]; }
+
+    /// Returns the data of `channel`, adding it (default value) if missing.
+    /// @throw std::out_of_range if `channel` is `raw::InvalidChannelID`
+    T& operator[] (ChannelID_t channel)
+      { return fValues[try_emplace(channel).first.position()]; }
+
+    /// Returns an iterator to `channel`, or `end()` if not present.
+    iterator find(ChannelID_t channel)
+      { return { this, position(channel) }; }
+
+    /// Returns an iterator to `channel`, or `end()` if not present.
+    const_iterator find(ChannelID_t channel) const
+      { return { this, position(channel) }; }
+    // --- END Access ----------------------------------------------------------
+
+
+    // --- BEGIN Modification --------------------------------------------------
+    /// Adds `channel` with data constructed from `args`, if missing.
+    /// @return iterator to the channel, and whether it was added
+    /// @throw std::out_of_range if `channel` is `raw::InvalidChannelID`
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(ChannelID_t channel, Args&&... args);
+
+    /// Sets the data of `channel`, adding the channel if missing.
+    /// @return iterator to the channel, and whether it was added
+    /// @throw std::out_of_range if `channel` is `raw::InvalidChannelID`
+    template <typename U>
+    std::pair<iterator, bool> insert_or_assign(ChannelID_t channel, U&& value);
+
+    /**
+     * @brief Replaces the content of the map with the specified entries.
+     * @param entries list of channels and their data, in any order
+     * @throw std::out_of_range if any channel is `raw::InvalidChannelID`
+     *
+     * If a channel appears more than once, the last entry is kept.
+     */
+    void assign(std::vector<std::pair<ChannelID_t, T>> entries);
+
+    /// Removes `channel`; returns `1` if it was present.
+    size_type erase(ChannelID_t channel);
+
+    /// Removes all the channels, keeping the allocated memory.
+    void clear() { fChannels.clear(); fValues.clear(); }
+
+    /// Prepares the map to hold `nChannels` channels.
+    void reserve(size_type nChannels)
+      { fChannels.reserve(nChannels); fValues.reserve(nChannels); }
+    // --- END Modification ----------------------------------------------------
+
+
+    // --- BEGIN Iteration -----------------------------------------------------
+    iterator begin() { return { this, 0U }; }
+    iterator end() { return { this, fChannels.size() }; }
+    const_iterator begin() const { return { this, 0U }; }
+    const_iterator end() const { return { this, fChannels.size() }; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    // --- END Iteration -------------------------------------------------------
+
+
+      private:
+    template <typename, typename> friend class details::ChannelMapIterator;
+
+    std::vector<ChannelID_t> fChannels; ///< Present channels, sorted.
+    std::vector<T> fValues; ///< Data of the channels, in the same order.
+
+    /// Returns the first entry not before `channel`.
+    size_type lowerBound(ChannelID_t channel) const;
+
+    /// Returns the position of `channel`, or `size()` if not present.
+    size_type position(ChannelID_t channel) const
+      {
+        size_type const pos = lowerBound(channel);
+        return ((pos < fChannels.size()) && (fChannels[pos] == channel))
+          ? pos: fChannels.size();
+      }
+
+    /// Returns the position of `channel`, throws if not present.
+    size_type checkedPosition(ChannelID_t channel) const
+      {
+        size_type const pos = position(channel);
+        if (pos != fChannels.size()) return pos;
+        throw std::out_of_range("raw::SparseChannelMap: channel not present");
+      }
+
+  }; // class SparseChannelMap<>
+
+
+  namespace details {
+
+    /**
+     * @brief Iterator to the channels of `raw::ChannelMap` and
+     *        `raw::SparseChannelMap`.
+     * @tparam Map type of map, possibly constant
+     * @tparam Value type of the data, constant if the map is
+     *
+     * Dereferencing yields a pair of channel ID and reference to the data.
+     */
+    template <typename Map, typename Value>
+    class ChannelMapIterator {
+
+      static constexpr bool isDense
+        = std::is_same_v<std::remove_const_t<Map>,
+          ChannelMap<std::remove_const_t<Value>>>;
+
+        public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = std::pair<ChannelID_t, Value&>;
+      using reference = value_type;
+      using difference_type = std::ptrdiff_t;
+
+      /// Proxy to allow `it->first` and `it->second`.
+      struct pointer {
+        value_type pair;
+        value_type const* operator-> () const { return &pair; }
+      };
+
+      ChannelMapIterator() = default;
+
+      /// Constructor: points to the channel (dense) or entry (sparse) `pos`.
+      ChannelMapIterator(Map* map, std::size_t pos): fMap(map), fPos(pos) {}
+
+      /// Conversion from a mutable to a constant iterator.
+      template <
+        typename OtherMap, typename OtherValue,
+        typename = std::enable_if_t
+          <std::is_const_v<Map> && !std::is_const_v<OtherMap>>
+        >
+      ChannelMapIterator(ChannelMapIterator<OtherMap, OtherValue> const& other)
+        : fMap(other.fMap), fPos(other.fPos) {}
+
+      /// Returns the channel ID pointed by the iterator.
+      ChannelID_t channel() const
+        {
+          if constexpr (isDense) return static_cast<ChannelID_t>(fPos);
+          else return fMap->fChannels[fPos];
+        }
+
+      /// Returns the data pointed by the iterator.
+      Value& value() const
+        {
+          if constexpr (isDense) return fMap->fData[fPos];
+          else return fMap->fValues[fPos];
+        }
+
+      /// Returns the internal position of the iterator.
+      std::size_t position() const { return fPos; }
+
+      reference operator* () const { return { channel(), value() }; }
+      pointer operator-> () const { return { **this }; }
+
+      ChannelMapIterator& operator++ ()
+        {
+          if constexpr (isDense)
+            fPos = fMap->nextPresent(static_cast<ChannelID_t>(fPos + 1U));
+          else ++fPos;
+          return *this;
+        }
+      ChannelMapIterator operator++ (int)
+        { ChannelMapIterator old = *this; ++*this; return old; }
+
+      bool operator== (ChannelMapIterator const& other) const
+        { return fPos == other.fPos; }
+      bool operator!= (ChannelMapIterator const& other) const
+        { return fPos != other.fPos; }
+
+        private:
+      template <typename, typename> friend class ChannelMapIterator;
+
+      Map* fMap = nullptr; ///< The map being iterated.
+      std::size_t fPos = 0U; ///< Channel (dense) or entry (sparse) position.
+
+    }; // class ChannelMapIterator<>
+
+  } // namespace details
+
+} // namespace raw
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+//--- raw::ChannelMap
+//---
+template <typename T>
+template <typename... Args>
+auto raw::ChannelMap<T>::try_emplace(ChannelID_t channel, Args&&... args)
+  -> std::pair<iterator, bool>
+{
+  if (!isValidChannelID(channel))
+    throw std::out_of_range("raw::ChannelMap: invalid channel ID");
+  makeRoomFor(channel);
+  if (isPresent(channel)) return { iterator{ this, channel }, false };
+  if constexpr (sizeof...(Args) > 0U)
+    fData[channel] = T(std::forward<Args>(args)...);
+  fPresent[channel / WordBits] |= (Word_t(1) << (channel % WordBits));
+  ++fSize;
+  return { iterator{ this, channel }, true };
+} // raw::ChannelMap<>::try_emplace()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+template <typename U>
+auto raw::ChannelMap<T>::insert_or_assign(ChannelID_t channel, U&& value)
+  -> std::pair<iterator, bool>
+{
+  auto res = try_emplace(channel);
+  fData[channel] = std::forward<U>(value);
+  return res;
+} // raw::ChannelMap<>::insert_or_assign()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto raw::ChannelMap<T>::erase(ChannelID_t channel) -> size_type {
+  if (!contains(channel)) return 0U;
+  fPresent[channel / WordBits] &= ~(Word_t(1) << (channel % WordBits));
+  fData[channel] = T{};
+  --fSize;
+  return 1U;
+} // raw::ChannelMap<>::erase()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void raw::ChannelMap<T>::clear() {
+  for (ChannelID_t channel = nextPresent(0U); channel < endChannel();
+    channel = nextPresent(channel + 1U)
+  ) {
+    fData[channel] = T{};
+  }
+  std::fill(fPresent.begin(), fPresent.end(), Word_t(0));
+  fSize = 0U;
+} // raw::ChannelMap<>::clear()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void raw::ChannelMap<T>::reserve(size_type nChannels) {
+  if (nChannels <= fData.size()) return;
+  fData.resize(nChannels);
+  fPresent.resize((nChannels + WordBits - 1U) / WordBits, Word_t(0));
+} // raw::ChannelMap<>::reserve()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto raw::ChannelMap<T>::nextPresent(ChannelID_t channel) const -> ChannelID_t
+{
+  std::size_t word = channel / WordBits;
+  if (word >= fPresent.size()) return endChannel();
+  Word_t bits = fPresent[word] >> (channel % WordBits); // first word: partial
+  while (bits == 0U) {
+    if (++word == fPresent.size()) return endChannel();
+    channel = static_cast<ChannelID_t>(word * WordBits);
+    bits = fPresent[word];
+  } // while
+  return channel + details::countTrailingZeros(bits);
+} // raw::ChannelMap<>::nextPresent()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void raw::ChannelMap<T>::makeRoomFor(ChannelID_t channel) {
+  if (channel < fData.size()) return;
+  if (channel >= fMaxChannels)
+    throw std::out_of_range("raw::ChannelMap: channel beyond maxChannels()");
+  // grow geometrically, up to the limit
+  reserve(std::min(std::max<size_type>(channel + 1U, 2U * fData.size()),
+    fMaxChannels));
+} // raw::ChannelMap<>::makeRoomFor()
+
+
+//------------------------------------------------------------------------------
+//--- raw::SparseChannelMap
+//---
+template <typename T>
+template <typename... Args>
+auto raw::SparseChannelMap<T>::try_emplace
+  (ChannelID_t channel, Args&&... args)
+  -> std::pair<iterator, bool>
+{
+  if (!isValidChannelID(channel))
+    throw std::out_of_range("raw::SparseChannelMap: invalid channel ID");
+  size_type const pos = lowerBound(channel);
+  if ((pos < fChannels.size()) && (fChannels[pos] == channel))
+    return { iterator{ this, pos }, false };
+  fValues.emplace(fValues.begin() + pos, std::forward<Args>(args)...);
+  try {
+    fChannels.insert(fChannels.begin() + pos, channel);
+  }
+  catch (...) {
+    fValues.erase(fValues.begin() + pos);
+    throw;
+  }
+  return { iterator{ this, pos }, true };
+} // raw::SparseChannelMap<>::try_emplace()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+template <typename U>
+auto raw::SparseChannelMap<T>::insert_or_assign(ChannelID_t channel, U&& value)
+  -> std::pair<iterator, bool>
+{
+  auto res = try_emplace(channel);
+  fValues[res.first.position()] = std::forward<U>(value);
+  return res;
+} // raw::SparseChannelMap<>::insert_or_assign()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void raw::SparseChannelMap<T>::assign
+  (std::vector<std::pair<ChannelID_t, T>> entries)
+{
+  for (Entry_t const& entry: entries) {
+    if (isValidChannelID(entry.first)) continue;
+    throw std::out_of_range("raw::SparseChannelMap: invalid channel ID");
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+    [](Entry_t const& a, Entry_t const& b){ return a.first < b.first; });
+
+  // keep the last entry of each channel
+  clear();
+  reserve(entries.size());
+  for (Entry_t& entry: entries) {
+    if (!fChannels.empty() && (fChannels.back() == entry.first))
+      fValues.back() = std::move(entry.second);
+    else {
+      fChannels.push_back(entry.first);
+      fValues.push_back(std::move(entry.second));
+    }
+  } // for
+} // raw::SparseChannelMap<>::assign()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto raw::SparseChannelMap<T>::erase(ChannelID_t channel) -> size_type {
+  size_type const pos = position(channel);
+  if (pos == fChannels.size()) return 0U;
+  fChannels.erase(fChannels.begin() + pos);
+  fValues.erase(fValues.begin() + pos);
+  return 1U;
+} // raw::SparseChannelMap<>::erase()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+auto raw::SparseChannelMap<T>::lowerBound(ChannelID_t channel) const
+  -> size_type
+{
+  // the loop has no data-dependent branch: the selection compiles into a
+  // conditional move, so there are no mispredictions to pay on random lookups
+  size_type n = fChannels.size();
+  if (n == 0U) return 0U;
+  ChannelID_t const* base = fChannels.data();
+  while (n > 1U) {
+    size_type const half = n / 2U;
+    base = (base[half] < channel)? base + half: base;
+    n -= half;
+  } // while
+  return (base - fChannels.data()) + (*base < channel);
+} // raw::SparseChannelMap<>::lowerBound()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_CHANNELMAPS_H
@@ -0,0 +1,411 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/RawBitPackedDeltaCodec.h
+ * @brief  Bit-packed delta encoding of ADC waveforms (`raw::kBitPackedDelta`).
+ * @date   October 18, 2026
+ * @see    larcoreobj/SimpleTypesAndConstants/RawTypes.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWBITPACKEDDELTACODEC_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWBITPACKEDDELTACODEC_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawBitStream.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <vector>
+#include <algorithm> // std::min(), std::minmax_element(), std::fill()
+#include <utility> // std::index_sequence
+#include <stdexcept> // std::runtime_error
+#include <cstring> // std::memcpy()
+#include <cstdint> // std::uint32_t, std::int32_t, std::uint16_t
+#include <cstddef> // std::size_t
+
+
+namespace raw {
+
+  namespace codec {
+
+    /**
+     * @brief Encoding of ADC waveforms for `raw::kBitPackedDelta` compression.
+     *
+     * The waveform is coded by the differences between consecutive samples,
+     * in blocks of `BlockSize` samples. In each block the smallest difference
+     * is stored ("frame of reference"), and the differences from it, which
+     * are not negative, are stored with the minimum number of bits needed by
+     * the largest one.
+     *
+     * The stream starts with the number of samples (4 bytes) and the first
+     * sample (2 bytes), which is also the reference for the first difference.
+     * Each block follows, with the bit width (1 byte), the smallest
+     * difference (4 bytes) and the packed differences, as 32-bit words.
+     * All values are little endian.
+     *
+     * The differences are packed in four interleaved lanes: difference `i`
+     * goes to lane `i % 4`, and word `w` of the block belongs to lane `w % 4`.
+     * This way the same shifts and masks apply to four values at a time.
+     * There is a specialised unpacking function for each bit width, where
+     * all the shifts and word positions are compile-time constants, so that
+     * the compiler can unpack a block with straight vector code. The last
+     * block may be shorter, and stores only the words it needs.
+     */
+    struct BitPackedDelta {
+
+      /// Number of samples in a block.
+      static constexpr std::size_t BlockSize = 128U;
+
+      /// Number of interleaved lanes.
+      static constexpr std::size_t Lanes = 4U;
+
+      /// Largest bit width (differences of 16-bit samples need 17 bits).
+      static constexpr unsigned int MaxBitWidth = 17U;
+
+      /// Size of the stream header [bytes].
+      static constexpr std::size_t HeaderSize = 6U;
+
+      /// Size of the header of each block [bytes].
+      static constexpr std::size_t BlockHeaderSize = 5U;
+
+      /// Returns the number of words to pack `n` values of `width` bits.
+      static constexpr std::size_t packedWords
+        (std::size_t n, unsigned int width)
+        {
+          std::size_t const perLane = (n + Lanes - 1U) / Lanes;
+          return Lanes * ((perLane * width + 31U) / 32U);
+        }
+
+      /// Packs `BlockSize` values of `Width` bits from `in` into `out`.
+      template <unsigned int Width>
+      static void pack(std::uint32_t const* in, std::uint32_t* out);
+
+      /// Unpacks `BlockSize` values of `Width` bits from `in` into `out`.
+      template <unsigned int Width>
+      static void unpack(std::uint32_t const* in, std::uint32_t* out);
+
+      /// Type of a packing or unpacking function.
+      using PackFunc_t = void(*)(std::uint32_t const*, std::uint32_t*);
+
+      /// Returns the packing function for `width` bits.
+      static PackFunc_t packer(unsigned int width);
+
+      /// Returns the unpacking function for `width` bits.
+      static PackFunc_t unpacker(unsigned int width);
+
+    }; // struct BitPackedDelta
+
+
+    /// @{
+    /// @name Bit-packed delta encoding (`raw::kBitPackedDelta`)
+
+    /**
+     * @brief Appends the bit-packed delta encoding of a waveform to a buffer.
+     * @param adc pointer to the first sample
+     * @param nSamples number of samples
+     * @param[out] buffer the buffer to append the encoded waveform to
+     * @see `raw::codec::BitPackedDelta` for the format
+     */
+    void encodeBitPackedDelta
+      (short const* adc, std::size_t nSamples, ByteBuffer_t& buffer);
+
+    /// Returns the bit-packed delta encoding of the waveform `adc`.
+    ByteBuffer_t encodeBitPackedDelta(std::vector<short> const& adc);
+
+    /**
+     * @brief Decodes a bit-packed delta encoded waveform.
+     * @param data pointer to the encoded waveform
+     * @param size size of the encoded waveform [bytes]
+     * @param[out] adc the decoded samples (previous content is replaced)
+     * @throw std::runtime_error if the data is truncated or malformed
+     */
+    void decodeBitPackedDelta
+      (Byte_t const* data, std::size_t size, std::vector<short>& adc);
+
+    /// Returns the samples of the bit-packed delta encoded waveform `data`.
+    /// @throw std::runtime_error if the data is truncated or malformed
+    std::vector<short> decodeBitPackedDelta(ByteBuffer_t const& data);
+
+    /// @}
+
+
+    namespace details {
+
+      /// Returns the number of bits needed to represent `value`.
+      inline unsigned int bitWidth(std::uint32_t value)
+        { unsigned int w = 0U; while (value) { ++w; value >>= 1U; } return w; }
+
+      /// Appends the words `words` to `buffer`, little endian.
+      inline void writeWords
+        (ByteBuffer_t& buffer, std::uint32_t const* words, std::size_t n)
+        {
+          for (std::size_t i = 0; i < n; ++i) writeUInt32(buffer, words[i]);
+        }
+
+      /// Copies `n` little endian words from `data` into `words`.
+      inline void readWords
+        (Byte_t const* data, std::uint32_t* words, std::size_t n)
+        {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+          std::memcpy(words, data, 4U * n);
+#else
+          for (std::size_t i = 0; i < n; ++i)
+            words[i] = readUInt32(data + 4U * i);
+#endif // little endian
+        }
+
+      /// Returns a table of the functions `F<Width>` for all the widths.
+      template <
+        template <unsigned int> typename F, std::size_t... Widths
+        >
+      constexpr std::array<BitPackedDelta::PackFunc_t, sizeof...(Widths)>
+      makePackTable(std::index_sequence<Widths...>)
+        { return { F<Widths>::value... }; }
+
+      /// Packs the values of row `Row` (one value per lane).
+      template <unsigned int Width, std::size_t Row>
+      void packRow(std::uint32_t const* in, std::uint32_t* out);
+
+      /// Unpacks the values of row `Row` (one value per lane).
+      template <unsigned int Width, std::size_t Row>
+      void unpackRow(std::uint32_t const* in, std::uint32_t* out);
+
+      /// Packs all the rows, with shifts and positions known at compile time.
+      template <unsigned int Width, std::size_t... Rows>
+      void packRows(
+        std::uint32_t const* in, std::uint32_t* out,
+        std::index_sequence<Rows...>
+        )
+        { (packRow<Width, Rows>(in, out), ...); }
+
+      /// Unpacks all the rows, with shifts and positions known at compile time.
+      template <unsigned int Width, std::size_t... Rows>
+      void unpackRows(
+        std::uint32_t const* in, std::uint32_t* out,
+        std::index_sequence<Rows...>
+        )
+        { (unpackRow<Width, Rows>(in, out), ...); }
+
+      template <unsigned int Width>
+      struct Packer
+        { static constexpr auto value = &BitPackedDelta::pack<Width>; };
+
+      template <unsigned int Width>
+      struct Unpacker
+        { static constexpr auto value = &BitPackedDelta::unpack<Width>; };
+
+    } // namespace details
+
+  } // namespace codec
+
+} // namespace raw
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <unsigned int Width>
+void raw::codec::BitPackedDelta::pack
+  (std::uint32_t const* in, std::uint32_t* out)
+{
+  std::fill(out, out + packedWords(BlockSize, Width), 0U);
+  if constexpr (Width > 0U) {
+    details::packRows<Width>
+      (in, out, std::make_index_sequence<BlockSize / Lanes>{});
+  }
+} // raw::codec::BitPackedDelta::pack()
+
+
+template <unsigned int Width>
+void raw::codec::BitPackedDelta::unpack
+  (std::uint32_t const* in, std::uint32_t* out)
+{
+  if constexpr (Width == 0U) std::fill(out, out + BlockSize, 0U);
+  else {
+    details::unpackRows<Width>
+      (in, out, std::make_index_sequence<BlockSize / Lanes>{});
+  }
+} // raw::codec::BitPackedDelta::unpack()
+
+
+//------------------------------------------------------------------------------
+template <unsigned int Width, std::size_t Row>
+void raw::codec::details::packRow(std::uint32_t const* in, std::uint32_t* out)
+{
+  constexpr std::size_t Lanes = BitPackedDelta::Lanes;
+  constexpr std::size_t Bit = Row * Width;
+  constexpr std::size_t Word = Lanes * (Bit / 32U);
+  constexpr unsigned int Shift = Bit % 32U;
+  for (std::size_t lane = 0; lane < Lanes; ++lane) {
+    std::uint32_t const value = in[Lanes * Row + lane];
+    out[Word + lane] |= value << Shift;
+    if constexpr (Shift + Width > 32U)
+      out[Word + Lanes + lane] |= value >> (32U - Shift);
+  }
+} // raw::codec::details::packRow()
+
+
+template <unsigned int Width, std::size_t Row>
+void raw::codec::details::unpackRow
+  (std::uint32_t const* in, std::uint32_t* out)
+{
+  constexpr std::size_t Lanes = BitPackedDelta::Lanes;
+  constexpr std::size_t Bit = Row * Width;
+  constexpr std::size_t Word = Lanes * (Bit / 32U);
+  constexpr unsigned int Shift = Bit % 32U;
+  constexpr std::uint32_t Mask = (std::uint32_t(1) << Width) - 1U;
+  for (std::size_t lane = 0; lane < Lanes; ++lane) {
+    std::uint32_t value = in[Word + lane] >> Shift;
+    if constexpr (Shift + Width > 32U)
+      value |= in[Word + Lanes + lane] << (32U - Shift);
+    out[Lanes * Row + lane] = value & Mask;
+  }
+} // raw::codec::details::unpackRow()
+
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+inline auto raw::codec::BitPackedDelta::packer(unsigned int width)
+  -> PackFunc_t
+{
+  static constexpr auto table = details::makePackTable<details::Packer>
+    (std::make_index_sequence<MaxBitWidth + 1U>{});
+  return table[width];
+} // raw::codec::BitPackedDelta::packer()
+
+
+inline auto raw::codec::BitPackedDelta::unpacker(unsigned int width)
+  -> PackFunc_t
+{
+  static constexpr auto table = details::makePackTable<details::Unpacker>
+    (std::make_index_sequence<MaxBitWidth + 1U>{});
+  return table[width];
+} // raw::codec::BitPackedDelta::unpacker()
+
+
+//------------------------------------------------------------------------------
+inline void raw::codec::encodeBitPackedDelta
+  (short const* adc, std::size_t nSamples, ByteBuffer_t& buffer)
+{
+  using BPD = BitPackedDelta;
+
+  writeUInt32(buffer, static_cast<std::uint32_t>(nSamples));
+  int prev = (nSamples > 0U)? adc[0]: 0;
+  std::uint16_t const first = static_cast<std::uint16_t>(prev);
+  buffer.push_back(static_cast<Byte_t>(first));
+  buffer.push_back(static_cast<Byte_t>(first >> 8U));
+
+  std::array<std::int32_t, BPD::BlockSize> deltas;
+  std::array<std::uint32_t, BPD::BlockSize> offsets;
+  std::array<std::uint32_t, BPD::Lanes * BPD::MaxBitWidth> packed;
+  for (std::size_t start = 0; start < nSamples; start += BPD::BlockSize) {
+    std::size_t const n = std::min(BPD::BlockSize, nSamples - start);
+
+    for (std::size_t i = 0; i < n; ++i) {
+      int const sample = adc[start + i];
+      deltas[i] = sample - prev;
+      prev = sample;
+    }
+    auto const [ minIt, maxIt ]
+      = std::minmax_element(deltas.begin(), deltas.begin() + n);
+    std::int32_t const minDelta = *minIt;
+    unsigned int const width
+      = details::bitWidth(std::uint32_t(*maxIt - minDelta));
+
+    for (std::size_t i = 0; i < n; ++i)
+      offsets[i] = std::uint32_t(deltas[i] - minDelta);
+    std::fill(offsets.begin() + n, offsets.end(), 0U); // short last block
+    BPD::packer(width)(offsets.data(), packed.data());
+
+    buffer.push_back(static_cast<Byte_t>(width));
+    writeUInt32(buffer, static_cast<std::uint32_t>(minDelta));
+    details::writeWords(buffer, packed.data(), BPD::packedWords(n, width));
+  } // for blocks
+
+} // raw::codec::encodeBitPackedDelta()
+
+
+inline auto raw::codec::encodeBitPackedDelta(std::vector<short> const& adc)
+  -> ByteBuffer_t
+{
+  ByteBuffer_t buffer;
+  encodeBitPackedDelta(adc.data(), adc.size(), buffer);
+  return buffer;
+} // raw::codec::encodeBitPackedDelta()
+
+
+//------------------------------------------------------------------------------
+inline void raw::codec::decodeBitPackedDelta
+  (Byte_t const* data, std::size_t size, std::vector<short>& adc)
+{
+  using BPD = BitPackedDelta;
+
+  if (size < BPD::HeaderSize) {
+    throw std::runtime_error
+      ("raw::codec::decodeBitPackedDelta(): truncated header");
+  }
+  std::size_t const nSamples = readUInt32(data);
+  // unsigned arithmetic: wraps around like 16-bit samples, even on bad data
+  std::uint32_t prev = static_cast<std::uint32_t>(static_cast<short>
+    (static_cast<std::uint16_t>(data[4] | (data[5] << 8U))));
+  std::size_t const nBlocks
+    = (nSamples + BPD::BlockSize - 1U) / BPD::BlockSize;
+  if (nBlocks > (size - BPD::HeaderSize) / BPD::BlockHeaderSize) {
+    throw std::runtime_error("raw::codec::decodeBitPackedDelta(): "
+      "sample count exceeds the data size");
+  }
+
+  adc.resize(nSamples);
+  std::array<std::uint32_t, BPD::Lanes * BPD::MaxBitWidth> packed;
+  std::array<std::uint32_t, BPD::BlockSize> offsets;
+  Byte_t const* ptr = data + BPD::HeaderSize;
+  Byte_t const* const end = data + size;
+  for (std::size_t start = 0; start < nSamples; start += BPD::BlockSize) {
+    std::size_t const n = std::min(BPD::BlockSize, nSamples - start);
+
+    if (std::size_t(end - ptr) < BPD::BlockHeaderSize) {
+      throw std::runtime_error
+        ("raw::codec::decodeBitPackedDelta(): truncated block header");
+    }
+    unsigned int const width = ptr[0];
+    std::uint32_t const minDelta = readUInt32(ptr + 1);
+    ptr += BPD::BlockHeaderSize;
+    if (width > BPD::MaxBitWidth) {
+      throw std::runtime_error
+        ("raw::codec::decodeBitPackedDelta(): invalid bit width");
+    }
+    std::size_t const nWords = BPD::packedWords(n, width);
+    if (std::size_t(end - ptr) < 4U * nWords) {
+      throw std::runtime_error
+        ("raw::codec::decodeBitPackedDelta(): truncated block");
+    }
+    details::readWords(ptr, packed.data(), nWords);
+    std::fill(packed.begin() + nWords, packed.end(), 0U);
+    ptr += 4U * nWords;
+
+    BPD::unpacker(width)(packed.data(), offsets.data());
+
+    short* const out = adc.data() + start;
+    for (std::size_t i = 0; i < n; ++i) {
+      prev += minDelta + offsets[i];
+      out[i] = static_cast<short>(static_cast<std::uint16_t>(prev));
+    }
+  } // for blocks
+
+} // raw::codec::decodeBitPackedDelta()
+
+
+inline std::vector<short> raw::codec::decodeBitPackedDelta
+  (ByteBuffer_t const& data)
+{
+  std::vector<short> adc;
+  decodeBitPackedDelta(data.data(), data.size(), adc);
+  return adc;
+} // raw::codec::decodeBitPackedDelta()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWBITPACKEDDELTACODEC_H
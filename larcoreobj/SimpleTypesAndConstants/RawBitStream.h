@@ -0,0 +1,167 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/RawBitStream.h
+ * @brief  Bit-level writing and reading of compressed raw data streams.
+ * @date   October 18, 2026
+ * @see    larcoreobj/SimpleTypesAndConstants/RawTypes.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWBITSTREAM_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWBITSTREAM_H
+
+// C/C++ standard libraries
+#include <vector>
+#include <cstring> // std::memcpy()
+#include <cstdint> // std::uint8_t, std::uint64_t
+#include <cstddef> // std::size_t
+
+
+namespace raw {
+
+  namespace codec {
+
+    /// Type of a byte of compressed data.
+    using Byte_t = std::uint8_t;
+
+    /// Type of a buffer of compressed data.
+    using ByteBuffer_t = std::vector<Byte_t>;
+
+
+    /**
+     * @brief Appends bits to a byte buffer.
+     *
+     * Bits are written least significant first: the first bit written is the
+     * lowest bit of the first byte. Multi-bit values are written starting from
+     * their least significant bit, so that they can be read back with a shift
+     * and a mask (`raw::codec::BitReader`).
+     *
+     * Bits are collected in a 64-bit accumulator and moved to the buffer a
+     * whole byte at a time; `flush()` must be called to write the last bits.
+     */
+    class BitWriter {
+
+        public:
+      /// Constructor: appends to `buffer`, which must outlive the writer.
+      explicit BitWriter(ByteBuffer_t& buffer): fBuffer(buffer) {}
+
+      /// Appends the lowest `nBits` bits of `value` (`nBits` up to `32`).
+      void write(std::uint64_t value, unsigned int nBits)
+        {
+          fAccumulator |= (value & lowMask(nBits)) << fNBits;
+          fNBits += nBits;
+          while (fNBits >= 8U) {
+            fBuffer.push_back(static_cast<Byte_t>(fAccumulator));
+            fAccumulator >>= 8U;
+            fNBits -= 8U;
+          }
+        }
+
+      /// Writes the pending bits, padding the last byte with zeroes.
+      void flush()
+        {
+          if (fNBits > 0U) fBuffer.push_back(static_cast<Byte_t>(fAccumulator));
+          fAccumulator = 0U;
+          fNBits = 0U;
+        }
+
+      /// Returns a mask with the lowest `nBits` bits set (`nBits` up to `63`).
+      static constexpr std::uint64_t lowMask(unsigned int nBits)
+        { return (std::uint64_t(1) << nBits) - 1U; }
+
+        private:
+      ByteBuffer_t& fBuffer; ///< Destination of the bits.
+      std::uint64_t fAccumulator = 0U; ///< Bits not yet written.
+      unsigned int fNBits = 0U; ///< Number of bits in the accumulator.
+
+    }; // class BitWriter
+
+
+    /**
+     * @brief Reads bits from a byte buffer written by `raw::codec::BitWriter`.
+     *
+     * The reader keeps only the position in the buffer; `peek()` loads the
+     * 64 bits starting at the byte holding the current position and shifts
+     * them, which makes at least 57 bits available without branches.
+     * Bits beyond the end of the buffer read as `0`; `overrun()` tells whether
+     * the position has gone past the end.
+     */
+    class BitReader {
+
+        public:
+      /// Maximum number of bits `peek()` can return.
+      static constexpr unsigned int MaxPeekBits = 57U;
+
+      /// Constructor: reads `size` bytes from `data`.
+      BitReader(Byte_t const* data, std::size_t size)
+        : fData(data), fSize(size) {}
+
+      /// Returns the next bits, without consuming them (lowest bit is first).
+      std::uint64_t peek() const
+        { return load(fBitPos / 8U) >> (fBitPos % 8U); }
+
+      /// Consumes `nBits` bits.
+      void skip(unsigned int nBits) { fBitPos += nBits; }
+
+      /// Returns and consumes the next `nBits` bits (`nBits` up to `57`).
+      std::uint64_t read(unsigned int nBits)
+        {
+          std::uint64_t const value = peek() & BitWriter::lowMask(nBits);
+          skip(nBits);
+          return value;
+        }
+
+      /// Returns the number of bits consumed so far.
+      std::size_t position() const { return fBitPos; }
+
+      /// Returns whether more bits were consumed than the buffer holds.
+      bool overrun() const { return fBitPos > fSize * 8U; }
+
+        private:
+      Byte_t const* fData; ///< Start of the buffer.
+      std::size_t fSize; ///< Size of the buffer [bytes].
+      std::size_t fBitPos = 0U; ///< Number of bits consumed.
+
+      /// Returns the 8 bytes starting at `byte` (little endian, zero padded).
+      std::uint64_t load(std::size_t byte) const
+        {
+          std::uint64_t word = 0U;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+          if (byte + 8U <= fSize) {
+            std::memcpy(&word, fData + byte, 8U);
+            return word;
+          }
+#endif // little endian
+          for (unsigned int i = 0; i < 8U; ++i) {
+            if (byte + i >= fSize) break;
+            word |= std::uint64_t(fData[byte + i]) << (8U * i);
+          }
+          return word;
+        }
+
+    }; // class BitReader
+
+
+    /// Appends `value` to `buffer` as 4 bytes, little endian.
+    inline void writeUInt32(ByteBuffer_t& buffer, std::uint32_t value)
+      {
+        for (unsigned int i = 0; i < 4U; ++i)
+          buffer.push_back(static_cast<Byte_t>(value >> (8U * i)));
+      }
+
+    /// Returns the 4-byte little endian value at `data`.
+    inline std::uint32_t readUInt32(Byte_t const* data)
+      {
+        return std::uint32_t(data[0]) | (std::uint32_t(data[1]) << 8U)
+          | (std::uint32_t(data[2]) << 16U) | (std::uint32_t(data[3]) << 24U);
+      }
+
+  } // namespace codec
+
+} // namespace raw
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWBITSTREAM_H
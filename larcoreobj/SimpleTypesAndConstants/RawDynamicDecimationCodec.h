@@ -0,0 +1,651 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/RawDynamicDecimationCodec.h
+ * @brief  Streaming dynamic decimation of ADC waveforms (`raw::kDynamicDec`).
+ * @date   October 18, 2026
+ * @see    larcoreobj/SimpleTypesAndConstants/RawTypes.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWDYNAMICDECIMATIONCODEC_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWDYNAMICDECIMATIONCODEC_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawZeroSuppressionCodec.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <deque>
+#include <algorithm> // std::min(), std::max(), std::clamp()
+#include <utility> // std::move()
+#include <stdexcept> // std::domain_error, std::runtime_error, std::length_error
+#include <cmath> // std::sin(), std::cos(), std::lround(), std::abs()
+#include <cstdlib> // std::abs()
+#include <climits> // SHRT_MIN, SHRT_MAX, INT_MAX
+#include <cstdint> // std::uint16_t, std::int64_t
+#include <cstddef> // std::size_t
+
+
+namespace raw {
+
+  namespace codec {
+
+    /**
+     * @brief Block of a dynamically decimated waveform.
+     *
+     * The block covers `nTicks` consecutive ticks starting at `firstTick`.
+     * With `decimation` equal to `1` the block holds all of them; otherwise
+     * it holds one sample for each group of `decimation` ticks (the last
+     * group may be shorter), that is the value of the filtered waveform at
+     * the central tick of the group.
+     *
+     * In encoded form, a block is a sequence of `short` words: its number of
+     * ticks (two words, low first), its decimation, and its samples. The
+     * first tick is not stored, since it is the end of the previous block.
+     * A whole waveform is its blocks, one after the other.
+     */
+    struct DynamicDecimationBlock {
+      std::size_t firstTick = 0U; ///< First tick covered by the block.
+      std::size_t nTicks = 0U; ///< Number of ticks covered by the block.
+      unsigned int decimation = 1U; ///< Ticks per sample.
+      std::vector<short> samples; ///< The samples.
+
+      /// Returns whether the block holds all its ticks.
+      bool isFullRate() const { return decimation == 1U; }
+
+      /// Returns the tick of the sample `index` (the centre of its group).
+      std::size_t sampleTick(std::size_t index) const
+        {
+          std::size_t const start = index * decimation;
+          std::size_t const width = std::min<std::size_t>
+            (decimation, nTicks - start);
+          return firstTick + start + (width - 1U) / 2U;
+        }
+
+      /// Number of words of the header of an encoded block.
+      static constexpr std::size_t HeaderSize = 3U;
+
+      /// Returns the number of words of the encoded block.
+      std::size_t encodedSize() const { return HeaderSize + samples.size(); }
+
+      /**
+       * @brief Appends the encoded block to a buffer.
+       * @param[out] encoded the buffer to append the block to
+       * @throw std::length_error if the block has 2^32 ticks or more, or a
+       *        decimation of 2^16 or more
+       */
+      void write(std::vector<short>& encoded) const;
+
+      /**
+       * @brief Replaces the content of this block with an encoded one.
+       * @param data pointer to the encoded block
+       * @param size number of words available at `data`
+       * @param first the first tick of the block
+       * @return the number of words of the encoded block
+       * @throw std::runtime_error if the data is truncated or malformed
+       */
+      std::size_t read(short const* data, std::size_t size, std::size_t first);
+
+    }; // struct DynamicDecimationBlock
+
+
+    /**
+     * @brief Streaming encoder for dynamic decimation (`raw::kDynamicDec`).
+     *
+     * The waveform is split in blocks of `blockSize` ticks. A block where
+     * any tick, or any tick within `guardTicks` from it, is further than
+     * `threshold` from the pedestal is kept at full rate; the other blocks,
+     * which contain only baseline, are low-pass filtered and one tick every
+     * `decimation` is kept. The compression is lossy only on the baseline.
+     *
+     * The anti-aliasing filter is a symmetric FIR filter; by default a
+     * windowed sinc (Hamming window) with cut-off at the Nyquist frequency
+     * of the decimated waveform and `4 decimation + 1` coefficients. The
+     * waveform is extended at both ends by repeating its first and last tick.
+     * The filter is applied in fixed point arithmetic (coefficients with
+     * `FilterFractionBits` fractional bits, 32-bit integer sums), which the
+     * compiler vectorizes and which gives the same result on all platforms.
+     *
+     * The encoder is incremental: ticks are pushed as they come, and each
+     * block is ready to be pulled as soon as the ticks the filter and the
+     * activity check need after it have been pushed. Only those ticks are
+     * buffered, not the whole waveform:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * raw::codec::DynamicDecimationEncoder encoder { config, pedestal };
+     * raw::codec::DynamicDecimationBlock block;
+     * while (readTicks(buffer)) {
+     *   encoder.push(buffer.data(), buffer.size());
+     *   while (encoder.pull(block)) write(block);
+     * }
+     * encoder.flush();
+     * while (encoder.pull(block)) write(block);
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    class DynamicDecimationEncoder {
+
+        public:
+      /// Configuration of the decimation.
+      struct Config_t {
+        std::size_t blockSize = 64U; ///< Ticks per block.
+        unsigned int decimation = 4U; ///< Ticks per sample in quiet blocks.
+        short threshold = 10; ///< Distance from pedestal marking activity.
+        std::size_t guardTicks = 16U; ///< Ticks kept around activity.
+        /// Filter coefficients (odd number); empty for the default filter.
+        std::vector<float> filter;
+      }; // struct Config_t
+
+      /**
+       * @brief Constructor: uses the specified configuration and pedestal.
+       * @throw std::domain_error if the configuration is not valid
+       *
+       * The block size must be a positive multiple of the decimation, and
+       * the filter must have an odd number of coefficients, whose absolute
+       * values add up to less than `4`.
+       */
+      DynamicDecimationEncoder(Config_t config, short pedestal);
+
+      /// Returns the configuration of the encoder.
+      Config_t const& config() const { return fConfig; }
+
+      /// Returns the filter coefficients in use.
+      std::vector<float> const& filter() const { return fConfig.filter; }
+
+      /// Adds `nTicks` ticks at the end of the waveform.
+      void push(short const* ticks, std::size_t nTicks);
+
+      /// Adds the ticks `ticks` at the end of the waveform.
+      void push(std::vector<short> const& ticks)
+        { push(ticks.data(), ticks.size()); }
+
+      /// Declares the end of the waveform, making all the blocks ready.
+      void flush();
+
+      /// Moves the next ready block into `block`; returns false if none.
+      bool pull(DynamicDecimationBlock& block);
+
+      /// Returns the number of blocks ready to be pulled.
+      std::size_t nReady() const { return fReady.size(); }
+
+      /// Returns the number of ticks pushed so far.
+      std::size_t nPushed() const { return fNPushed; }
+
+      /// Starts a new waveform with the specified pedestal.
+      void reset(short pedestal);
+
+      /// Number of fractional bits of the fixed point filter coefficients.
+      static constexpr unsigned int FilterFractionBits = 14U;
+
+      /// Returns the default filter for a decimation factor.
+      static std::vector<float> defaultFilter(unsigned int decimation);
+
+        private:
+      Config_t fConfig; ///< Configuration.
+      short fPedestal; ///< Pedestal of the current waveform.
+      std::size_t fHalfFilter; ///< Filter coefficients on each side.
+      std::vector<int> fCoeffs; ///< Filter coefficients, in fixed point.
+
+      /// Buffered ticks, from `fHalfFilter` ticks before `fBufferFirst`.
+      std::vector<short> fBuffer;
+      std::size_t fBufferFirst = 0U; ///< Tick of `fBuffer[fHalfFilter]`.
+      std::size_t fNPushed = 0U; ///< Number of ticks pushed.
+      std::size_t fNextBlock = 0U; ///< First tick of the next block.
+      bool fFlushed = false; ///< Whether the waveform is complete.
+      std::deque<DynamicDecimationBlock> fReady; ///< Blocks ready.
+
+      /// Returns the buffered tick `tick` (includes the filter margins).
+      short const* tickPtr(std::size_t tick) const
+        { return fBuffer.data() + fHalfFilter + (tick - fBufferFirst); }
+
+      /// Returns the number of ticks needed after a block to encode it.
+      std::size_t lookahead() const
+        { return std::max(fHalfFilter, fConfig.guardTicks); }
+
+      /// Encodes all the blocks which can be encoded.
+      void encodeReady();
+
+      /// Encodes the block starting at `fNextBlock`.
+      void encodeBlock();
+
+      /// Drops the ticks not needed anymore.
+      void compact();
+
+    }; // class DynamicDecimationEncoder
+
+
+    /**
+     * @brief Streaming decoder for dynamic decimation (`raw::kDynamicDec`).
+     *
+     * Full-rate blocks are copied; decimated ones are interpolated linearly
+     * between the ticks of their samples, and the ticks before the first
+     * sample and after the last one take its value.
+     * Blocks must be decoded in order, with no gaps.
+     */
+    class DynamicDecimationDecoder {
+
+        public:
+      /**
+       * @brief Appends the ticks of `block` to `ticks`.
+       * @throw std::runtime_error if the block does not follow the previous
+       *        one, or its samples do not match its size
+       */
+      void decode
+        (DynamicDecimationBlock const& block, std::vector<short>& ticks);
+
+      /// Returns the number of ticks decoded so far.
+      std::size_t nDecoded() const { return fNextTick; }
+
+      /// Starts a new waveform.
+      void reset() { fNextTick = 0U; }
+
+        private:
+      std::size_t fNextTick = 0U; ///< First tick of the next block.
+
+      /**
+       * @brief Writes `width` ticks from `v0` towards `v0 + step`.
+       * @tparam Int integer type wide enough for `2 (|step| + 1) width`
+       *
+       * Tick `dt` is `v0 + step dt / width`, rounded half away from zero.
+       */
+      template <typename Int>
+      static void interpolate
+        (short* out, int v0, int step, std::size_t width);
+
+    }; // class DynamicDecimationDecoder
+
+
+    /// @{
+    /// @name Dynamic decimation of whole waveforms (`raw::kDynamicDec`)
+
+    /// Returns the blocks of the dynamically decimated waveform `adc`.
+    std::vector<DynamicDecimationBlock> encodeDynamicDecimation(
+      std::vector<short> const& adc, short pedestal,
+      DynamicDecimationEncoder::Config_t const& config
+      );
+
+    /// Returns the waveform decoded from its blocks.
+    std::vector<short> decodeDynamicDecimation
+      (std::vector<DynamicDecimationBlock> const& blocks);
+
+    /// Appends the encoded blocks of the decimated waveform `adc` to
+    /// `encoded` (see `raw::codec::DynamicDecimationBlock` for the format).
+    void encodeDynamicDecimation(
+      std::vector<short> const& adc, short pedestal,
+      DynamicDecimationEncoder::Config_t const& config,
+      std::vector<short>& encoded
+      );
+
+    /**
+     * @brief Writes into `adc` the waveform of the encoded blocks at `data`.
+     * @param data pointer to the first encoded block
+     * @param size number of words of all the encoded blocks
+     * @param[out] adc the decoded waveform
+     * @throw std::runtime_error if the data is truncated or malformed
+     */
+    void decodeDynamicDecimation
+      (short const* data, std::size_t size, std::vector<short>& adc);
+
+    /// @}
+
+  } // namespace codec
+
+} // namespace raw
+
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+//--- raw::codec::DynamicDecimationBlock
+//---
+inline void raw::codec::DynamicDecimationBlock::write
+  (std::vector<short>& encoded) const
+{
+  if ((nTicks > 0xFFFFFFFFU) || (decimation > 0xFFFFU)) {
+    throw std::length_error
+      ("raw::codec::DynamicDecimationBlock: block too long or decimated");
+  }
+  std::size_t const start = encoded.size();
+  encoded.resize(start + encodedSize());
+  short* const out = encoded.data() + start;
+  details::writeWords32(out, nTicks);
+  out[2] = static_cast<short>(static_cast<std::uint16_t>(decimation));
+  std::copy(samples.begin(), samples.end(), out + HeaderSize);
+} // raw::codec::DynamicDecimationBlock::write()
+
+
+inline std::size_t raw::codec::DynamicDecimationBlock::read
+  (short const* data, std::size_t size, std::size_t first)
+{
+  if (size < HeaderSize) {
+    throw std::runtime_error
+      ("raw::codec::DynamicDecimationBlock: truncated header");
+  }
+  firstTick = first;
+  nTicks = details::readWords32(data);
+  decimation = static_cast<std::uint16_t>(data[2]);
+  if (decimation == 0U) {
+    throw std::runtime_error
+      ("raw::codec::DynamicDecimationBlock: malformed header");
+  }
+  std::size_t const nSamples = (nTicks + decimation - 1U) / decimation;
+  if (nSamples > size - HeaderSize) {
+    throw std::runtime_error
+      ("raw::codec::DynamicDecimationBlock: truncated samples");
+  }
+  samples.assign(data + HeaderSize, data + HeaderSize + nSamples);
+  return HeaderSize + nSamples;
+} // raw::codec::DynamicDecimationBlock::read()
+
+
+//------------------------------------------------------------------------------
+//--- raw::codec::DynamicDecimationEncoder
+//---
+inline raw::codec::DynamicDecimationEncoder::DynamicDecimationEncoder
+  (Config_t config, short pedestal)
+  : fConfig(std::move(config)), fPedestal(pedestal)
+{
+  if ((fConfig.decimation == 0U) || (fConfig.decimation > 0xFFFFU)) {
+    throw std::domain_error("raw::codec::DynamicDecimationEncoder: "
+      "decimation must be positive and fit 16 bits");
+  }
+  if ((fConfig.blockSize == 0U) || (fConfig.blockSize % fConfig.decimation))
+  {
+    throw std::domain_error("raw::codec::DynamicDecimationEncoder: "
+      "block size must be a positive multiple of the decimation");
+  }
+  if (fConfig.filter.empty())
+    fConfig.filter = defaultFilter(fConfig.decimation);
+  if ((fConfig.filter.size() % 2U) == 0U) {
+    throw std::domain_error("raw::codec::DynamicDecimationEncoder: "
+      "filter must have an odd number of coefficients");
+  }
+  fHalfFilter = fConfig.filter.size() / 2U;
+
+  // fixed point coefficients; the sum must not overflow with any sample
+  constexpr double Scale = double(1U << FilterFractionBits);
+  long long sumAbs = 0;
+  for (float c: fConfig.filter) {
+    if (!(std::abs(c) < 4.0f)) { sumAbs = -1; break; }
+    fCoeffs.push_back(static_cast<int>(std::lround(c * Scale)));
+    sumAbs += std::abs(fCoeffs.back());
+  }
+  if ((sumAbs < 0) || (sumAbs >= (4LL << FilterFractionBits))) {
+    throw std::domain_error("raw::codec::DynamicDecimationEncoder: "
+      "filter coefficients too large");
+  }
+} // raw::codec::DynamicDecimationEncoder::DynamicDecimationEncoder()
+
+
+//------------------------------------------------------------------------------
+inline std::vector<float> raw::codec::DynamicDecimationEncoder::defaultFilter
+  (unsigned int decimation)
+{
+  if (decimation <= 1U) return { 1.0f };
+
+  constexpr double Pi = 3.14159265358979323846;
+  std::size_t const half = 2U * decimation;
+  double const cutoff = 0.5 / decimation; // [ cycles/tick ]
+  std::vector<double> coeffs(2U * half + 1U);
+  double sum = 0.0;
+  for (std::size_t i = 0; i < coeffs.size(); ++i) {
+    double const x = double(i) - double(half);
+    double const sinc = (x == 0.0)
+      ? 2.0 * cutoff: std::sin(2.0 * Pi * cutoff * x) / (Pi * x);
+    double const window
+      = 0.54 - 0.46 * std::cos(2.0 * Pi * double(i) / double(2U * half));
+    coeffs[i] = sinc * window;
+    sum += coeffs[i];
+  } // for
+
+  std::vector<float> filter;
+  filter.reserve(coeffs.size());
+  for (double c: coeffs) filter.push_back(static_cast<float>(c / sum));
+  return filter;
+} // raw::codec::DynamicDecimationEncoder::defaultFilter()
+
+
+//------------------------------------------------------------------------------
+inline void raw::codec::DynamicDecimationEncoder::push
+  (short const* ticks, std::size_t nTicks)
+{
+  if (fFlushed) {
+    throw std::runtime_error
+      ("raw::codec::DynamicDecimationEncoder: push() after flush()");
+  }
+  if (nTicks == 0U) return;
+  // the filter margin before the first tick repeats it
+  if (fNPushed == 0U) fBuffer.assign(fHalfFilter, ticks[0]);
+  fBuffer.insert(fBuffer.end(), ticks, ticks + nTicks);
+  fNPushed += nTicks;
+  encodeReady();
+} // raw::codec::DynamicDecimationEncoder::push()
+
+
+inline void raw::codec::DynamicDecimationEncoder::flush() {
+  if (fFlushed) return;
+  fFlushed = true;
+  if (fNPushed == 0U) return;
+  // the filter margin after the last tick repeats it
+  fBuffer.insert(fBuffer.end(), fHalfFilter, fBuffer.back());
+  encodeReady();
+} // raw::codec::DynamicDecimationEncoder::flush()
+
+
+inline bool raw::codec::DynamicDecimationEncoder::pull
+  (DynamicDecimationBlock& block)
+{
+  if (fReady.empty()) return false;
+  block = std::move(fReady.front());
+  fReady.pop_front();
+  return true;
+} // raw::codec::DynamicDecimationEncoder::pull()
+
+
+inline void raw::codec::DynamicDecimationEncoder::reset(short pedestal) {
+  fPedestal = pedestal;
+  fBuffer.clear();
+  fBufferFirst = 0U;
+  fNPushed = 0U;
+  fNextBlock = 0U;
+  fFlushed = false;
+  fReady.clear();
+} // raw::codec::DynamicDecimationEncoder::reset()
+
+
+//------------------------------------------------------------------------------
+inline void raw::codec::DynamicDecimationEncoder::encodeReady() {
+  std::size_t const needed = fConfig.blockSize + lookahead();
+  while (fNextBlock < fNPushed) {
+    if (!fFlushed && (fNPushed - fNextBlock < needed)) break;
+    encodeBlock();
+  }
+  compact();
+} // raw::codec::DynamicDecimationEncoder::encodeReady()
+
+
+inline void raw::codec::DynamicDecimationEncoder::encodeBlock() {
+
+  DynamicDecimationBlock block;
+  block.firstTick = fNextBlock;
+  block.nTicks = std::min(fConfig.blockSize, fNPushed - fNextBlock);
+
+  // look for activity in the block and around it (branch-free reduction)
+  std::size_t const checkBegin = (fNextBlock > fConfig.guardTicks)
+    ? fNextBlock - fConfig.guardTicks: 0U;
+  std::size_t const checkEnd = std::min
+    (fNextBlock + block.nTicks + fConfig.guardTicks, fNPushed);
+  int const ped = fPedestal;
+  int const threshold = fConfig.threshold;
+  short const* const check = tickPtr(checkBegin);
+  bool active = false;
+  for (std::size_t i = 0; i < checkEnd - checkBegin; ++i) {
+    int const dist = check[i] - ped;
+    active |= (dist > threshold) | (dist < -threshold);
+  }
+
+  short const* const first = tickPtr(fNextBlock);
+  if (active || (fConfig.decimation == 1U)) {
+    block.decimation = 1U;
+    block.samples.assign(first, first + block.nTicks);
+  }
+  else {
+    block.decimation = fConfig.decimation;
+    std::size_t const nSamples
+      = (block.nTicks + block.decimation - 1U) / block.decimation;
+    block.samples.resize(nSamples);
+    int const* const coeffs = fCoeffs.data();
+    std::size_t const nCoeffs = fCoeffs.size();
+    constexpr int Half = 1 << (FilterFractionBits - 1U);
+    for (std::size_t k = 0; k < nSamples; ++k) {
+      // the window of the filter is contiguous in the buffer
+      short const* const window = tickPtr(block.sampleTick(k)) - fHalfFilter;
+      int sum = 0;
+      for (std::size_t j = 0; j < nCoeffs; ++j) sum += coeffs[j] * window[j];
+      int const value = (sum + Half) >> FilterFractionBits;
+      block.samples[k] = static_cast<short>
+        (std::clamp(value, int(SHRT_MIN), int(SHRT_MAX)));
+    } // for samples
+  }
+
+  fNextBlock += block.nTicks;
+  fReady.push_back(std::move(block));
+
+} // raw::codec::DynamicDecimationEncoder::encodeBlock()
+
+
+inline void raw::codec::DynamicDecimationEncoder::compact() {
+  // keep the ticks the next block may look back at
+  std::size_t const keepFrom = (fNextBlock > lookahead())
+    ? fNextBlock - lookahead(): 0U;
+  if (keepFrom <= fBufferFirst) return;
+  std::size_t const drop = keepFrom - fBufferFirst;
+  // drop only when it pays off, to avoid moving the buffer at every block
+  if (drop < fConfig.blockSize) return;
+  fBuffer.erase(fBuffer.begin(), fBuffer.begin() + drop);
+  fBufferFirst = keepFrom;
+} // raw::codec::DynamicDecimationEncoder::compact()
+
+
+//------------------------------------------------------------------------------
+//--- raw::codec::DynamicDecimationDecoder
+//---
+inline void raw::codec::DynamicDecimationDecoder::decode
+  (DynamicDecimationBlock const& block, std::vector<short>& ticks)
+{
+  if (block.firstTick != fNextTick) {
+    throw std::runtime_error
+      ("raw::codec::DynamicDecimationDecoder: block out of sequence");
+  }
+  std::size_t const expectedSamples = (block.decimation == 0U)
+    ? 0U: (block.nTicks + block.decimation - 1U) / block.decimation;
+  if ((block.decimation == 0U) || (block.samples.size() != expectedSamples)) {
+    throw std::runtime_error
+      ("raw::codec::DynamicDecimationDecoder: malformed block");
+  }
+  fNextTick += block.nTicks;
+  if (block.nTicks == 0U) return;
+
+  if (block.isFullRate()) {
+    ticks.insert(ticks.end(), block.samples.begin(), block.samples.end());
+    return;
+  }
+
+  std::size_t const start = ticks.size();
+  ticks.resize(start + block.nTicks);
+  std::size_t const first = block.firstTick;
+  short* const out = ticks.data() + start; // `out[0]` is tick `first`
+  std::size_t tick = first;
+  std::size_t const nSamples = block.samples.size();
+  // before the first sample
+  for (std::size_t const t1 = block.sampleTick(0); tick < t1; ++tick)
+    out[tick - first] = block.samples[0];
+  // between samples; with 16-bit decimations and full-range steps the
+  // interpolation needs more than 32 bits
+  for (std::size_t k = 0; k + 1U < nSamples; ++k) {
+    int const v0 = block.samples[k];
+    int const step = block.samples[k + 1U] - v0;
+    std::size_t const width = block.sampleTick(k + 1U) - tick;
+    std::size_t const range = 2U * (std::abs(step) + 1U) * width;
+    if (range <= static_cast<std::size_t>(INT_MAX))
+      interpolate<int>(out + (tick - first), v0, step, width);
+    else
+      interpolate<std::int64_t>(out + (tick - first), v0, step, width);
+    tick += width;
+  } // for
+  // from the last sample on
+  for (; tick < first + block.nTicks; ++tick)
+    out[tick - first] = block.samples.back();
+
+} // raw::codec::DynamicDecimationDecoder::decode()
+
+
+template <typename Int>
+void raw::codec::DynamicDecimationDecoder::interpolate
+  (short* out, int v0, int step, std::size_t width)
+{
+  // integer arithmetic, rounding half away from zero
+  Int const den = 2 * static_cast<Int>(width);
+  for (Int dt = 0; dt < static_cast<Int>(width); ++dt) {
+    Int const num = 2 * static_cast<Int>(step) * dt;
+    Int const shift
+      = (num >= 0)? (num + den / 2) / den: -((den / 2 - num) / den);
+    out[dt] = static_cast<short>(v0 + shift);
+  }
+} // raw::codec::DynamicDecimationDecoder::interpolate()
+
+
+//------------------------------------------------------------------------------
+inline std::vector<raw::codec::DynamicDecimationBlock>
+raw::codec::encodeDynamicDecimation(
+  std::vector<short> const& adc, short pedestal,
+  DynamicDecimationEncoder::Config_t const& config
+) {
+  DynamicDecimationEncoder encoder { config, pedestal };
+  encoder.push(adc);
+  encoder.flush();
+  std::vector<DynamicDecimationBlock> blocks(encoder.nReady());
+  for (DynamicDecimationBlock& block: blocks) encoder.pull(block);
+  return blocks;
+} // raw::codec::encodeDynamicDecimation()
+
+
+inline std::vector<short> raw::codec::decodeDynamicDecimation
+  (std::vector<DynamicDecimationBlock> const& blocks)
+{
+  DynamicDecimationDecoder decoder;
+  std::vector<short> adc;
+  for (DynamicDecimationBlock const& block: blocks) decoder.decode(block, adc);
+  return adc;
+} // raw::codec::decodeDynamicDecimation()
+
+
+inline void raw::codec::encodeDynamicDecimation(
+  std::vector<short> const& adc, short pedestal,
+  DynamicDecimationEncoder::Config_t const& config,
+  std::vector<short>& encoded
+) {
+  DynamicDecimationEncoder encoder { config, pedestal };
+  encoder.push(adc);
+  encoder.flush();
+  DynamicDecimationBlock block;
+  while (encoder.pull(block)) block.write(encoded);
+} // raw::codec::encodeDynamicDecimation(encoded)
+
+
+inline void raw::codec::decodeDynamicDecimation
+  (short const* data, std::size_t size, std::vector<short>& adc)
+{
+  adc.clear();
+  DynamicDecimationDecoder decoder;
+  DynamicDecimationBlock block;
+  std::size_t pos = 0U;
+  while (pos < size) {
+    pos += block.read(data + pos, size - pos, decoder.nDecoded());
+    decoder.decode(block, adc);
+  }
+} // raw::codec::decodeDynamicDecimation(encoded)
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWDYNAMICDECIMATIONCODEC_H
@@ -0,0 +1,274 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/RawHuffmanCodec.h
+ * @brief  Huffman encoding of ADC waveforms (`raw::kHuffman`).
+ * @date   October 18, 2026
+ * @see    larcoreobj/SimpleTypesAndConstants/RawTypes.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWHUFFMANCODEC_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWHUFFMANCODEC_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawBitStream.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <vector>
+#include <stdexcept> // std::runtime_error
+#include <cstdint> // std::uint32_t, std::uint16_t
+#include <cstddef> // std::size_t
+
+
+namespace raw {
+
+  namespace codec {
+
+    /**
+     * @brief Encoding of ADC waveforms for `raw::kHuffman` compression.
+     *
+     * Each sample is coded by its difference from the previous one (the one
+     * before the first sample is taken to be `0`). The differences between
+     * `-3` and `+3` have a prefix code, whose length grows with their
+     * magnitude:
+     *
+     * | difference | code (first bit on the left) |
+     * | ---------: | ---------------------------- |
+     * |        `0` | `1`                          |
+     * |       `-1` | `01`                         |
+     * |       `+1` | `001`                        |
+     * |       `-2` | `0001`                       |
+     * |       `+2` | `00001`                      |
+     * |       `-3` | `000001`                     |
+     * |       `+3` | `0000001`                    |
+     *
+     * Any other sample is written in full (16 bits) after an escape code of
+     * seven `0` bits. The stream starts with the number of samples (4 bytes,
+     * little endian), followed by the codes, written with
+     * `raw::codec::BitWriter`.
+     *
+     * The decoder looks up `LookupBits` bits at a time in a table, which
+     * returns all the complete codes in them (up to `MaxSymbolsPerLookup`)
+     * with the bits they span: a run of baseline samples, which mostly
+     * differ by at most one count, is decoded several samples per lookup.
+     * The samples of a lookup are all written unconditionally, without
+     * branches on their number.
+     */
+    struct Huffman {
+
+      /// Number of bits looked up in the decoding table at once.
+      static constexpr unsigned int LookupBits = 11U;
+
+      /// Maximum number of samples decoded with a single table lookup.
+      static constexpr unsigned int MaxSymbolsPerLookup = 8U;
+
+      /// Length of the escape code preceding a full sample.
+      static constexpr unsigned int EscapeBits = 7U;
+
+      /// Number of bits of a full sample.
+      static constexpr unsigned int SampleBits = 16U;
+
+      /// Largest difference between samples with its own code.
+      static constexpr int MaxDelta = 3;
+
+      /// Returns the length of the code for `delta` (within `MaxDelta`).
+      static constexpr unsigned int codeLength(int delta)
+        {
+          return (delta == 0)? 1U
+            : (delta < 0)? unsigned(-2 * delta): unsigned(2 * delta + 1);
+        }
+
+      /// Returns the difference coded by the code of length `length`.
+      static constexpr int codeDelta(unsigned int length)
+        { return (length % 2U)? int(length / 2U): -int(length / 2U); }
+
+      /**
+       * @brief Entry of the decoding table.
+       *
+       * Bits 0-3 are the number of samples decoded, 4-7 the number of bits
+       * they use, and from bit 8 on each group of three bits stores the
+       * difference of a sample, plus `MaxDelta`.
+       */
+      using LookupEntry_t = std::uint32_t;
+
+      /// Type of the decoding table.
+      using LookupTable_t = std::array<LookupEntry_t, (1U << LookupBits)>;
+
+      /// Returns the decoding table.
+      static LookupTable_t const& lookupTable()
+        { static LookupTable_t const table = makeLookupTable(); return table; }
+
+      /// Builds the decoding table.
+      static constexpr LookupTable_t makeLookupTable();
+
+    }; // struct Huffman
+
+
+    /// @{
+    /// @name Huffman encoding (`raw::kHuffman`)
+
+    /**
+     * @brief Appends the Huffman encoding of a waveform to a buffer.
+     * @param adc pointer to the first sample
+     * @param nSamples number of samples
+     * @param[out] buffer the buffer to append the encoded waveform to
+     * @see `raw::codec::Huffman` for the format
+     */
+    void encodeHuffman
+      (short const* adc, std::size_t nSamples, ByteBuffer_t& buffer);
+
+    /// Returns the Huffman encoding of the waveform `adc`.
+    ByteBuffer_t encodeHuffman(std::vector<short> const& adc);
+
+    /**
+     * @brief Decodes a Huffman encoded waveform.
+     * @param data pointer to the encoded waveform
+     * @param size size of the encoded waveform [bytes]
+     * @param[out] adc the decoded samples (previous content is replaced)
+     * @throw std::runtime_error if the data is truncated or malformed
+     */
+    void decodeHuffman
+      (Byte_t const* data, std::size_t size, std::vector<short>& adc);
+
+    /// Returns the samples of the Huffman encoded waveform `data`.
+    /// @throw std::runtime_error if the data is truncated or malformed
+    std::vector<short> decodeHuffman(ByteBuffer_t const& data);
+
+    /// @}
+
+  } // namespace codec
+
+} // namespace raw
+
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+constexpr auto raw::codec::Huffman::makeLookupTable() -> LookupTable_t {
+
+  LookupTable_t table {};
+  for (std::size_t bits = 0U; bits < table.size(); ++bits) {
+    unsigned int nSymbols = 0U;
+    unsigned int used = 0U; // bits used by the complete codes so far
+    LookupEntry_t deltas = 0U;
+    unsigned int pos = 0U;
+    while ((nSymbols < MaxSymbolsPerLookup) && (pos < LookupBits)) {
+      // a code is a run of zeroes terminated by a one
+      if (((bits >> pos) & 1U) == 0U) {
+        if (++pos - used == EscapeBits) break; // escape code: not decoded
+        continue;
+      }
+      unsigned int const length = ++pos - used;
+      deltas |= LookupEntry_t(codeDelta(length) + MaxDelta) << (3U * nSymbols);
+      ++nSymbols;
+      used = pos;
+    } // while
+    table[bits] = nSymbols | (used << 4U) | (deltas << 8U);
+  } // for
+  return table;
+
+} // raw::codec::Huffman::makeLookupTable()
+
+
+//------------------------------------------------------------------------------
+inline void raw::codec::encodeHuffman
+  (short const* adc, std::size_t nSamples, ByteBuffer_t& buffer)
+{
+  writeUInt32(buffer, static_cast<std::uint32_t>(nSamples));
+  buffer.reserve(buffer.size() + nSamples / 4U + 8U);
+
+  BitWriter writer { buffer };
+  int prev = 0;
+  for (std::size_t i = 0; i < nSamples; ++i) {
+    int const sample = adc[i];
+    int const delta = sample - prev;
+    prev = sample;
+    if ((delta >= -Huffman::MaxDelta) && (delta <= Huffman::MaxDelta)) {
+      unsigned int const length = Huffman::codeLength(delta);
+      writer.write(std::uint64_t(1) << (length - 1U), length);
+    }
+    else {
+      std::uint64_t const full = static_cast<std::uint16_t>(sample);
+      writer.write(full << Huffman::EscapeBits,
+        Huffman::EscapeBits + Huffman::SampleBits);
+    }
+  } // for
+  writer.flush();
+
+} // raw::codec::encodeHuffman()
+
+
+inline auto raw::codec::encodeHuffman(std::vector<short> const& adc)
+  -> ByteBuffer_t
+{
+  ByteBuffer_t buffer;
+  encodeHuffman(adc.data(), adc.size(), buffer);
+  return buffer;
+} // raw::codec::encodeHuffman()
+
+
+//------------------------------------------------------------------------------
+inline void raw::codec::decodeHuffman
+  (Byte_t const* data, std::size_t size, std::vector<short>& adc)
+{
+  constexpr std::size_t HeaderSize = 4U;
+  constexpr unsigned int N = Huffman::MaxSymbolsPerLookup;
+
+  if (size < HeaderSize)
+    throw std::runtime_error("raw::codec::decodeHuffman(): truncated header");
+  std::size_t const nSamples = readUInt32(data);
+  if (nSamples > (size - HeaderSize) * 8U) { // at least one bit per sample
+    throw std::runtime_error
+      ("raw::codec::decodeHuffman(): sample count exceeds the data size");
+  }
+
+  Huffman::LookupTable_t const& table = Huffman::lookupTable();
+  BitReader reader { data + HeaderSize, size - HeaderSize };
+
+  adc.resize(nSamples + N); // room for the samples of a full lookup
+  short* out = adc.data();
+  short const* const outEnd = out + nSamples;
+  int prev = 0;
+  while (out < outEnd) {
+    std::uint64_t const bits = reader.peek();
+    Huffman::LookupEntry_t const entry
+      = table[bits & BitWriter::lowMask(Huffman::LookupBits)];
+    unsigned int const nSymbols = entry & 0xFU;
+    if (nSymbols == 0U) { // escape code: full sample
+      prev = static_cast<short>(static_cast<std::uint16_t>
+        (bits >> Huffman::EscapeBits));
+      *out++ = static_cast<short>(prev);
+      reader.skip(Huffman::EscapeBits + Huffman::SampleBits);
+      continue;
+    }
+    // write all the slots, only `nSymbols` of them are kept
+    Huffman::LookupEntry_t deltas = entry >> 8U;
+    for (unsigned int i = 0; i < N; ++i) {
+      prev += int(deltas & 7U) - Huffman::MaxDelta;
+      deltas >>= 3U;
+      out[i] = static_cast<short>(prev);
+    }
+    out += nSymbols;
+    prev = out[-1];
+    reader.skip((entry >> 4U) & 0xFU);
+  } // while
+  adc.resize(nSamples);
+
+  if (reader.overrun())
+    throw std::runtime_error("raw::codec::decodeHuffman(): truncated data");
+
+} // raw::codec::decodeHuffman()
+
+
+inline std::vector<short> raw::codec::decodeHuffman(ByteBuffer_t const& data) {
+  std::vector<short> adc;
+  decodeHuffman(data.data(), data.size(), adc);
+  return adc;
+} // raw::codec::decodeHuffman()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWHUFFMANCODEC_H
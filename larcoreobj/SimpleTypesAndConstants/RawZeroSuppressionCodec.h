@@ -0,0 +1,480 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/RawZeroSuppressionCodec.h
+ * @brief  Zero suppression of ADC waveforms (`raw::kZeroSuppression`).
+ * @date   October 18, 2026
+ * @see    larcoreobj/SimpleTypesAndConstants/RawTypes.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWZEROSUPPRESSIONCODEC_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWZEROSUPPRESSIONCODEC_H
+
+// C/C++ standard libraries
+#include <vector>
+#include <algorithm> // std::fill(), std::copy(), std::min()
+#include <iterator> // std::input_iterator_tag
+#include <utility> // std::pair
+#include <stdexcept> // std::runtime_error, std::length_error
+#include <cstring> // std::memcpy()
+#include <cstdint> // std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <cstddef> // std::size_t, std::ptrdiff_t
+
+
+namespace raw {
+
+  namespace codec {
+
+    /**
+     * @brief Region of interest of a zero-suppressed waveform.
+     *
+     * The samples are not copied: `data` points into the encoded waveform,
+     * which must outlive the region.
+     */
+    struct ROI {
+      std::size_t begin = 0U; ///< Tick of the first sample.
+      std::size_t size = 0U; ///< Number of samples.
+      short const* data = nullptr; ///< Pointer to the first sample.
+
+      /// Returns the tick after the last sample.
+      std::size_t end() const { return begin + size; }
+
+      /// Returns the sample at `tick` (must be within the region).
+      short operator[] (std::size_t tick) const { return data[tick - begin]; }
+
+    }; // struct ROI
+
+
+    /**
+     * @brief Zero suppression of ADC waveforms (`raw::kZeroSuppression`).
+     *
+     * A sample is above threshold when its distance from the pedestal is
+     * larger than `threshold`. Each sample above threshold is kept together
+     * with `preSamples` samples before it and `postSamples` after it; the
+     * kept samples form regions of interest (ROI), and regions which touch
+     * or overlap are merged.
+     *
+     * The encoded waveform is a sequence of `short` words: the number of
+     * ticks (two words), the pedestal, the number of regions (two words),
+     * then for each region its first tick and its size (two words each),
+     * and finally the samples of all the regions. The 32-bit values are
+     * stored low word first. Since the samples are stored verbatim, the
+     * regions can be read in place (`raw::codec::ZeroSuppressedWaveform`).
+     *
+     * The search for samples above threshold is done in two passes: one
+     * without branches marking each sample (which the compiler vectorizes),
+     * and one scanning the marks eight at a time, so that the long stretches
+     * of baseline are skipped quickly.
+     *
+     * An encoder object keeps its working memory between waveforms, so that
+     * encoding a batch of channels allocates only for the output.
+     */
+    class ZeroSuppressionEncoder {
+
+        public:
+      /// Configuration of the zero suppression.
+      struct Config_t {
+        short threshold = 5; ///< Minimum distance from pedestal to keep.
+        std::size_t preSamples = 5U; ///< Samples kept before threshold.
+        std::size_t postSamples = 5U; ///< Samples kept after threshold.
+      }; // struct Config_t
+
+      /// Constructor: uses the specified configuration.
+      explicit ZeroSuppressionEncoder(Config_t const& config)
+        : fConfig(config) {}
+
+      /// Returns the configuration of the encoder.
+      Config_t const& config() const { return fConfig; }
+
+      /**
+       * @brief Appends the zero-suppressed waveform to a buffer.
+       * @param adc pointer to the first sample
+       * @param nTicks number of samples
+       * @param pedestal the pedestal of the waveform
+       * @param[out] encoded the buffer to append the encoded waveform to
+       * @throw std::length_error if the waveform has 2^32 ticks or more
+       */
+      void encode(
+        short const* adc, std::size_t nTicks, short pedestal,
+        std::vector<short>& encoded
+        );
+
+      /// Returns the zero-suppressed waveform.
+      std::vector<short> encode(std::vector<short> const& adc, short pedestal)
+        {
+          std::vector<short> encoded;
+          encode(adc.data(), adc.size(), pedestal, encoded);
+          return encoded;
+        }
+
+      /**
+       * @brief Returns the zero-suppressed waveforms of a batch of channels.
+       * @param channels the waveforms of the channels
+       * @param pedestals the pedestal of each channel
+       * @throw std::length_error if the two lists have different sizes
+       */
+      std::vector<std::vector<short>> encode(
+        std::vector<std::vector<short>> const& channels,
+        std::vector<short> const& pedestals
+        );
+
+      /// Returns the regions to be kept of the last encoded waveform.
+      std::vector<std::pair<std::size_t, std::size_t>> const& lastRegions()
+        const
+        { return fRegions; }
+
+        private:
+      Config_t fConfig; ///< Configuration.
+
+      std::vector<std::uint8_t> fAbove; ///< Whether each tick is above.
+      /// Regions to be kept, as first and past-the-last tick.
+      std::vector<std::pair<std::size_t, std::size_t>> fRegions;
+
+      /// Fills `fRegions` with the regions of `adc` to be kept.
+      void findRegions(short const* adc, std::size_t nTicks, short pedestal);
+
+    }; // class ZeroSuppressionEncoder
+
+
+    /**
+     * @brief View of a zero-suppressed waveform, with access to its regions.
+     * @see `raw::codec::ZeroSuppressionEncoder` for the format
+     *
+     * The view does not copy the data, which must outlive it. The regions
+     * are iterated in tick order:
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+     * raw::codec::ZeroSuppressedWaveform const waveform { encoded };
+     * for (raw::codec::ROI const& roi: waveform)
+     *   process(roi.begin, roi.data, roi.size);
+     * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+     */
+    class ZeroSuppressedWaveform {
+
+        public:
+      class const_iterator;
+
+      /**
+       * @brief Constructor: view of the encoded waveform at `data`.
+       * @param data pointer to the encoded waveform
+       * @param size number of words available at `data`
+       * @throw std::runtime_error if the data is truncated or malformed
+       */
+      ZeroSuppressedWaveform(short const* data, std::size_t size);
+
+      /// Constructor: view of the encoded waveform `encoded`.
+      explicit ZeroSuppressedWaveform(std::vector<short> const& encoded)
+        : ZeroSuppressedWaveform(encoded.data(), encoded.size()) {}
+
+      /// Returns the number of ticks of the full waveform.
+      std::size_t nTicks() const { return fNTicks; }
+
+      /// Returns the pedestal of the waveform.
+      short pedestal() const { return fPedestal; }
+
+      /// Returns the number of regions of interest.
+      std::size_t nROIs() const { return fNROIs; }
+
+      /// Returns the number of words of the encoded waveform.
+      std::size_t encodedSize() const { return fEncodedSize; }
+
+      /// Returns the number of samples in the regions of interest.
+      std::size_t nSamples() const
+        { return fEncodedSize - HeaderSize - RegionHeaderSize * fNROIs; }
+
+      const_iterator begin() const;
+      const_iterator end() const;
+
+      /// Writes the full waveform into `adc` (pedestal outside the regions).
+      void decode(std::vector<short>& adc) const;
+
+      /// Returns the full waveform (pedestal outside the regions).
+      std::vector<short> decode() const
+        { std::vector<short> adc; decode(adc); return adc; }
+
+      /// Number of words of the waveform header.
+      static constexpr std::size_t HeaderSize = 5U;
+
+      /// Number of words of the header of each region.
+      static constexpr std::size_t RegionHeaderSize = 4U;
+
+        private:
+      short const* fData; ///< Start of the encoded waveform.
+      std::size_t fNTicks; ///< Number of ticks of the full waveform.
+      short fPedestal; ///< Pedestal of the waveform.
+      std::size_t fNROIs; ///< Number of regions of interest.
+      std::size_t fEncodedSize; ///< Number of words of the encoded waveform.
+
+    }; // class ZeroSuppressedWaveform
+
+
+    /// Iterator to the regions of interest of a zero-suppressed waveform.
+    class ZeroSuppressedWaveform::const_iterator {
+
+        public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = ROI;
+      using difference_type = std::ptrdiff_t;
+      using reference = ROI const&;
+      using pointer = ROI const*;
+
+      const_iterator() = default;
+
+      /// Constructor: points to the region with header at `header`.
+      const_iterator(short const* header, short const* samples)
+        : fHeader(header), fSamples(samples) {}
+
+      reference operator* () const { update(); return fROI; }
+      pointer operator-> () const { update(); return &fROI; }
+
+      const_iterator& operator++ ()
+        {
+          update();
+          fHeader += RegionHeaderSize;
+          fSamples += fROI.size;
+          return *this;
+        }
+      const_iterator operator++ (int)
+        { const_iterator old = *this; ++*this; return old; }
+
+      bool operator== (const_iterator const& other) const
+        { return fHeader == other.fHeader; }
+      bool operator!= (const_iterator const& other) const
+        { return fHeader != other.fHeader; }
+
+        private:
+      short const* fHeader = nullptr; ///< Header of the current region.
+      short const* fSamples = nullptr; ///< First sample of current region.
+      mutable ROI fROI; ///< Current region, filled on demand.
+
+      /// Fills the current region from its header.
+      void update() const;
+
+    }; // class ZeroSuppressedWaveform::const_iterator
+
+
+    /// @{
+    /// @name Zero suppression (`raw::kZeroSuppression`)
+
+    /// Returns the full waveform of the zero-suppressed `encoded`.
+    /// @throw std::runtime_error if the data is truncated or malformed
+    std::vector<short> decodeZeroSuppression(std::vector<short> const& encoded);
+
+    /// @}
+
+
+    namespace details {
+
+      /// Writes the 32-bit `value` as two words, low first.
+      inline void writeWords32(short* words, std::size_t value)
+        {
+          words[0] = static_cast<short>(static_cast<std::uint16_t>(value));
+          words[1]
+            = static_cast<short>(static_cast<std::uint16_t>(value >> 16U));
+        }
+
+      /// Returns the 32-bit value stored in two words, low first.
+      inline std::size_t readWords32(short const* words)
+        {
+          return std::size_t(static_cast<std::uint16_t>(words[0]))
+            | (std::size_t(static_cast<std::uint16_t>(words[1])) << 16U);
+        }
+
+    } // namespace details
+
+  } // namespace codec
+
+} // namespace raw
+
+
+//------------------------------------------------------------------------------
+//--- inline implementation
+//------------------------------------------------------------------------------
+//--- raw::codec::ZeroSuppressionEncoder
+//---
+inline void raw::codec::ZeroSuppressionEncoder::findRegions
+  (short const* adc, std::size_t nTicks, short pedestal)
+{
+  fRegions.clear();
+
+  // mark all the samples above threshold, without branches;
+  // the marks are padded to a multiple of 8 for the scan below
+  std::size_t const nWords = (nTicks + 7U) / 8U;
+  fAbove.assign(nWords * 8U, 0U);
+  int const ped = pedestal;
+  int const threshold = fConfig.threshold;
+  std::uint8_t* above = fAbove.data();
+  for (std::size_t tick = 0; tick < nTicks; ++tick) {
+    int const dist = adc[tick] - ped;
+    above[tick] = ((dist > threshold) | (dist < -threshold));
+  } // for
+
+  // scan the marks, 8 at a time, for runs of samples above threshold
+  auto const word = [above](std::size_t iWord)
+    { std::uint64_t w; std::memcpy(&w, above + 8U * iWord, 8U); return w; };
+  std::size_t tick = 0;
+  while (true) {
+    // skip ticks below threshold, a whole word at a time when possible
+    while ((tick < nTicks) && (above[tick] == 0U)) {
+      if (((tick % 8U) == 0U) && (word(tick / 8U) == 0U)) tick += 8U;
+      else ++tick;
+    }
+    if (tick >= nTicks) break;
+
+    // find the end of this run above threshold
+    std::size_t const first = tick;
+    while ((tick < nTicks) && (above[tick] != 0U)) ++tick;
+
+    // extend and merge with the previous region if they touch
+    std::size_t const begin
+      = (first > fConfig.preSamples)? first - fConfig.preSamples: 0U;
+    std::size_t const end = std::min(tick + fConfig.postSamples, nTicks);
+    if (!fRegions.empty() && (begin <= fRegions.back().second))
+      fRegions.back().second = end;
+    else fRegions.emplace_back(begin, end);
+  } // while
+
+} // raw::codec::ZeroSuppressionEncoder::findRegions()
+
+
+inline void raw::codec::ZeroSuppressionEncoder::encode(
+  short const* adc, std::size_t nTicks, short pedestal,
+  std::vector<short>& encoded
+) {
+  if (nTicks > 0xFFFFFFFFU) {
+    throw std::length_error
+      ("raw::codec::ZeroSuppressionEncoder: waveform too long");
+  }
+
+  findRegions(adc, nTicks, pedestal);
+
+  std::size_t nSamples = 0U;
+  for (auto const& [ begin, end ]: fRegions) nSamples += end - begin;
+
+  using Waveform_t = ZeroSuppressedWaveform;
+  std::size_t const start = encoded.size();
+  encoded.resize(start + Waveform_t::HeaderSize
+    + Waveform_t::RegionHeaderSize * fRegions.size() + nSamples);
+
+  short* out = encoded.data() + start;
+  details::writeWords32(out, nTicks);
+  out[2] = pedestal;
+  details::writeWords32(out + 3U, fRegions.size());
+  out += Waveform_t::HeaderSize;
+  for (auto const& [ begin, end ]: fRegions) {
+    details::writeWords32(out, begin);
+    details::writeWords32(out + 2U, end - begin);
+    out += Waveform_t::RegionHeaderSize;
+  }
+  for (auto const& [ begin, end ]: fRegions)
+    out = std::copy(adc + begin, adc + end, out);
+
+} // raw::codec::ZeroSuppressionEncoder::encode()
+
+
+inline std::vector<std::vector<short>>
+raw::codec::ZeroSuppressionEncoder::encode(
+  std::vector<std::vector<short>> const& channels,
+  std::vector<short> const& pedestals
+) {
+  if (channels.size() != pedestals.size()) {
+    throw std::length_error("raw::codec::ZeroSuppressionEncoder: "
+      "different number of channels and pedestals");
+  }
+  std::vector<std::vector<short>> encoded(channels.size());
+  for (std::size_t i = 0; i < channels.size(); ++i) {
+    encode
+      (channels[i].data(), channels[i].size(), pedestals[i], encoded[i]);
+  }
+  return encoded;
+} // raw::codec::ZeroSuppressionEncoder::encode(batch)
+
+
+//------------------------------------------------------------------------------
+//--- raw::codec::ZeroSuppressedWaveform
+//---
+inline raw::codec::ZeroSuppressedWaveform::ZeroSuppressedWaveform
+  (short const* data, std::size_t size)
+  : fData(data)
+{
+  if (size < HeaderSize) {
+    throw std::runtime_error
+      ("raw::codec::ZeroSuppressedWaveform: truncated header");
+  }
+  fNTicks = details::readWords32(data);
+  fPedestal = data[2];
+  fNROIs = details::readWords32(data + 3U);
+  if (fNROIs > (size - HeaderSize) / RegionHeaderSize) {
+    throw std::runtime_error
+      ("raw::codec::ZeroSuppressedWaveform: truncated region headers");
+  }
+
+  // check that the regions are sorted, within the waveform and in the data
+  fEncodedSize = HeaderSize + RegionHeaderSize * fNROIs;
+  std::size_t lastEnd = 0U;
+  short const* header = data + HeaderSize;
+  for (std::size_t i = 0; i < fNROIs; ++i, header += RegionHeaderSize) {
+    std::size_t const begin = details::readWords32(header);
+    std::size_t const roiSize = details::readWords32(header + 2U);
+    if ((begin < lastEnd) || (begin > fNTicks) || (roiSize > fNTicks - begin))
+    {
+      throw std::runtime_error
+        ("raw::codec::ZeroSuppressedWaveform: invalid region of interest");
+    }
+    lastEnd = begin + roiSize;
+    fEncodedSize += roiSize;
+  } // for
+  if (fEncodedSize > size) {
+    throw std::runtime_error
+      ("raw::codec::ZeroSuppressedWaveform: truncated samples");
+  }
+} // raw::codec::ZeroSuppressedWaveform::ZeroSuppressedWaveform()
+
+
+inline auto raw::codec::ZeroSuppressedWaveform::begin() const
+  -> const_iterator
+{
+  short const* const headers = fData + HeaderSize;
+  return { headers, headers + RegionHeaderSize * fNROIs };
+}
+
+
+inline auto raw::codec::ZeroSuppressedWaveform::end() const
+  -> const_iterator
+{
+  return { fData + HeaderSize + RegionHeaderSize * fNROIs, nullptr };
+}
+
+
+inline void raw::codec::ZeroSuppressedWaveform::decode
+  (std::vector<short>& adc) const
+{
+  adc.resize(fNTicks);
+  std::size_t tick = 0U;
+  for (ROI const& roi: *this) {
+    std::fill(adc.begin() + tick, adc.begin() + roi.begin, fPedestal);
+    std::copy(roi.data, roi.data + roi.size, adc.begin() + roi.begin);
+    tick = roi.end();
+  }
+  std::fill(adc.begin() + tick, adc.end(), fPedestal);
+} // raw::codec::ZeroSuppressedWaveform::decode()
+
+
+//------------------------------------------------------------------------------
+inline void raw::codec::ZeroSuppressedWaveform::const_iterator::update() const
+{
+  fROI.begin = details::readWords32(fHeader);
+  fROI.size = details::readWords32(fHeader + 2U);
+  fROI.data = fSamples;
+} // raw::codec::ZeroSuppressedWaveform::const_iterator::update()
+
+
+//------------------------------------------------------------------------------
+inline std::vector<short> raw::codec::decodeZeroSuppression
+  (std::vector<short> const& encoded)
+  { return ZeroSuppressedWaveform{ encoded }.decode(); }
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_RAWZEROSUPPRESSIONCODEC_H
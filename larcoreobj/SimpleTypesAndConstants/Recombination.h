@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  larcoreobj/SimpleTypesAndConstants/Recombination.h
+/// \brief Recombination models for ionization electrons in liquid argon
+///
+/// The models use the coefficients from `PhysicalConstants.h`.
+/// This library is header-only and depends only on standard C++.
+///
+////////////////////////////////////////////////////////////////////////
+#ifndef UTIL_RECOMBINATION_H
+#define UTIL_RECOMBINATION_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <cmath> // std::log()
+#include <cstring> // std::memcpy()
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  namespace details {
+
+    /**
+     * @brief Natural logarithm of `x`, in a form the compiler can vectorize.
+     * @tparam T either `float` or `double`
+     * @param x a finite, positive, normal number
+     * @return an approximation of `std::log(x)`
+     *
+     * The result is within 3 ulp of the exact logarithm (relative error
+     * below 4e-16 in double and 2.2e-7 in single precision). Zero, negative,
+     * subnormal and non-finite arguments give meaningless results.
+     *
+     * `x` is split as @f$ 2^{k} m @f$ with @f$ \sqrt{1/2} \leq m < \sqrt{2} @f$
+     * using integer operations only, and @f$ \ln m = 2\,\mathrm{atanh}(s) @f$,
+     * @f$ s = (m - 1)/(m + 1) @f$, is summed as a series in @f$ s^{2} @f$
+     * truncated below the precision of `T`.
+     */
+    template <typename T>
+    T approxLog(T x);
+
+  } // namespace details
+
+
+  /**
+   * @{
+   * @name Recombination factors
+   *
+   * The recombination factor @f$ R @f$ is the fraction of ionization
+   * electrons that survive recombination. All the functions take:
+   * * `dEdx`: the stopping power @f$ dE/dx @f$, in MeV/cm
+   * * `EField`: the electric field @f$ E @f$, in kV/cm
+   * * `density`: the density of the liquid argon @f$ \rho @f$, in g/cm&sup3;
+   *
+   * Both `dEdx` and `EField` are expected to be positive.
+   *
+   * The batched versions compute `n` factors at once from arrays, writing
+   * them into `recomb`. They are simple loops which the compiler vectorizes
+   * in optimized builds (GCC 12: `-O3`; at `-O2` they stay scalar). Since
+   * `std::log()` does not vectorize without special compiler and library
+   * support, the batched modified box model uses
+   * `util::details::approxLog()` instead, whose result is within 3 ulp of
+   * the exact logarithm: the batched factors may then differ from the
+   * single ones by a few units in the last place.
+   * The output array may be the same as one of the input arrays.
+   */
+
+  /// Birks model: @f$ R = A / (1 + k (dE/dx) / (E \rho)) @f$.
+  /// @see `kRecombA`, `kRecombk`
+  template <typename T>
+  constexpr T BirksRecombination(T dEdx, T EField, T density)
+    {
+      return static_cast<T>(kRecombA)
+        / (T(1) + dEdx * static_cast<T>(kRecombk) / (EField * density));
+    }
+
+  /// Modified box model: @f$ R = \ln(\alpha + \xi) / \xi @f$,
+  /// with @f$ \xi = \beta (dE/dx) / (E \rho) @f$.
+  /// @see `kModBoxA`, `kModBoxB`
+  template <typename T>
+  T ModBoxRecombination(T dEdx, T EField, T density)
+    {
+      T const xi = static_cast<T>(kModBoxB) * dEdx / (EField * density);
+      return std::log(static_cast<T>(kModBoxA) + xi) / xi;
+    }
+
+  /// Birks model on `n` values (see `BirksRecombination(T, T, T)`).
+  template <typename T>
+  void BirksRecombination(
+    std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+    );
+
+  /// Modified box model on `n` values (see `ModBoxRecombination(T, T, T)`);
+  /// uses `details::approxLog()`.
+  template <typename T>
+  void ModBoxRecombination(
+    std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+    );
+
+  /// @}
+
+
+  /**
+   * @{
+   * @name Ionization electrons
+   *
+   * The number of ionization electrons surviving recombination from an energy
+   * deposition `energy` (in GeV) with recombination factor `recomb` is
+   * @f$ E \cdot R \cdot @f$ `kGeVToElectrons`.
+   */
+
+  /// Returns the electrons surviving from an `energy` deposition (GeV).
+  template <typename T>
+  constexpr T IonizationElectrons(T energy, T recomb)
+    { return energy * static_cast<T>(kGeVToElectrons) * recomb; }
+
+  /// Computes the electrons from `n` energy depositions (GeV).
+  template <typename T>
+  void IonizationElectrons
+    (std::size_t n, T const* energy, T const* recomb, T* electrons);
+
+  /// @}
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+namespace util::details {
+
+  /// Floating point layout and series length used by `approxLog()`.
+  template <typename T>
+  struct ApproxLogTraits;
+
+  template <>
+  struct ApproxLogTraits<double> {
+    using Bits_t = std::uint64_t;
+    static constexpr unsigned int MantissaBits = 52U;
+    static constexpr Bits_t One = 0x3FF0000000000000ULL; // 1.0
+    static constexpr Bits_t SqrtHalf = 0x3FE6A09E667F3BCDULL; // sqrt(1/2)
+    static constexpr int NTerms = 10; // s^2 < 0.0295: 0.0295^10/21 < 1e-17
+  }; // ApproxLogTraits<double>
+
+  template <>
+  struct ApproxLogTraits<float> {
+    using Bits_t = std::uint32_t;
+    static constexpr unsigned int MantissaBits = 23U;
+    static constexpr Bits_t One = 0x3F800000U; // 1.0f
+    static constexpr Bits_t SqrtHalf = 0x3F3504F3U; // sqrt(1/2)
+    static constexpr int NTerms = 5; // 0.0295^5/11 < 3e-9
+  }; // ApproxLogTraits<float>
+
+  /// Returns @f$ \sum_{i=I}^{N-1} s^{2(i-I)}/(2i+1) @f$, fully unrolled.
+  template <typename T, int I, int N>
+  constexpr T atanhSeries(T s2)
+    {
+      if constexpr (I == N - 1) return T(1) / T(2 * I + 1);
+      else return T(1) / T(2 * I + 1) + s2 * atanhSeries<T, I + 1, N>(s2);
+    }
+
+} // namespace util::details
+
+
+template <typename T>
+T util::details::approxLog(T x) {
+  using Traits_t = ApproxLogTraits<T>;
+  using Bits_t = typename Traits_t::Bits_t;
+  constexpr unsigned int MBits = Traits_t::MantissaBits;
+  constexpr Bits_t MantissaMask = (Bits_t(1) << MBits) - 1U;
+
+  Bits_t bits;
+  std::memcpy(&bits, &x, sizeof(T));
+
+  // offset the exponent so that the mantissa lands in [ sqrt(1/2), sqrt(2) )
+  Bits_t const shifted = bits + (Traits_t::One - Traits_t::SqrtHalf);
+  Bits_t const mBits = (shifted & MantissaMask) + Traits_t::SqrtHalf;
+  // the biased exponent, as the mantissa of 2^MBits: no integer conversion
+  Bits_t const eBits = (Traits_t::One + (Bits_t(MBits) << MBits))
+    | (shifted >> MBits);
+  T m, e;
+  std::memcpy(&m, &mBits, sizeof(T));
+  std::memcpy(&e, &eBits, sizeof(T));
+  e -= T(Bits_t(1) << MBits) + T(Traits_t::One >> MBits);
+
+  T const s = (m - T(1)) / (m + T(1));
+  // unrolled by construction: GCC does not unroll ten terms at -O2
+  T const series = atanhSeries<T, 0, Traits_t::NTerms>(s * s);
+
+  // ln(2), split so that e * Ln2Hi is exact in double precision
+  constexpr T Ln2Hi = T(6.93147180369123816490e-01);
+  constexpr T Ln2Lo = T(1.90821492927058770002e-10);
+  return e * Ln2Hi + (T(2) * s * series + e * Ln2Lo);
+} // util::details::approxLog()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void util::BirksRecombination(
+  std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+) {
+  for (std::size_t i = 0; i < n; ++i)
+    recomb[i] = BirksRecombination(dEdx[i], EField[i], density);
+} // util::BirksRecombination()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void util::ModBoxRecombination(
+  std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+) {
+  T const alpha = static_cast<T>(kModBoxA);
+  T const beta = static_cast<T>(kModBoxB);
+  for (std::size_t i = 0; i < n; ++i) {
+    T const xi = beta * dEdx[i] / (EField[i] * density);
+    recomb[i] = details::approxLog(alpha + xi) / xi;
+  }
+} // util::ModBoxRecombination()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void util::IonizationElectrons
+  (std::size_t n, T const* energy, T const* recomb, T* electrons)
+{
+  for (std::size_t i = 0; i < n; ++i)
+    electrons[i] = IonizationElectrons(energy[i], recomb[i]);
+} // util::IonizationElectrons()
+
+
+//------------------------------------------------------------------------------
+
+#endif // UTIL_RECOMBINATION_H
@@ -0,0 +1,459 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  larcoreobj/SimpleTypesAndConstants/RecombinationTable.h
+/// \brief Tabulated modified box recombination factor
+///
+/// The tables replace the logarithm of `util::ModBoxRecombination()` with
+/// a table lookup and a linear interpolation.
+/// This library is header-only and depends only on standard C++.
+///
+////////////////////////////////////////////////////////////////////////
+#ifndef UTIL_RECOMBINATIONTABLE_H
+#define UTIL_RECOMBINATIONTABLE_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/Recombination.h"
+#include "larcoreobj/SimpleTypesAndConstants/PhysicalConstants.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <stdexcept> // std::domain_error
+#include <string>
+#include <limits>
+#include <cstring> // std::memcpy()
+#include <cmath> // std::log()
+#include <cstdint> // std::uint64_t, std::int64_t
+#include <cstddef> // std::size_t
+
+
+namespace util {
+
+  namespace details {
+
+    /// Natural logarithm usable in constant expressions (`x` must be positive).
+    constexpr double constexprLog(double x);
+
+    /// Modified box recombination factor as function of @f$ \xi @f$.
+    constexpr double ModBoxOfXi(double xi)
+      { return constexprLog(kModBoxA + xi) / xi; }
+
+    /**
+     * @brief Sampling of a positive range with `Bits` samples per octave.
+     *
+     * The samples are at @f$ 2^e (1 + j / 2^{B}) @f$, with @f$ B @f$ the
+     * number of bits and @f$ 0 \leq j < 2^{B} @f$, so they are denser where
+     * the values are smaller.
+     * The bin of a value is identified by a key made of the exponent and the
+     * top `Bits` bits of the mantissa of its `double` representation; at run
+     * time, the key is obtained from the bits with a single shift.
+     * Only positive normal values are supported.
+     */
+    struct OctaveSampling {
+
+      using Key_t = std::uint64_t;
+
+      static constexpr unsigned int MantissaBits = 52U;
+      static constexpr int ExponentBias = 1023;
+
+      unsigned int bits = 0U; ///< Samples per octave are `2^bits`.
+      Key_t keyMin = 0U; ///< Key of the first bin.
+      std::size_t nSamples = 0U; ///< Number of samples (bins plus one).
+      /// Fraction of a bin per unit of the mantissa bits below the key.
+      double bitFraction = 1.0;
+
+      constexpr OctaveSampling() = default;
+
+      /// Sampling covering the range from `xMin` to `xMax`.
+      constexpr OctaveSampling(unsigned int bits, double xMin, double xMax)
+        : bits(bits), keyMin(key(xMin, bits))
+        , nSamples(key(xMax, bits) - keyMin + 2U)
+        , bitFraction(pow2(int(bits) - int(MantissaBits)))
+        {}
+
+      /// Returns the position of the sample `i`.
+      constexpr double node(std::size_t i) const
+        { return nodeOfKey(keyMin + i, bits); }
+
+      /// Returns the key of `x` (computed arithmetically).
+      static constexpr Key_t key(double x, unsigned int bits);
+
+      /// Returns the position of the sample starting the bin with `key`.
+      static constexpr double nodeOfKey(Key_t key, unsigned int bits);
+
+      /// Returns `2^e`.
+      static constexpr double pow2(int e);
+
+    }; // struct OctaveSampling
+
+
+    /// Linear interpolation of `values` with `sampling` (constant expression).
+    template <typename T>
+    constexpr double interpolateAt
+      (OctaveSampling const& sampling, T const* values, double x);
+
+    /// Linear interpolation of `values` with `sampling` (from the bits of `x`).
+    template <typename T>
+    T lookupAt(OctaveSampling const& sampling, T const* values, double x);
+
+    /// Largest relative error of the interpolation at the middle of the bins.
+    template <typename T>
+    constexpr double maxModBoxInterpolationError
+      (OctaveSampling const& sampling, T const* values);
+
+  } // namespace details
+
+
+  /// Returns the @f$ \xi @f$ parameter of the modified box model.
+  /// @see `util::ModBoxRecombination()`
+  template <typename T>
+  constexpr T ModBoxXi(T dEdx, T EField, T density)
+    { return static_cast<T>(kModBoxB) * dEdx / (EField * density); }
+
+
+  /**
+   * @brief Tabulated modified box recombination factor.
+   * @tparam T type of the recombination factor
+   *
+   * The modified box recombination factor depends on @f$ dE/dx @f$, electric
+   * field and density only through @f$ \xi @f$ (see `util::ModBoxXi()`),
+   * so a single table serves any combination of them.
+   * The table samples @f$ R(\xi) @f$ with a fixed number of samples per
+   * octave of @f$ \xi @f$, and interpolates linearly between the samples.
+   * The bin of a value is found from the bits of its representation, so no
+   * logarithm is needed. The number of samples is chosen at construction so
+   * that the relative interpolation error stays below the requested bound
+   * (the error is checked at the middle of each bin, where linear
+   * interpolation is least precise).
+   * Outside the range the exact formula is used.
+   *
+   * The factor vanishes at @f$ \xi = 1 - \alpha @f$ (`1 - kModBoxA`), where
+   * no relative error bound can be met: the range should start well above
+   * that value (physical values of @f$ \xi @f$ are typically above 0.2).
+   *
+   * Example for a fixed density and a field between 0.4 and 0.6 kV/cm:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * util::ModBoxRecombinationTable<double> const table {
+   *   util::ModBoxXi(1.0, 0.6, 1.39), util::ModBoxXi(100.0, 0.4, 1.39),
+   *   1e-6
+   *   };
+   * double const R = table(dEdx, EField, 1.39);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename T = double>
+  class ModBoxRecombinationTable {
+
+      public:
+    /// Largest number of samples per octave (as a power of 2).
+    static constexpr unsigned int MaxBits = 20U;
+
+    /**
+     * @brief Builds the table.
+     * @param xiMin lower bound of the tabulated @f$ \xi @f$ range
+     * @param xiMax upper bound of the tabulated @f$ \xi @f$ range
+     * @param maxRelError largest relative interpolation error allowed
+     * @throw std::domain_error if the range is empty or not positive, or the
+     *        error bound can't be met within `2^MaxBits` samples per octave
+     */
+    ModBoxRecombinationTable(double xiMin, double xiMax, double maxRelError);
+
+    /// Returns the recombination factor for the specified @f$ \xi @f$.
+    T atXi(T xi) const;
+
+    /// Returns the recombination factor (see `util::ModBoxRecombination()`).
+    T operator() (T dEdx, T EField, T density) const
+      { return atXi(ModBoxXi(dEdx, EField, density)); }
+
+    /// Computes the recombination factors of `n` values.
+    void operator() (
+      std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+      ) const;
+
+    /// Returns the number of samples in the table.
+    std::size_t size() const { return fValues.size(); }
+
+    /// Returns the lower bound of the tabulated range.
+    double xiMin() const { return fXiMin; }
+
+    /// Returns the upper bound of the tabulated range.
+    double xiMax() const { return fXiMax; }
+
+    /// Returns the largest relative error found while building the table.
+    double maxRelError() const { return fMaxRelError; }
+
+      private:
+    double fXiMin; ///< Lower bound of the tabulated range.
+    double fXiMax; ///< Upper bound of the tabulated range.
+    details::OctaveSampling fSampling; ///< Position of the samples.
+    double fMaxRelError = 0.0; ///< Largest relative error found.
+    std::vector<T> fValues; ///< Sampled values.
+
+  }; // class ModBoxRecombinationTable
+
+
+  /**
+   * @brief Modified box recombination factor table built at compile time.
+   * @tparam N largest number of samples in the table
+   * @tparam T type of the recombination factor
+   *
+   * This table behaves like `util::ModBoxRecombinationTable`, but instead
+   * of an error bound it takes the largest number of samples, and it picks
+   * the densest sampling that fits. It can be built as a constant expression:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * constexpr util::FixedModBoxRecombinationTable<1024> table { 0.2, 20.0 };
+   * static_assert(table.maxRelError() < 1e-4);
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   * Unlike `util::ModBoxRecombinationTable`, the range is not checked; it
+   * must be positive and not empty, and it must span no more octaves than
+   * there are samples.
+   */
+  template <std::size_t N, typename T = double>
+  class FixedModBoxRecombinationTable {
+    static_assert(N >= 2U, "A table needs at least two samples.");
+
+      public:
+    /// Builds the table in the range of @f$ \xi @f$ from `xiMin` to `xiMax`.
+    constexpr FixedModBoxRecombinationTable(double xiMin, double xiMax);
+
+    /// Returns the recombination factor for the specified @f$ \xi @f$.
+    T atXi(T xi) const;
+
+    /// Returns the recombination factor (see `util::ModBoxRecombination()`).
+    T operator() (T dEdx, T EField, T density) const
+      { return atXi(ModBoxXi(dEdx, EField, density)); }
+
+    /// Computes the recombination factors of `n` values.
+    void operator() (
+      std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+      ) const;
+
+    /// Returns the number of samples in use.
+    constexpr std::size_t size() const { return fSampling.nSamples; }
+
+    /// Returns the lower bound of the tabulated range.
+    constexpr double xiMin() const { return fXiMin; }
+
+    /// Returns the upper bound of the tabulated range.
+    constexpr double xiMax() const { return fXiMax; }
+
+    /// Returns the largest relative interpolation error (at bin middles).
+    constexpr double maxRelError() const { return fMaxRelError; }
+
+      private:
+    double fXiMin; ///< Lower bound of the tabulated range.
+    double fXiMax; ///< Upper bound of the tabulated range.
+    details::OctaveSampling fSampling; ///< Position of the samples.
+    double fMaxRelError = 0.0; ///< Largest relative error found.
+    std::array<T, N> fValues {}; ///< Sampled values.
+
+    /// Returns the densest sampling of the range fitting `N` samples.
+    static constexpr details::OctaveSampling makeSampling
+      (double xiMin, double xiMax);
+
+  }; // class FixedModBoxRecombinationTable
+
+} // namespace util
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+constexpr double util::details::constexprLog(double x) {
+  // range reduction: x = m * 2^e with m in [ 1/sqrt(2), sqrt(2) ]
+  constexpr double ln2 = 0.693147180559945309417232121458176568;
+  constexpr double sqrt2 = 1.41421356237309504880168872420969808;
+  int e = 0;
+  while (x > sqrt2) { x /= 2.0; ++e; }
+  while (x < sqrt2 / 2.0) { x *= 2.0; --e; }
+  // ln(m) = 2 atanh(u), u = (m - 1)/(m + 1), |u| < 0.172
+  double const u = (x - 1.0) / (x + 1.0);
+  double const u2 = u * u;
+  double term = u;
+  double sum = 0.0;
+  for (int k = 1; k < 60; k += 2) {
+    double const next = sum + term / k;
+    if (next == sum) break;
+    sum = next;
+    term *= u2;
+  }
+  return 2.0 * sum + e * ln2;
+} // util::details::constexprLog()
+
+
+//------------------------------------------------------------------------------
+constexpr double util::details::OctaveSampling::pow2(int e) {
+  double p = 1.0;
+  for (; e > 0; --e) p *= 2.0;
+  for (; e < 0; ++e) p /= 2.0;
+  return p;
+} // util::details::OctaveSampling::pow2()
+
+
+constexpr auto util::details::OctaveSampling::key
+  (double x, unsigned int bits) -> Key_t
+{
+  int e = 0;
+  while (x >= 2.0) { x /= 2.0; ++e; }
+  while (x < 1.0) { x *= 2.0; --e; }
+  // x is now the mantissa in [ 1, 2 ); scaling by a power of 2 is exact
+  Key_t const j = static_cast<Key_t>((x - 1.0) * pow2(bits));
+  return (static_cast<Key_t>(e + ExponentBias) << bits) | j;
+} // util::details::OctaveSampling::key()
+
+
+constexpr double util::details::OctaveSampling::nodeOfKey
+  (Key_t key, unsigned int bits)
+{
+  int const e = static_cast<int>(key >> bits) - ExponentBias;
+  Key_t const j = key & ((Key_t(1) << bits) - 1U);
+  return (1.0 + static_cast<double>(j) / pow2(bits)) * pow2(e);
+} // util::details::OctaveSampling::nodeOfKey()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+constexpr double util::details::interpolateAt
+  (OctaveSampling const& sampling, T const* values, double x)
+{
+  std::size_t const i = OctaveSampling::key(x, sampling.bits) - sampling.keyMin;
+  double const x0 = sampling.node(i), x1 = sampling.node(i + 1U);
+  double const f = (x - x0) / (x1 - x0);
+  return values[i] + f * (values[i + 1U] - values[i]);
+} // util::details::interpolateAt()
+
+
+template <typename T>
+T util::details::lookupAt
+  (OctaveSampling const& sampling, T const* values, double x)
+{
+  static_assert(std::numeric_limits<double>::is_iec559,
+    "Table lookup requires IEEE 754 double precision numbers.");
+  using Key_t = OctaveSampling::Key_t;
+  Key_t xbits;
+  std::memcpy(&xbits, &x, sizeof(xbits));
+  unsigned int const shift = OctaveSampling::MantissaBits - sampling.bits;
+  std::size_t const i = (xbits >> shift) - sampling.keyMin;
+  // position in the bin, from the mantissa bits below the key (they fit a
+  // signed integer, which converts faster than an unsigned one; the scaling
+  // by a power of 2 is exact)
+  auto const below
+    = static_cast<std::int64_t>(xbits & ((Key_t(1) << shift) - 1U));
+  double const f = static_cast<double>(below) * sampling.bitFraction;
+  return values[i] + static_cast<T>(f) * (values[i + 1U] - values[i]);
+} // util::details::lookupAt()
+
+
+template <typename T>
+constexpr double util::details::maxModBoxInterpolationError
+  (OctaveSampling const& sampling, T const* values)
+{
+  double maxError = 0.0;
+  for (std::size_t i = 0; i + 1U < sampling.nSamples; ++i) {
+    double const x = (sampling.node(i) + sampling.node(i + 1U)) / 2.0;
+    double const exact = ModBoxOfXi(x);
+    double const relError = interpolateAt(sampling, values, x) / exact - 1.0;
+    if (relError > maxError) maxError = relError;
+    else if (-relError > maxError) maxError = -relError;
+  }
+  return maxError;
+} // util::details::maxModBoxInterpolationError()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+util::ModBoxRecombinationTable<T>::ModBoxRecombinationTable
+  (double xiMin, double xiMax, double maxRelError)
+  : fXiMin(xiMin), fXiMax(xiMax)
+{
+  if (!(xiMin >= std::numeric_limits<double>::min()) || !(xiMax > xiMin)
+    || !(xiMax <= std::numeric_limits<double>::max()))
+  {
+    throw std::domain_error("ModBoxRecombinationTable: invalid range ["
+      + std::to_string(xiMin) + "; " + std::to_string(xiMax) + "]");
+  }
+
+  for (unsigned int bits = 0U; bits <= MaxBits; ++bits) {
+    fSampling = details::OctaveSampling{ bits, fXiMin, fXiMax };
+    fValues.resize(fSampling.nSamples);
+    for (std::size_t i = 0; i < fValues.size(); ++i) {
+      double const xi = fSampling.node(i);
+      fValues[i] = static_cast<T>(std::log(kModBoxA + xi) / xi);
+    }
+    fMaxRelError
+      = details::maxModBoxInterpolationError(fSampling, fValues.data());
+    if (fMaxRelError <= maxRelError) return;
+  } // for
+
+  throw std::domain_error("ModBoxRecombinationTable: relative error "
+    + std::to_string(maxRelError) + " not reached with 2^"
+    + std::to_string(MaxBits) + " samples per octave");
+
+} // util::ModBoxRecombinationTable<>::ModBoxRecombinationTable()
+
+
+template <typename T>
+T util::ModBoxRecombinationTable<T>::atXi(T xi) const {
+  if (!(xi >= fXiMin) || !(xi <= fXiMax)) // out of range: use the formula
+    return std::log(static_cast<T>(kModBoxA) + xi) / xi;
+  return details::lookupAt(fSampling, fValues.data(), xi);
+} // util::ModBoxRecombinationTable<>::atXi()
+
+
+template <typename T>
+void util::ModBoxRecombinationTable<T>::operator() (
+  std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+) const {
+  for (std::size_t i = 0; i < n; ++i)
+    recomb[i] = (*this)(dEdx[i], EField[i], density);
+} // util::ModBoxRecombinationTable<>::operator()
+
+
+//------------------------------------------------------------------------------
+template <std::size_t N, typename T>
+constexpr util::FixedModBoxRecombinationTable<N, T>
+  ::FixedModBoxRecombinationTable(double xiMin, double xiMax)
+  : fXiMin(xiMin), fXiMax(xiMax), fSampling(makeSampling(xiMin, xiMax))
+{
+  for (std::size_t i = 0; i < fSampling.nSamples; ++i)
+    fValues[i] = static_cast<T>(details::ModBoxOfXi(fSampling.node(i)));
+  fMaxRelError
+    = details::maxModBoxInterpolationError(fSampling, fValues.data());
+} // util::FixedModBoxRecombinationTable<>::FixedModBoxRecombinationTable()
+
+
+template <std::size_t N, typename T>
+constexpr util::details::OctaveSampling
+util::FixedModBoxRecombinationTable<N, T>::makeSampling
+  (double xiMin, double xiMax)
+{
+  details::OctaveSampling sampling { 0U, xiMin, xiMax };
+  for (unsigned int bits = 1U; bits <= details::OctaveSampling::MantissaBits;
+    ++bits
+  ) {
+    details::OctaveSampling const denser { bits, xiMin, xiMax };
+    if (denser.nSamples > N) break;
+    sampling = denser;
+  }
+  return sampling;
+} // util::FixedModBoxRecombinationTable<>::makeSampling()
+
+
+template <std::size_t N, typename T>
+T util::FixedModBoxRecombinationTable<N, T>::atXi(T xi) const {
+  if (!(xi >= fXiMin) || !(xi <= fXiMax)) // out of range: use the formula
+    return std::log(static_cast<T>(kModBoxA) + xi) / xi;
+  return details::lookupAt(fSampling, fValues.data(), xi);
+} // util::FixedModBoxRecombinationTable<>::atXi()
+
+
+template <std::size_t N, typename T>
+void util::FixedModBoxRecombinationTable<N, T>::operator() (
+  std::size_t n, T const* dEdx, T const* EField, T density, T* recomb
+) const {
+  for (std::size_t i = 0; i < n; ++i)
+    recomb[i] = (*this)(dEdx[i], EField[i], density);
+} // util::FixedModBoxRecombinationTable<>::operator()
+
+
+//------------------------------------------------------------------------------
+
+#endif // UTIL_RECOMBINATIONTABLE_H
@@ -12,5 +12,7 @@
 
 
 #include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vector_arrays.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_compact_id.h"
 
 #include <vector>
@@ -0,0 +1,467 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_compact_id.h
+ * @brief  Geometry and readout IDs without a separate validity flag.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_types.h
+ *         larcoreobj/SimpleTypesAndConstants/readout_types.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_COMPACT_ID_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_COMPACT_ID_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// C/C++ standard libraries
+#include <ostream>
+
+
+/**
+ * @addtogroup Geometry
+ *
+ * Compact IDs
+ * ------------
+ *
+ * The IDs in `geo_types.h` and `readout_types.h` carry a `bool isValid` flag
+ * next to the cryostat index, which makes each of them 4 bytes larger (e.g.
+ * `sizeof(geo::WireID)` is 20 bytes). The compact IDs (`geo::CompactWireID`
+ * etc.) hold the same indices, but they encode the validity in the cryostat
+ * index instead: a compact ID is invalid if and only if its cryostat index is
+ * `geo::CryostatID::InvalidID`. A `geo::CompactWireID` takes 16 bytes.
+ *
+ * Compact IDs are meant for storage and for large collections; they convert
+ * explicitly to and from the regular IDs (`toID()`, `geo::compactID()`).
+ * When an invalid ID is made compact, its cryostat index is lost (the other
+ * indices are preserved); a valid ID with the invalid cryostat index becomes
+ * invalid.
+ *
+ * Compact IDs are stored as their own classes: data stored with the regular
+ * IDs must be read as such, and converted explicitly.
+ */
+/// @{
+namespace geo {
+
+  /// Compact version of `geo::CryostatID`; invalid if the cryostat is invalid.
+  struct CompactCryostatID {
+
+    using ID_t = CryostatID; ///< Type of the regular ID.
+    using CryostatID_t = CryostatID::CryostatID_t; ///< Type of the index.
+
+    /// Index of cryostat; `CryostatID::InvalidID` for an invalid ID.
+    CryostatID_t Cryostat = CryostatID::InvalidID;
+
+    /// Default constructor: an invalid cryostat ID.
+    constexpr CompactCryostatID() = default;
+
+    /// Constructor: cryostat with index `c`.
+    explicit constexpr CompactCryostatID(CryostatID_t c): Cryostat(c) {}
+
+    /// Constructor: compact version of `id`.
+    explicit constexpr CompactCryostatID(CryostatID const& id)
+      : Cryostat(id.isValid? id.Cryostat: CryostatID::InvalidID) {}
+
+    /// Returns whether the ID is valid.
+    constexpr bool isValid() const { return Cryostat != CryostatID::InvalidID; }
+
+    /// Returns true if the ID is valid.
+    explicit constexpr operator bool() const { return isValid(); }
+
+    /// Returns true if the ID is not valid.
+    constexpr bool operator! () const { return !isValid(); }
+
+    /// Sets the ID as invalid (the cryostat index is lost).
+    void markInvalid() { Cryostat = CryostatID::InvalidID; }
+
+    /// Returns the regular version of this ID.
+    constexpr CryostatID toID() const { return { Cryostat, isValid() }; }
+
+    /// Conversion to the regular ID.
+    explicit constexpr operator CryostatID() const { return toID(); }
+
+  }; // struct CompactCryostatID
+
+
+  /// Compact version of `geo::OpDetID`.
+  struct CompactOpDetID: public CompactCryostatID {
+
+    using ID_t = OpDetID; ///< Type of the regular ID.
+    using OpDetID_t = OpDetID::OpDetID_t; ///< Type of the index.
+
+    /// Index of the optical detector within its cryostat.
+    OpDetID_t OpDet = OpDetID::InvalidID;
+
+    /// Default constructor: an invalid optical detector ID.
+    constexpr CompactOpDetID() = default;
+
+    /// Constructor: optical detector `o` in the cryostat index `c`.
+    constexpr CompactOpDetID(CryostatID_t c, OpDetID_t o)
+      : CompactCryostatID(c), OpDet(o) {}
+
+    /// Constructor: compact version of `id`.
+    explicit constexpr CompactOpDetID(OpDetID const& id)
+      : CompactCryostatID(id), OpDet(id.OpDet) {}
+
+    /// Returns the regular version of this ID.
+    constexpr OpDetID toID() const
+      { return { CompactCryostatID::toID(), OpDet }; }
+
+    /// Conversion to the regular ID.
+    explicit constexpr operator OpDetID() const { return toID(); }
+
+  }; // struct CompactOpDetID
+
+
+  /// Compact version of `geo::TPCID`.
+  struct CompactTPCID: public CompactCryostatID {
+
+    using ID_t = TPCID; ///< Type of the regular ID.
+    using TPCID_t = TPCID::TPCID_t; ///< Type of the index.
+
+    /// Index of the TPC within its cryostat.
+    TPCID_t TPC = TPCID::InvalidID;
+
+    /// Default constructor: an invalid TPC ID.
+    constexpr CompactTPCID() = default;
+
+    /// Constructor: TPC `t` in the cryostat index `c`.
+    constexpr CompactTPCID(CryostatID_t c, TPCID_t t)
+      : CompactCryostatID(c), TPC(t) {}
+
+    /// Constructor: compact version of `id`.
+    explicit constexpr CompactTPCID(TPCID const& id)
+      : CompactCryostatID(id), TPC(id.TPC) {}
+
+    /// Returns the regular version of this ID.
+    constexpr TPCID toID() const { return { CompactCryostatID::toID(), TPC }; }
+
+    /// Conversion to the regular ID.
+    explicit constexpr operator TPCID() const { return toID(); }
+
+  }; // struct CompactTPCID
+
+
+  /// Compact version of `geo::PlaneID`.
+  struct CompactPlaneID: public CompactTPCID {
+
+    using ID_t = PlaneID; ///< Type of the regular ID.
+    using PlaneID_t = PlaneID::PlaneID_t; ///< Type of the index.
+
+    /// Index of the plane within its TPC.
+    PlaneID_t Plane = PlaneID::InvalidID;
+
+    /// Default constructor: an invalid plane ID.
+    constexpr CompactPlaneID() = default;
+
+    /// Constructor: plane `p` in TPC `t` in the cryostat index `c`.
+    constexpr CompactPlaneID(CryostatID_t c, TPCID_t t, PlaneID_t p)
+      : CompactTPCID(c, t), Plane(p) {}
+
+    /// Constructor: compact version of `id`.
+    explicit constexpr CompactPlaneID(PlaneID const& id)
+      : CompactTPCID(id), Plane(id.Plane) {}
+
+    /// Returns the regular version of this ID.
+    constexpr PlaneID toID() const { return { CompactTPCID::toID(), Plane }; }
+
+    /// Conversion to the regular ID.
+    explicit constexpr operator PlaneID() const { return toID(); }
+
+  }; // struct CompactPlaneID
+
+
+  /// Compact version of `geo::WireID`.
+  struct CompactWireID: public CompactPlaneID {
+
+    using ID_t = WireID; ///< Type of the regular ID.
+    using WireID_t = WireID::WireID_t; ///< Type of the index.
+
+    /// Index of the wire within its plane.
+    WireID_t Wire = WireID::InvalidID;
+
+    /// Default constructor: an invalid wire ID.
+    constexpr CompactWireID() = default;
+
+    /// Constructor: wire `w` in plane `p` in TPC `t` in the cryostat index `c`.
+    constexpr CompactWireID(CryostatID_t c, TPCID_t t, PlaneID_t p, WireID_t w)
+      : CompactPlaneID(c, t, p), Wire(w) {}
+
+    /// Constructor: compact version of `id`.
+    explicit constexpr CompactWireID(WireID const& id)
+      : CompactPlaneID(id), Wire(id.Wire) {}
+
+    /// Returns the regular version of this ID.
+    constexpr WireID toID() const { return { CompactPlaneID::toID(), Wire }; }
+
+    /// Conversion to the regular ID.
+    explicit constexpr operator WireID() const { return toID(); }
+
+  }; // struct CompactWireID
+
+} // namespace geo
+
+
+namespace readout {
+
+  using CompactCryostatID = geo::CompactCryostatID;
+
+  /// Compact version of `readout::TPCsetID`.
+  struct CompactTPCsetID: public CompactCryostatID {
+
+    using ID_t = TPCsetID; ///< Type of the regular ID.
+    using TPCsetID_t = TPCsetID::TPCsetID_t; ///< Type of the index.
+
+    /// Index of the TPC set within its cryostat.
+    TPCsetID_t TPCset = TPCsetID::InvalidID;
+
+    /// Default constructor: an invalid TPC set ID.
+    constexpr CompactTPCsetID() = default;
+
+    /// Constructor: TPC set `s` in the cryostat index `c`.
+    constexpr CompactTPCsetID(CryostatID_t c, TPCsetID_t s)
+      : CompactCryostatID(c), TPCset(s) {}
+
+    /// Constructor: compact version of `id`.
+    explicit constexpr CompactTPCsetID(TPCsetID const& id)
+      : CompactCryostatID(id), TPCset(id.TPCset) {}
+
+    /// Returns the regular version of this ID.
+    constexpr TPCsetID toID() const
+      { return { CompactCryostatID::toID(), TPCset }; }
+
+    /// Conversion to the regular ID.
+    explicit constexpr operator TPCsetID() const { return toID(); }
+
+  }; // struct CompactTPCsetID
+
+
+  /// Compact version of `readout::ROPID`.
+  struct CompactROPID: public CompactTPCsetID {
+
+    using ID_t = ROPID; ///< Type of the regular ID.
+    using ROPID_t = ROPID::ROPID_t; ///< Type of the index.
+
+    /// Index of the readout plane within its TPC set.
+    ROPID_t ROP = ROPID::InvalidID;
+
+    /// Default constructor: an invalid readout plane ID.
+    constexpr CompactROPID() = default;
+
+    /// Constructor: readout plane `r` in TPC set `s` in the cryostat index `c`.
+    constexpr CompactROPID(CryostatID_t c, TPCsetID_t s, ROPID_t r)
+      : CompactTPCsetID(c, s), ROP(r) {}
+
+    /// Constructor: compact version of `id`.
+    explicit constexpr CompactROPID(ROPID const& id)
+      : CompactTPCsetID(id), ROP(id.ROP) {}
+
+    /// Returns the regular version of this ID.
+    constexpr ROPID toID() const
+      { return { CompactTPCsetID::toID(), ROP }; }
+
+    /// Conversion to the regular ID.
+    explicit constexpr operator ROPID() const { return toID(); }
+
+  }; // struct CompactROPID
+
+} // namespace readout
+
+
+namespace geo {
+
+  //----------------------------------------------------------------------------
+  /// @{
+  /// @name Conversion to compact IDs
+
+  inline constexpr CompactCryostatID compactID(CryostatID const& id)
+    { return CompactCryostatID{ id }; }
+  inline constexpr CompactOpDetID compactID(OpDetID const& id)
+    { return CompactOpDetID{ id }; }
+  inline constexpr CompactTPCID compactID(TPCID const& id)
+    { return CompactTPCID{ id }; }
+  inline constexpr CompactPlaneID compactID(PlaneID const& id)
+    { return CompactPlaneID{ id }; }
+  inline constexpr CompactWireID compactID(WireID const& id)
+    { return CompactWireID{ id }; }
+
+  /// @}
+
+
+  //----------------------------------------------------------------------------
+  /// @{
+  /// @name Compact ID comparison operators
+  /// @details Compact IDs compare index by index, as their regular
+  ///          counterparts do, without converting them. All invalid IDs have
+  ///          the same cryostat index, `CryostatID::InvalidID`, which is the
+  ///          largest: they sort after all the valid ones.
+
+  inline constexpr bool operator==
+    (CompactCryostatID const& a, CompactCryostatID const& b)
+    { return a.Cryostat == b.Cryostat; }
+  inline constexpr bool operator!=
+    (CompactCryostatID const& a, CompactCryostatID const& b)
+    { return !(a == b); }
+  inline constexpr bool operator<
+    (CompactCryostatID const& a, CompactCryostatID const& b)
+    { return a.Cryostat < b.Cryostat; }
+
+  inline constexpr bool operator==
+    (CompactOpDetID const& a, CompactOpDetID const& b)
+    { return (a.OpDet == b.OpDet) && (a.Cryostat == b.Cryostat); }
+  inline constexpr bool operator!=
+    (CompactOpDetID const& a, CompactOpDetID const& b)
+    { return !(a == b); }
+  inline constexpr bool operator<
+    (CompactOpDetID const& a, CompactOpDetID const& b)
+    {
+      if (a.Cryostat != b.Cryostat) return a.Cryostat < b.Cryostat;
+      return a.OpDet < b.OpDet;
+    }
+
+  inline constexpr bool operator==
+    (CompactTPCID const& a, CompactTPCID const& b)
+    { return (a.TPC == b.TPC) && (a.Cryostat == b.Cryostat); }
+  inline constexpr bool operator!=
+    (CompactTPCID const& a, CompactTPCID const& b)
+    { return !(a == b); }
+  inline constexpr bool operator<
+    (CompactTPCID const& a, CompactTPCID const& b)
+    {
+      if (a.Cryostat != b.Cryostat) return a.Cryostat < b.Cryostat;
+      return a.TPC < b.TPC;
+    }
+
+  inline constexpr bool operator==
+    (CompactPlaneID const& a, CompactPlaneID const& b)
+    {
+      return (a.Plane == b.Plane) && (a.TPC == b.TPC)
+        && (a.Cryostat == b.Cryostat);
+    }
+  inline constexpr bool operator!=
+    (CompactPlaneID const& a, CompactPlaneID const& b)
+    { return !(a == b); }
+  inline constexpr bool operator<
+    (CompactPlaneID const& a, CompactPlaneID const& b)
+    {
+      if (a.Cryostat != b.Cryostat) return a.Cryostat < b.Cryostat;
+      if (a.TPC != b.TPC) return a.TPC < b.TPC;
+      return a.Plane < b.Plane;
+    }
+
+  inline constexpr bool operator==
+    (CompactWireID const& a, CompactWireID const& b)
+    {
+      return (a.Wire == b.Wire) && (a.Plane == b.Plane)
+        && (a.TPC == b.TPC) && (a.Cryostat == b.Cryostat);
+    }
+  inline constexpr bool operator!=
+    (CompactWireID const& a, CompactWireID const& b)
+    { return !(a == b); }
+  inline constexpr bool operator<
+    (CompactWireID const& a, CompactWireID const& b)
+    {
+      if (a.Cryostat != b.Cryostat) return a.Cryostat < b.Cryostat;
+      if (a.TPC != b.TPC) return a.TPC < b.TPC;
+      if (a.Plane != b.Plane) return a.Plane < b.Plane;
+      return a.Wire < b.Wire;
+    }
+
+  /// @}
+
+
+  //----------------------------------------------------------------------------
+  /// @{
+  /// @name Output of compact IDs (same as the regular ones)
+
+  inline std::ostream& operator<<
+    (std::ostream& out, CompactCryostatID const& id)
+    { return out << id.toID(); }
+  inline std::ostream& operator<< (std::ostream& out, CompactOpDetID const& id)
+    { return out << id.toID(); }
+  inline std::ostream& operator<< (std::ostream& out, CompactTPCID const& id)
+    { return out << id.toID(); }
+  inline std::ostream& operator<< (std::ostream& out, CompactPlaneID const& id)
+    { return out << id.toID(); }
+  inline std::ostream& operator<< (std::ostream& out, CompactWireID const& id)
+    { return out << id.toID(); }
+
+  /// @}
+
+} // namespace geo
+
+
+namespace readout {
+
+  //----------------------------------------------------------------------------
+  /// @{
+  /// @name Conversion to compact IDs
+
+  using geo::compactID;
+
+  inline constexpr CompactTPCsetID compactID(TPCsetID const& id)
+    { return CompactTPCsetID{ id }; }
+  inline constexpr CompactROPID compactID(ROPID const& id)
+    { return CompactROPID{ id }; }
+
+  /// @}
+
+
+  //----------------------------------------------------------------------------
+  /// @{
+  /// @name Compact ID comparison operators
+
+  inline constexpr bool operator==
+    (CompactTPCsetID const& a, CompactTPCsetID const& b)
+    { return (a.TPCset == b.TPCset) && (a.Cryostat == b.Cryostat); }
+  inline constexpr bool operator!=
+    (CompactTPCsetID const& a, CompactTPCsetID const& b)
+    { return !(a == b); }
+  inline constexpr bool operator<
+    (CompactTPCsetID const& a, CompactTPCsetID const& b)
+    {
+      if (a.Cryostat != b.Cryostat) return a.Cryostat < b.Cryostat;
+      return a.TPCset < b.TPCset;
+    }
+
+  inline constexpr bool operator==
+    (CompactROPID const& a, CompactROPID const& b)
+    {
+      return (a.ROP == b.ROP) && (a.TPCset == b.TPCset)
+        && (a.Cryostat == b.Cryostat);
+    }
+  inline constexpr bool operator!=
+    (CompactROPID const& a, CompactROPID const& b)
+    { return !(a == b); }
+  inline constexpr bool operator<
+    (CompactROPID const& a, CompactROPID const& b)
+    {
+      if (a.Cryostat != b.Cryostat) return a.Cryostat < b.Cryostat;
+      if (a.TPCset != b.TPCset) return a.TPCset < b.TPCset;
+      return a.ROP < b.ROP;
+    }
+
+  /// @}
+
+
+  //----------------------------------------------------------------------------
+  /// @{
+  /// @name Output of compact IDs (same as the regular ones)
+
+  inline std::ostream& operator<< (std::ostream& out, CompactTPCsetID const& id)
+    { return out << id.toID(); }
+  inline std::ostream& operator<< (std::ostream& out, CompactROPID const& id)
+    { return out << id.toID(); }
+
+  /// @}
+
+} // namespace readout
+/// @}
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_COMPACT_ID_H
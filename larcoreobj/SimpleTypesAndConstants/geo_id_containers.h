@@ -0,0 +1,395 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_id_containers.h
+ * @brief  Containers with one element per geometry or readout element.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_CONTAINERS_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_CONTAINERS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <utility> // std::index_sequence, std::forward()
+#include <type_traits> // std::decay_t
+#include <stdexcept> // std::out_of_range
+#include <cstddef> // std::size_t
+
+
+namespace geo {
+
+  /**
+   * @brief Mapping between IDs and a dense linear index.
+   * @tparam IDType type of the ID being mapped (e.g. `geo::PlaneID`)
+   *
+   * The mapper describes a detector where each level of the ID hierarchy has
+   * a fixed number of elements (e.g. 2 cryostats, each with 4 TPCs, each with
+   * 3 planes). It assigns to each ID a linear index between 0 and `size()`,
+   * following the same order as `IDType::cmp()`: the deepest index runs
+   * fastest.
+   *
+   * The mapper does not check the validity of the IDs it is given.
+   */
+  template <typename IDType>
+  class GeoIDmapper {
+
+      public:
+    using ID_t = IDType; ///< Type of the ID being mapped.
+    using index_type = std::size_t; ///< Type of the linear index.
+
+    /// Number of levels in the ID (and number of extents).
+    static constexpr std::size_t dimensions() { return ID_t::Level + 1U; }
+
+    /// Type of the list of extents, one per ID level.
+    using Extents_t = std::array<index_type, dimensions()>;
+
+
+    /// Default constructor: all extents are 0 (no elements).
+    GeoIDmapper() = default;
+
+    /// Constructor: uses the specified number of elements per level.
+    explicit GeoIDmapper(Extents_t const& extents): fExtents(extents) {}
+
+
+    /// Returns the number of elements covered by the mapping.
+    index_type size() const;
+
+    /// Returns whether the mapping covers no element.
+    bool empty() const { return size() == 0U; }
+
+    /// Returns the number of elements at the level `Level`.
+    template <std::size_t Level>
+    index_type extent() const { return std::get<Level>(fExtents); }
+
+    /// Returns all the extents.
+    Extents_t const& extents() const { return fExtents; }
+
+    /// Returns the linear index of `id` (`id` must be covered).
+    index_type index(ID_t const& id) const
+      { return indexImpl(id, std::make_index_sequence<dimensions()>()); }
+
+    /// Returns the (valid) ID with the specified linear index.
+    /// @note The mapping must not be `empty()`.
+    ID_t ID(index_type index) const;
+
+    /// Returns whether `id` is covered by this mapping.
+    ///
+    /// Only the indices of `id` are checked against the extents: the validity
+    /// flag is ignored, and an ID marked invalid but with indices within the
+    /// extents is covered. A default-constructed ID has invalid indices and
+    /// is not covered.
+    bool hasElement(ID_t const& id) const
+      { return hasElementImpl(id, std::make_index_sequence<dimensions()>()); }
+
+    /// Returns the ID of the first element in the mapping.
+    /// @return the first ID, or an invalid ID if the mapping is `empty()`
+    ID_t firstID() const { return empty()? ID_t{}: ID(0U); }
+
+    /// Returns the ID of the last element in the mapping.
+    /// @return the last ID, or an invalid ID if the mapping is `empty()`
+    ID_t lastID() const { return empty()? ID_t{}: ID(size() - 1U); }
+
+    /// Changes the extents of the mapping.
+    void resize(Extents_t const& extents) { fExtents = extents; }
+
+
+      private:
+    Extents_t fExtents {}; ///< Number of elements at each level.
+
+    template <std::size_t... Levels>
+    index_type indexImpl(ID_t const& id, std::index_sequence<Levels...>) const
+      {
+        index_type index = 0U;
+        ((index = index * std::get<Levels>(fExtents)
+          + static_cast<index_type>(id.template getIndex<Levels>())), ...);
+        return index;
+      }
+
+    template <std::size_t... Levels>
+    bool hasElementImpl(ID_t const& id, std::index_sequence<Levels...>) const
+      {
+        return (... && (static_cast<index_type>(id.template getIndex<Levels>())
+          < std::get<Levels>(fExtents)));
+      }
+
+    template <std::size_t Level>
+    void fillID(ID_t& id, index_type& index) const
+      {
+        using Index_t
+          = std::decay_t<decltype(id.template writeIndex<Level>())>;
+        id.template writeIndex<Level>()
+          = static_cast<Index_t>(index % std::get<Level>(fExtents));
+        index /= std::get<Level>(fExtents);
+      }
+
+    template <std::size_t... Levels>
+    void fillIDImpl
+      (ID_t& id, index_type index, std::index_sequence<Levels...>) const
+      {
+        // deepest level first
+        (fillID<dimensions() - 1U - Levels>(id, index), ...);
+      }
+
+  }; // class GeoIDmapper<>
+
+
+  /**
+   * @brief Container with one element per geometry element of a given level.
+   * @tparam T type of the contained data
+   * @tparam IDType type of the ID used as key (e.g. `geo::PlaneID`)
+   *
+   * The container stores its elements contiguously in memory, one for each
+   * element covered by its `geo::GeoIDmapper`, and it accesses them in
+   * constant time by ID. Iteration follows the order of `IDType::cmp()`.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * // 2 cryostats, 4 TPCs each, 3 planes each
+   * geo::PlaneDataContainer<unsigned int> nHits({ 2U, 4U, 3U }, 0U);
+   * for (recob::Hit const& hit: hits) ++nHits[hit.WireID()];
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename T, typename IDType>
+  class GeoIDdataContainer {
+
+    using Container_t = std::vector<T>;
+
+      public:
+    using Mapper_t = GeoIDmapper<IDType>; ///< Type of ID mapping.
+    using ID_t = typename Mapper_t::ID_t; ///< Type of the key.
+    using Extents_t = typename Mapper_t::Extents_t; ///< Type of extent list.
+
+    using value_type = T;
+    using size_type = typename Container_t::size_type;
+    using reference = typename Container_t::reference;
+    using const_reference = typename Container_t::const_reference;
+    using iterator = typename Container_t::iterator;
+    using const_iterator = typename Container_t::const_iterator;
+
+
+    /// Default constructor: an empty container.
+    GeoIDdataContainer() = default;
+
+    /// Constructor: one default-constructed element per covered ID.
+    explicit GeoIDdataContainer(Extents_t const& extents)
+      : fMapper(extents), fData(fMapper.size())
+      {}
+
+    /// Constructor: one copy of `defValue` per covered ID.
+    GeoIDdataContainer(Extents_t const& extents, T const& defValue)
+      : fMapper(extents), fData(fMapper.size(), defValue)
+      {}
+
+
+    // --- BEGIN -- Element access ---------------------------------------------
+    /// @name Element access
+    /// @{
+
+    /// Returns the element for `id` (undefined behaviour if not covered).
+    reference operator[] (ID_t const& id) { return fData[fMapper.index(id)]; }
+
+    /// Returns the element for `id` (undefined behaviour if not covered).
+    const_reference operator[] (ID_t const& id) const
+      { return fData[fMapper.index(id)]; }
+
+    /// Returns the element for `id`.
+    /// @throw std::out_of_range if `id` is not covered by the container
+    reference at(ID_t const& id) { return fData[checkedIndex(id)]; }
+
+    /// Returns the element for `id`.
+    /// @throw std::out_of_range if `id` is not covered by the container
+    const_reference at(ID_t const& id) const
+      { return fData[checkedIndex(id)]; }
+
+    /// Returns the first element.
+    reference front() { return fData.front(); }
+    /// Returns the first element.
+    const_reference front() const { return fData.front(); }
+
+    /// Returns the last element.
+    reference back() { return fData.back(); }
+    /// Returns the last element.
+    const_reference back() const { return fData.back(); }
+
+    /// Returns a pointer to the contiguous storage of the elements.
+    T* data() { return fData.data(); }
+    /// Returns a pointer to the contiguous storage of the elements.
+    T const* data() const { return fData.data(); }
+
+    /// @}
+    // --- END -- Element access -----------------------------------------------
+
+
+    // --- BEGIN -- Iteration --------------------------------------------------
+    /// @name Iteration (in `ID_t::cmp()` order)
+    /// @{
+
+    iterator begin() { return fData.begin(); }
+    iterator end() { return fData.end(); }
+    const_iterator begin() const { return fData.begin(); }
+    const_iterator end() const { return fData.end(); }
+    const_iterator cbegin() const { return fData.cbegin(); }
+    const_iterator cend() const { return fData.cend(); }
+
+    /// @}
+    // --- END -- Iteration ----------------------------------------------------
+
+
+    // --- BEGIN -- Container information --------------------------------------
+    /// @name Container information
+    /// @{
+
+    /// Returns the number of elements in the container.
+    size_type size() const { return fData.size(); }
+
+    /// Returns whether the container has no elements.
+    bool empty() const { return fData.empty(); }
+
+    /// Returns the number of elements at the level `Level`.
+    template <std::size_t Level>
+    size_type extent() const { return fMapper.template extent<Level>(); }
+
+    /// Returns whether the container has an element for `id` (indices only).
+    /// @see `GeoIDmapper::hasElement()`
+    bool hasElement(ID_t const& id) const { return fMapper.hasElement(id); }
+
+    /// Returns the ID of the element at position `index` in the container.
+    ID_t ID(size_type index) const { return fMapper.ID(index); }
+
+    /// Returns the position of the element with the specified ID.
+    size_type indexOf(ID_t const& id) const { return fMapper.index(id); }
+
+    /// Returns the ID of the first element (invalid if the container is empty).
+    ID_t firstID() const { return fMapper.firstID(); }
+
+    /// Returns the ID of the last element (invalid if the container is empty).
+    ID_t lastID() const { return fMapper.lastID(); }
+
+    /// Returns the mapping between IDs and positions in the container.
+    Mapper_t const& mapper() const { return fMapper; }
+
+    /// @}
+    // --- END -- Container information ----------------------------------------
+
+
+    // --- BEGIN -- Modification -----------------------------------------------
+    /// @name Modification
+    /// @{
+
+    /// Assigns `value` to all the elements.
+    void fill(T const& value) { fData.assign(fData.size(), value); }
+
+    /// Calls `op` on all the elements, in order.
+    template <typename Op>
+    Op apply(Op&& op)
+      { for (auto& value: fData) op(value); return std::forward<Op>(op); }
+
+    /// Calls `op` on all the elements, in order.
+    template <typename Op>
+    Op apply(Op&& op) const
+      { for (auto const& value: fData) op(value); return std::forward<Op>(op); }
+
+    /// Changes the extents; all elements are replaced by copies of `defValue`.
+    void resize(Extents_t const& extents, T const& defValue = T{})
+      {
+        fMapper.resize(extents);
+        fData.assign(fMapper.size(), defValue);
+      }
+
+    /// Removes all the elements (and all extents are set to 0).
+    void clear() { fMapper.resize(Extents_t{}); fData.clear(); }
+
+    /// @}
+    // --- END -- Modification -------------------------------------------------
+
+
+      private:
+    Mapper_t fMapper; ///< Mapping between IDs and positions.
+    Container_t fData; ///< Data storage.
+
+    /// Returns the index of `id`, throwing `std::out_of_range` if invalid.
+    size_type checkedIndex(ID_t const& id) const
+      {
+        if (!hasElement(id)) {
+          throw std::out_of_range
+            ("GeoIDdataContainer has no element for " + id.toString());
+        }
+        return fMapper.index(id);
+      }
+
+  }; // class GeoIDdataContainer<>
+
+
+  /// @{
+  /// @name Containers for geometry elements
+
+  /// Container with one element per cryostat.
+  template <typename T>
+  using CryostatDataContainer = GeoIDdataContainer<T, CryostatID>;
+
+  /// Container with one element per TPC.
+  template <typename T>
+  using TPCDataContainer = GeoIDdataContainer<T, TPCID>;
+
+  /// Container with one element per wire plane.
+  template <typename T>
+  using PlaneDataContainer = GeoIDdataContainer<T, PlaneID>;
+
+  /// Container with one element per wire.
+  template <typename T>
+  using WireDataContainer = GeoIDdataContainer<T, WireID>;
+
+  /// @}
+
+} // namespace geo
+
+
+namespace readout {
+
+  /// @{
+  /// @name Containers for readout elements
+
+  /// Container with one element per TPC set.
+  template <typename T>
+  using TPCsetDataContainer = geo::GeoIDdataContainer<T, TPCsetID>;
+
+  /// Container with one element per readout plane.
+  template <typename T>
+  using ROPDataContainer = geo::GeoIDdataContainer<T, ROPID>;
+
+  /// @}
+
+} // namespace readout
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename IDType>
+auto geo::GeoIDmapper<IDType>::size() const -> index_type {
+  index_type n = 1U;
+  for (index_type const extent: fExtents) n *= extent;
+  return n;
+} // geo::GeoIDmapper<>::size()
+
+
+template <typename IDType>
+auto geo::GeoIDmapper<IDType>::ID(index_type index) const -> ID_t {
+  ID_t id;
+  fillIDImpl(id, index, std::make_index_sequence<dimensions()>());
+  id.setValidity(true);
+  return id;
+} // geo::GeoIDmapper<>::ID()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_CONTAINERS_H
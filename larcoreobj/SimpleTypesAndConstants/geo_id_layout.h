@@ -0,0 +1,239 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_id_layout.h
+ * @brief  Mapping of IDs to a linear index for a detector with fixed extents.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_id_containers.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_LAYOUT_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_LAYOUT_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_containers.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <utility> // std::index_sequence, std::declval()
+#include <type_traits> // std::decay_t
+#include <cstddef> // std::size_t
+
+
+namespace geo {
+
+  namespace details {
+
+    /// Returns whether `n` is a power of two.
+    constexpr bool isPowerOfTwo(std::size_t n)
+      { return (n != 0U) && ((n & (n - 1U)) == 0U); }
+
+    /// Returns the base 2 logarithm of `n` (rounded down).
+    constexpr unsigned int log2(std::size_t n)
+      { unsigned int l = 0U; while (n >>= 1U) ++l; return l; }
+
+  } // namespace details
+
+
+  /**
+   * @brief Maps IDs to a linear index, with extents fixed at compile time.
+   * @tparam IDType type of the ID (e.g. `geo::PlaneID`)
+   * @tparam Extents number of elements at each level, from the top one
+   *
+   * This class assigns each ID of a detector with a fixed topology a linear
+   * index between `0` and `size()`, with the same convention as
+   * `geo::GeoIDmapper`: the deepest index is the fastest to change, and the
+   * order follows the one of the IDs.
+   * All the functions are `static` and `constexpr`, so that the mapping can be
+   * resolved at compile time, and indices can be used to address plain arrays
+   * instead of maps.
+   *
+   * When the number of IDs below a level is a power of two, the
+   * multiplications, divisions and remainders by it are performed as bit
+   * shifts and masks.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * // 2 cryostats, 4 TPCs each, 3 planes each
+   * using Layout_t = geo::FixedIDLayout<geo::PlaneID, 2U, 4U, 3U>;
+   *
+   * std::array<double, Layout_t::size()> charge {};
+   * charge[Layout_t::index(geo::PlaneID{ 1, 2, 0 })] += 5.0;
+   *
+   * static_assert(Layout_t::ID(23U) == geo::PlaneID{ 1, 3, 2 });
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename IDType, std::size_t... Extents>
+  class FixedIDLayout {
+
+      public:
+    using ID_t = IDType; ///< Type of the ID.
+    using index_type = std::size_t; ///< Type of the linear index.
+
+    static_assert(sizeof...(Extents) == ID_t::Level + 1U,
+      "FixedIDLayout requires one extent per level of the ID.");
+    static_assert((... && (Extents > 0U)),
+      "FixedIDLayout requires all extents to be positive.");
+
+    /// Returns the number of levels of the ID.
+    static constexpr unsigned int dimensions()
+      { return sizeof...(Extents); }
+
+    /// Returns the number of IDs in the layout.
+    static constexpr index_type size()
+      { return (index_type(1U) * ... * Extents); }
+
+    /// Returns the number of elements at the level `Level`.
+    template <std::size_t Level>
+    static constexpr index_type extent()
+      { return std::get<Level>(extentList()); }
+
+    /// Returns the number of IDs below each element at the level `Level`.
+    template <std::size_t Level>
+    static constexpr index_type stride()
+      {
+        index_type s = 1U;
+        for (std::size_t l = Level + 1U; l < dimensions(); ++l)
+          s *= extentList()[l];
+        return s;
+      }
+
+    /// Returns the linear index of `id` (undefined if not `hasElement(id)`).
+    static constexpr index_type index(ID_t const& id)
+      { return indexImpl(id, std::make_index_sequence<dimensions()>{}); }
+
+    /// Returns the ID at the linear `index` (undefined if not below `size()`).
+    static constexpr ID_t ID(index_type index)
+      { return IDImpl(index, std::make_index_sequence<dimensions()>{}); }
+
+    /// Returns whether the indices of `id` are within the extents (like
+    /// `geo::GeoIDmapper::hasElement()`, the validity flag is ignored).
+    static constexpr bool hasElement(ID_t const& id)
+      { return hasElementImpl(id, std::make_index_sequence<dimensions()>{}); }
+
+    /// Returns the first ID of the layout.
+    static constexpr ID_t firstID() { return ID(0U); }
+
+    /// Returns the last ID of the layout.
+    static constexpr ID_t lastID() { return ID(size() - 1U); }
+
+    /// Returns a run-time mapper with the same extents.
+    static GeoIDmapper<ID_t> mapper()
+      {
+        return GeoIDmapper<ID_t>{ { static_cast
+          <typename GeoIDmapper<ID_t>::index_type>(Extents)... } };
+      }
+
+
+      private:
+
+    /// Type of the index of `ID_t` at the level `Level`.
+    template <std::size_t Level>
+    using LevelIndex_t = std::decay_t
+      <decltype(std::declval<ID_t const&>().template getIndex<Level>())>;
+
+    static constexpr std::array<index_type, sizeof...(Extents)> extentList()
+      { return { Extents... }; }
+
+    /// Returns `value * stride<Level>()`.
+    template <std::size_t Level>
+    static constexpr index_type scale(index_type value)
+      {
+        constexpr index_type s = stride<Level>();
+        if constexpr (details::isPowerOfTwo(s))
+          return value << details::log2(s);
+        else return value * s;
+      }
+
+    /// Returns the index at the level `Level` encoded in the linear `index`.
+    template <std::size_t Level>
+    static constexpr index_type levelIndex(index_type index)
+      {
+        constexpr index_type s = stride<Level>();
+        index_type quotient = 0U;
+        if constexpr (details::isPowerOfTwo(s))
+          quotient = index >> details::log2(s);
+        else quotient = index / s;
+        if constexpr (Level == 0U) return quotient; // top level: no wrapping
+        else {
+          constexpr index_type e = extent<Level>();
+          if constexpr (details::isPowerOfTwo(e)) return quotient & (e - 1U);
+          else return quotient % e;
+        }
+      }
+
+    template <std::size_t... Levels>
+    static constexpr index_type indexImpl
+      (ID_t const& id, std::index_sequence<Levels...>)
+      {
+        return (index_type(0U) + ... + scale<Levels>
+          (static_cast<index_type>(id.template getIndex<Levels>())));
+      }
+
+    template <std::size_t... Levels>
+    static constexpr ID_t IDImpl
+      (index_type index, std::index_sequence<Levels...>)
+      {
+        return ID_t
+          { static_cast<LevelIndex_t<Levels>>(levelIndex<Levels>(index))... };
+      }
+
+    template <std::size_t... Levels>
+    static constexpr bool hasElementImpl
+      (ID_t const& id, std::index_sequence<Levels...>)
+      {
+        return (... && (static_cast<index_type>(id.template getIndex<Levels>())
+          < extent<Levels>()));
+      }
+
+  }; // class FixedIDLayout<>
+
+
+  /// @{
+  /// @name Layouts of geometry IDs
+
+  template <std::size_t NCryostats>
+  using FixedCryostatLayout = FixedIDLayout<CryostatID, NCryostats>;
+
+  template <std::size_t NCryostats, std::size_t NTPCs>
+  using FixedTPCLayout = FixedIDLayout<TPCID, NCryostats, NTPCs>;
+
+  template <std::size_t NCryostats, std::size_t NTPCs, std::size_t NPlanes>
+  using FixedPlaneLayout = FixedIDLayout<PlaneID, NCryostats, NTPCs, NPlanes>;
+
+  template <
+    std::size_t NCryostats, std::size_t NTPCs, std::size_t NPlanes,
+    std::size_t NWires
+    >
+  using FixedWireLayout
+    = FixedIDLayout<WireID, NCryostats, NTPCs, NPlanes, NWires>;
+
+  /// @}
+
+} // namespace geo
+
+
+namespace readout {
+
+  /// @{
+  /// @name Layouts of readout IDs
+
+  template <std::size_t NCryostats, std::size_t NTPCsets>
+  using FixedTPCsetLayout = geo::FixedIDLayout<TPCsetID, NCryostats, NTPCsets>;
+
+  template <std::size_t NCryostats, std::size_t NTPCsets, std::size_t NROPs>
+  using FixedROPLayout
+    = geo::FixedIDLayout<ROPID, NCryostats, NTPCsets, NROPs>;
+
+  /// @}
+
+} // namespace readout
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_LAYOUT_H
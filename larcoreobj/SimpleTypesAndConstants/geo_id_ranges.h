@@ -0,0 +1,361 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_id_ranges.h
+ * @brief  Ranges of all the IDs of a detector with fixed extents.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_id_containers.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_RANGES_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_RANGES_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_containers.h"
+
+// C/C++ standard libraries
+#include <iterator> // std::random_access_iterator_tag
+#include <type_traits> // std::decay_t
+#include <utility> // std::index_sequence, std::declval(), std::as_const()
+#include <cstddef> // std::size_t, std::ptrdiff_t
+
+
+namespace geo {
+
+  /**
+   * @brief Range of all the IDs of a given type in a detector.
+   * @tparam IDType type of the ID (e.g. `geo::WireID`)
+   *
+   * The range covers the same IDs as a `geo::GeoIDmapper` with the same
+   * extents, in the same order (the one of `IDType::cmp()`), that is all the
+   * IDs whose index at each level is smaller than the extent of that level.
+   * All the IDs are valid.
+   *
+   * Stepping an iterator forward or backward increments or decrements the
+   * deepest index, carrying over to the parent levels when the index reaches
+   * its extent, just like nested loops would.
+   * Iterators are random access, so that algorithms (including the parallel
+   * ones) can split the range; jumps of more than one step recompute all the
+   * indices from the position in the range, which takes one division per
+   * level. Iterators point into the range and must not outlive it.
+   * The IDs are generated on the fly, so dereferencing an iterator returns
+   * the ID by value (like `std::views::iota`) rather than a reference into
+   * the iterator, which would dangle e.g. in `std::reverse_iterator`.
+   * For the tightest loops, `forEach()` visits the IDs with nested loops.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * // 2 cryostats, 4 TPCs each, 3 planes each
+   * for (geo::PlaneID const& pid: geo::IDRange<geo::PlaneID>({ 2U, 4U, 3U }))
+   *   std::cout << pid << std::endl;
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename IDType>
+  class IDRange {
+
+      public:
+    using ID_t = IDType; ///< Type of the IDs in the range.
+    using Mapper_t = GeoIDmapper<ID_t>; ///< Mapping of the IDs.
+    using Extents_t = typename Mapper_t::Extents_t; ///< Type of extent list.
+    using size_type = std::size_t;
+
+    class iterator;
+    using const_iterator = iterator;
+
+    /// Tag selecting the constructor of the iterator past the end.
+    struct EndTag_t {};
+
+
+    /// Constructor: a range with the specified number of elements per level.
+    explicit IDRange(Extents_t const& extents): fMapper(extents) {}
+
+    /// Constructor: the range of IDs covered by the specified mapping.
+    explicit IDRange(Mapper_t const& mapper): fMapper(mapper) {}
+
+
+    /// Returns an iterator to the first ID.
+    iterator begin() const { return { fMapper.extents(), 0U }; }
+
+    /// Returns an iterator past the last ID.
+    iterator end() const { return { fMapper.extents(), EndTag_t{} }; }
+
+    /**
+     * @brief Calls `op` with each ID in the range, in order.
+     * @tparam Op type of a callable object taking an `ID_t const&`
+     * @param op the callable object
+     *
+     * The IDs are generated by nested loops, one per level, so the compiler
+     * sees the same code as in loops written by hand, which a single loop
+     * with an iterator can't provide (e.g. it can't tell that the upper
+     * indices are constant while the deepest one runs).
+     */
+    template <typename Op>
+    void forEach(Op&& op) const
+      { ID_t id; id.setValidity(true); forEachImpl<0U>(id, op); }
+
+    /// Returns the ID at position `index` in the range.
+    ID_t operator[] (size_type index) const { return fMapper.ID(index); }
+
+    /// Returns the number of IDs in the range.
+    size_type size() const { return fMapper.size(); }
+
+    /// Returns whether the range is empty.
+    bool empty() const { return fMapper.empty(); }
+
+    /// Returns the mapping of the IDs in the range.
+    Mapper_t const& mapper() const { return fMapper; }
+
+
+      private:
+    Mapper_t fMapper; ///< Mapping of the IDs.
+
+    /// Loops on the indices of level `Level` and deeper of `id`.
+    template <std::size_t Level, typename Op>
+    void forEachImpl(ID_t& id, Op& op) const
+      {
+        using Index_t
+          = std::decay_t<decltype(id.template getIndex<Level>())>;
+        auto const n = static_cast<Index_t>(fMapper.template extent<Level>());
+        for (Index_t index = 0; index < n; ++index) {
+          id.template writeIndex<Level>() = index;
+          if constexpr (Level == ID_t::Level) op(std::as_const(id));
+          else forEachImpl<Level + 1U>(id, op);
+        }
+      }
+
+  }; // class IDRange<>
+
+
+  //----------------------------------------------------------------------------
+  /**
+   * @brief Random access iterator to the IDs of a `geo::IDRange`.
+   *
+   * The iterator holds the current ID, the extent of the deepest level and a
+   * pointer to the extents of its range, so it must not outlive the range it
+   * comes from.
+   * Stepping and comparing for equality work on the ID alone, so that a
+   * range-based loop costs about as much as nested loops. The position in the
+   * range, needed by the ordering operators and by jumps, is computed from the
+   * ID when needed.
+   */
+  template <typename IDType>
+  class IDRange<IDType>::iterator {
+
+      public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = ID_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type; ///< IDs are returned by value.
+
+    /// Copy of an ID, for `operator->` to point to.
+    class pointer {
+      ID_t fID;
+        public:
+      explicit pointer(ID_t const& id): fID(id) {}
+      ID_t const* operator-> () const { return &fID; }
+    }; // class pointer
+
+    iterator() = default;
+
+    /// Constructor: points to the ID at position `index` in the range.
+    iterator(Extents_t const& extents, size_type index)
+      : fExtents(&extents), fDeepestExtent(std::get<ID_t::Level>(extents))
+      { moveTo(index); }
+
+    /// Constructor: points past the last ID of the range.
+    iterator(Extents_t const& extents, EndTag_t)
+      : fExtents(&extents), fDeepestExtent(std::get<ID_t::Level>(extents))
+      {
+        // the same as `moveTo(size)`, without divisions, so that the compiler
+        // sees the constant indices of the end of a loop
+        fill<ID_t::Level>(0U);
+        if (extentProduct<1U>() != 0U) {
+          fID.template writeIndex<0U>()
+            = static_cast<Index_t<0U>>(extent<0U>());
+        }
+        fID.setValidity(true);
+      }
+
+    reference operator* () const { return fID; }
+    pointer operator-> () const { return pointer{ fID }; }
+    reference operator[] (difference_type n) const { return *(*this + n); }
+
+    iterator& operator++ () { increment<ID_t::Level>(); return *this; }
+    iterator& operator-- () { decrement<ID_t::Level>(); return *this; }
+    iterator operator++ (int) { iterator old = *this; ++*this; return old; }
+    iterator operator-- (int) { iterator old = *this; --*this; return old; }
+
+    iterator& operator+= (difference_type n)
+      { moveTo(position() + n); return *this; }
+    iterator& operator-= (difference_type n)
+      { moveTo(position() - n); return *this; }
+    iterator operator+ (difference_type n) const
+      { iterator it = *this; return it += n; }
+    iterator operator- (difference_type n) const
+      { iterator it = *this; return it -= n; }
+    friend iterator operator+ (difference_type n, iterator const& it)
+      { return it + n; }
+    difference_type operator- (iterator const& other) const
+      {
+        return
+          difference_type(position()) - difference_type(other.position());
+      }
+
+    bool operator== (iterator const& other) const
+      { return sameIndices(other.fID); }
+    bool operator!= (iterator const& other) const
+      { return !(*this == other); }
+    bool operator< (iterator const& other) const
+      { return position() < other.position(); }
+    bool operator<= (iterator const& other) const
+      { return position() <= other.position(); }
+    bool operator> (iterator const& other) const
+      { return position() > other.position(); }
+    bool operator>= (iterator const& other) const
+      { return position() >= other.position(); }
+
+      private:
+    /// Type of the index of level `Level` of the ID.
+    template <std::size_t Level>
+    using Index_t = std::decay_t
+      <decltype(std::declval<ID_t const&>().template getIndex<Level>())>;
+
+    Extents_t const* fExtents = nullptr; ///< Extents of the range.
+    size_type fDeepestExtent = 0U; ///< Cached extent of the deepest level.
+    ID_t fID; ///< Current ID.
+
+    /// Returns the extent of level `Level`.
+    template <std::size_t Level>
+    size_type extent() const
+      {
+        if constexpr (Level == ID_t::Level) return fDeepestExtent;
+        else return std::get<Level>(*fExtents);
+      }
+
+    /// Returns the product of the extents from level `Level` down.
+    template <std::size_t Level>
+    size_type extentProduct() const
+      {
+        if constexpr (Level > ID_t::Level) return 1U;
+        else return extent<Level>() * extentProduct<Level + 1U>();
+      }
+
+    /// Returns whether the indices of `id` are the same as the current ones.
+    template <std::size_t Level = 0U>
+    bool sameIndices(ID_t const& id) const
+      {
+        if (fID.template getIndex<Level>() != id.template getIndex<Level>())
+          return false;
+        if constexpr (Level == ID_t::Level) return true;
+        else return sameIndices<Level + 1U>(id);
+      }
+
+    /// Returns the position of the current ID in the range.
+    size_type position() const
+      { return positionImpl(std::make_index_sequence<ID_t::Level + 1U>()); }
+
+    template <std::size_t... Levels>
+    size_type positionImpl(std::index_sequence<Levels...>) const
+      {
+        size_type index = 0U;
+        ((index = index * extent<Levels>()
+          + static_cast<size_type>(fID.template getIndex<Levels>())), ...);
+        return index;
+      }
+
+    /// Moves to the next ID, starting from level `Level`.
+    template <std::size_t Level>
+    void increment()
+      {
+        auto& index = fID.template writeIndex<Level>();
+        if constexpr (Level == 0U) ++index; // top level: no carry
+        else if (static_cast<size_type>(index) + 1U < extent<Level>()) ++index;
+        else {
+          index = 0;
+          increment<Level - 1U>();
+        }
+      }
+
+    /// Moves to the previous ID, starting from level `Level`.
+    template <std::size_t Level>
+    void decrement()
+      {
+        auto& index = fID.template writeIndex<Level>();
+        if constexpr (Level == 0U) --index; // top level: no borrow
+        else if (index-- == 0) {
+          index = static_cast<Index_t<Level>>(extent<Level>() - 1U);
+          decrement<Level - 1U>();
+        }
+      }
+
+    /// Sets the indices of the ID at `index`; the top level does not wrap.
+    void moveTo(size_type index)
+      {
+        fill<ID_t::Level>(index);
+        fID.setValidity(true);
+      }
+
+    template <std::size_t Level>
+    void fill(size_type index)
+      {
+        if constexpr (Level == 0U) {
+          fID.template writeIndex<Level>() = static_cast<Index_t<Level>>(index);
+        }
+        else {
+          size_type const extent = this->extent<Level>();
+          if (extent == 0U) { // empty range: all indices are 0
+            fID.template writeIndex<Level>() = 0;
+            fill<Level - 1U>(0U);
+            return;
+          }
+          fID.template writeIndex<Level>()
+            = static_cast<Index_t<Level>>(index % extent);
+          fill<Level - 1U>(index / extent);
+        }
+      }
+
+  }; // class IDRange<>::iterator
+
+
+  //----------------------------------------------------------------------------
+  /// Returns the range of all the IDs of type `ID` with the specified extents.
+  template <typename ID>
+  IDRange<ID> iterateIDs(typename IDRange<ID>::Extents_t const& extents)
+    { return IDRange<ID>{ extents }; }
+
+
+  /// @{
+  /// @name Ranges of geometry IDs
+
+  using CryostatIDRange = IDRange<CryostatID>;
+  using TPCIDRange      = IDRange<TPCID>;
+  using PlaneIDRange    = IDRange<PlaneID>;
+  using WireIDRange     = IDRange<WireID>;
+
+  /// @}
+
+} // namespace geo
+
+
+namespace readout {
+
+  /// @{
+  /// @name Ranges of readout IDs
+
+  using TPCsetIDRange = geo::IDRange<TPCsetID>;
+  using ROPIDRange    = geo::IDRange<ROPID>;
+
+  /// @}
+
+  using geo::iterateIDs;
+
+} // namespace readout
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_RANGES_H
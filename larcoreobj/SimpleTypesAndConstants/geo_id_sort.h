@@ -0,0 +1,279 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_id_sort.h
+ * @brief  Radix sort of collections of geometry and readout IDs.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_packed_id.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_SORT_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_SORT_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_packed_id.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::stable_sort(), std::sort()
+#include <array>
+#include <vector>
+#include <iterator> // std::iterator_traits
+#include <type_traits> // std::is_base_of_v
+#include <utility> // std::move()
+#include <cstdint> // std::uint64_t
+#include <cstddef> // std::size_t
+
+
+namespace geo {
+
+  /**
+   * @brief Sorts a range of IDs, or of records with an ID, keeping the order
+   *        of equivalent elements.
+   * @tparam Iter type of random access iterator to the elements
+   * @tparam KeyFunc type of the function extracting the ID from an element
+   * @param first iterator to the first element to be sorted
+   * @param last iterator past the last element to be sorted
+   * @param key function returning the ID (or packed ID) of an element
+   *
+   * The elements are sorted by increasing ID, with the same result as
+   * `std::stable_sort()` comparing `key(a) < key(b)`.
+   * The IDs are reduced to their packed key (`geo::PackedID::indexKey()`), and
+   * the keys are sorted with a least-significant-digit radix sort, one byte at
+   * a time, skipping the bytes which have the same value in all the keys
+   * (e.g. the cryostat in a single cryostat detector).
+   * Records are then moved into their place, once; plain IDs are instead
+   * rebuilt from their sorted keys.
+   *
+   * If any of the IDs can't be packed (`geo::PackedID::canPack()`), or the
+   * range is short, the range is sorted with `std::stable_sort()` instead.
+   *
+   * Sorting records requires additional memory for two keys and indices per
+   * element, and for a copy of the elements.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<recob::Hit> hits = ...;
+   * geo::stable_radix_sort(hits.begin(), hits.end(),
+   *   [](recob::Hit const& hit){ return hit.WireID(); });
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename Iter, typename KeyFunc>
+  void stable_radix_sort(Iter first, Iter last, KeyFunc key);
+
+  /// Sorts a range of IDs (or packed IDs), keeping the order of equal IDs.
+  template <typename Iter>
+  void stable_radix_sort(Iter first, Iter last);
+
+  /**
+   * @brief Sorts a range of IDs, or of records with an ID.
+   * @tparam Iter type of random access iterator to the elements
+   * @tparam KeyFunc type of the function extracting the ID from an element
+   * @param first iterator to the first element to be sorted
+   * @param last iterator past the last element to be sorted
+   * @param key function returning the ID (or packed ID) of an element
+   * @see `geo::stable_radix_sort()`
+   *
+   * Like `geo::stable_radix_sort()`, but the order of equivalent elements is
+   * not guaranteed: short ranges and IDs which can't be packed are sorted
+   * with `std::sort()`.
+   */
+  template <typename Iter, typename KeyFunc>
+  void radix_sort(Iter first, Iter last, KeyFunc key);
+
+  /// Sorts a range of IDs (or packed IDs).
+  template <typename Iter>
+  void radix_sort(Iter first, Iter last);
+
+
+  namespace details {
+
+    /// Ranges shorter than this are sorted by comparison.
+    constexpr std::size_t RadixSortMinSize = 256U;
+
+    /// Returns the packed version of `id`.
+    template <typename ID>
+    constexpr PackedID<ID> toPackedID(ID const& id)
+      { return PackedID<ID>{ id }; }
+
+    template <typename ID>
+    constexpr PackedID<ID> toPackedID(PackedID<ID> const& id) { return id; }
+
+    /// Returns whether `id` can be sorted by its packed key.
+    template <typename ID>
+    constexpr bool canRadixSort(ID const& id)
+      { return PackedID<ID>::canPack(id); }
+
+    template <typename ID>
+    constexpr bool canRadixSort(PackedID<ID> const&) { return true; }
+
+    /// Returns the ID of type `ID` with the specified full packed key.
+    template <typename ID>
+    struct FromPackedKey {
+      static ID get(std::uint64_t key)
+        { return PackedID<ID>::fromKey(key).unpack(); }
+    };
+
+    template <typename ID>
+    struct FromPackedKey<PackedID<ID>> {
+      static constexpr PackedID<ID> get(std::uint64_t key)
+        { return PackedID<ID>::fromKey(key); }
+    };
+
+    /// Returns the identity of its argument.
+    struct IdentityKey {
+      template <typename T>
+      constexpr T const& operator() (T const& value) const { return value; }
+    };
+
+    /**
+     * @brief Stable sort of `entries` by the 64-bit sorting key of each one.
+     * @param entries the data to be sorted
+     * @param sortKey function returning the sorting key of an entry
+     *
+     * Least-significant-digit radix sort, one byte at a time; the bytes which
+     * have the same value in all the entries are skipped.
+     */
+    template <typename Entry, typename SortKey>
+    void lsdRadixSort(std::vector<Entry>& entries, SortKey sortKey);
+
+    /**
+     * @brief Sorts the range by key, returns false if not possible.
+     *
+     * Nothing is moved if `false` is returned.
+     */
+    template <typename Iter, typename KeyFunc>
+    bool radixSortImpl(Iter first, Iter last, KeyFunc& key);
+
+  } // namespace details
+
+} // namespace geo
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Entry, typename SortKey>
+void geo::details::lsdRadixSort(std::vector<Entry>& entries, SortKey sortKey)
+{
+  constexpr unsigned int NDigits = sizeof(std::uint64_t);
+  constexpr unsigned int Radix = 256U;
+
+  std::size_t const n = entries.size();
+  if (n == 0U) return;
+
+  // count the occurrences of each digit, all in one pass
+  std::vector<std::array<std::size_t, Radix>> counts(NDigits);
+  for (Entry const& entry: entries) {
+    std::uint64_t const k = sortKey(entry);
+    for (unsigned int d = 0; d < NDigits; ++d)
+      ++counts[d][(k >> (8U * d)) & 0xFFU];
+  } // for
+
+  // one stable counting sort pass per digit, from the least significant one
+  std::vector<Entry> buffer(n);
+  for (unsigned int d = 0; d < NDigits; ++d) {
+    unsigned int const shift = 8U * d;
+    std::array<std::size_t, Radix>& count = counts[d];
+    if (count[(sortKey(entries.front()) >> shift) & 0xFFU] == n) continue;
+
+    std::size_t offset = 0U;
+    for (std::size_t& c: count) {
+      std::size_t const here = c;
+      c = offset;
+      offset += here;
+    }
+    for (Entry const& entry: entries)
+      buffer[count[(sortKey(entry) >> shift) & 0xFFU]++] = entry;
+    entries.swap(buffer);
+  } // for digits
+
+} // geo::details::lsdRadixSort()
+
+
+//------------------------------------------------------------------------------
+template <typename Iter, typename KeyFunc>
+bool geo::details::radixSortImpl(Iter first, Iter last, KeyFunc& key) {
+
+  using Value_t = typename std::iterator_traits<Iter>::value_type;
+  static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+    typename std::iterator_traits<Iter>::iterator_category>,
+    "geo::radix_sort() requires random access iterators.");
+
+  std::size_t const n = last - first;
+  if (n < RadixSortMinSize) return false;
+
+  if constexpr (std::is_same_v<KeyFunc, IdentityKey>) {
+    // sorting IDs: sort their full keys and rebuild the IDs from them;
+    // the validity bit is carried along but does not affect the order
+    std::vector<std::uint64_t> keys(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      if (!canRadixSort(first[i])) return false;
+      keys[i] = toPackedID(first[i]).key();
+    }
+    lsdRadixSort(keys, [](std::uint64_t k){ return k >> 1U; });
+    for (std::size_t i = 0; i < n; ++i)
+      first[i] = FromPackedKey<Value_t>::get(keys[i]);
+  }
+  else {
+    // sorting records: sort the keys with the position of their record,
+    // then move the records in their place
+    struct Entry_t {
+      std::uint64_t key;
+      std::size_t index;
+    };
+    std::vector<Entry_t> entries(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      auto const& id = key(first[i]);
+      if (!canRadixSort(id)) return false;
+      entries[i] = { toPackedID(id).indexKey(), i };
+    }
+    lsdRadixSort(entries, [](Entry_t const& entry){ return entry.key; });
+
+    std::vector<Value_t> sorted;
+    sorted.reserve(n);
+    for (Entry_t const& entry: entries)
+      sorted.push_back(std::move(first[entry.index]));
+    std::move(sorted.begin(), sorted.end(), first);
+  }
+  return true;
+
+} // geo::details::radixSortImpl()
+
+
+//------------------------------------------------------------------------------
+template <typename Iter, typename KeyFunc>
+void geo::stable_radix_sort(Iter first, Iter last, KeyFunc key) {
+  if (details::radixSortImpl(first, last, key)) return;
+  using Value_t = typename std::iterator_traits<Iter>::value_type;
+  std::stable_sort(first, last,
+    [&key](Value_t const& a, Value_t const& b){ return key(a) < key(b); }
+    );
+} // geo::stable_radix_sort()
+
+
+template <typename Iter>
+void geo::stable_radix_sort(Iter first, Iter last)
+  { stable_radix_sort(first, last, details::IdentityKey{}); }
+
+
+//------------------------------------------------------------------------------
+template <typename Iter, typename KeyFunc>
+void geo::radix_sort(Iter first, Iter last, KeyFunc key) {
+  if (details::radixSortImpl(first, last, key)) return;
+  using Value_t = typename std::iterator_traits<Iter>::value_type;
+  std::sort(first, last,
+    [&key](Value_t const& a, Value_t const& b){ return key(a) < key(b); }
+    );
+} // geo::radix_sort()
+
+
+template <typename Iter>
+void geo::radix_sort(Iter first, Iter last)
+  { radix_sort(first, last, details::IdentityKey{}); }
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_ID_SORT_H
@@ -0,0 +1,311 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_packed_id.h
+ * @brief  Compact 64-bit encoding of geometry and readout IDs.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_types.h
+ *         larcoreobj/SimpleTypesAndConstants/readout_types.h
+ *
+ * This library is header-only and depends only on standard C++.
+ *
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_PACKED_ID_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_PACKED_ID_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
+
+// C/C++ standard libraries
+#include <utility> // std::index_sequence
+#include <cstdint> // std::uint64_t
+#include <cstddef> // std::size_t
+
+
+namespace geo {
+
+  /**
+   * @brief Geometry ID encoded in a single 64-bit integer.
+   * @tparam ID the type of ID being encoded (e.g. `geo::WireID`)
+   *
+   * The packed ID stores all the indices of `ID`, from the cryostat down to
+   * the deepest level, plus the validity flag, in a single `std::uint64_t`.
+   * The layout of the key, from the most significant bit, is:
+   *
+   * * cryostat index (8 bits, if the ID has deeper levels)
+   * * second level index (16 bits, if the ID has deeper levels)
+   * * third level index (8 bits, if the ID has deeper levels)
+   * * deepest level index: all the remaining bits but one
+   * * validity flag (least significant bit)
+   *
+   * For example, a `geo::WireID` has 8 bits for the cryostat, 16 for the TPC,
+   * 8 for the plane and 31 for the wire. A `geo::PlaneID` has 39 bits for the
+   * plane, and a `geo::CryostatID` has 63 bits for the cryostat.
+   *
+   * The special `InvalidID` value of each level is encoded with all the bits
+   * of its field set, so it survives the round trip. Any other index value
+   * must be strictly smaller than that; `canPack()` checks whether an ID can
+   * be represented, and the result of packing an ID that can't is undefined.
+   *
+   * Packed IDs compare (`==`, `<`, etc.) with a single integer comparison,
+   * which yields the same ordering as `ID::cmp()`. As for the original IDs,
+   * validity is ignored in the comparison.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * geo::PackedWireID const packed { geo::WireID{ 0, 1, 2, 345 } };
+   * geo::WireID const wid = packed.unpack();
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename ID>
+  class PackedID {
+
+      public:
+    using ID_t = ID; ///< Type of the original ID.
+    using Key_t = std::uint64_t; ///< Type of the packed representation.
+
+    /// Number of index levels in the ID.
+    static constexpr std::size_t NLevels = ID::Level + 1U;
+
+    static_assert(NLevels <= 4U, "PackedID supports up to four levels.");
+
+    /// Number of bits used to store the index of level `Level`.
+    static constexpr unsigned int bits(std::size_t Level);
+
+    /// Position of the least significant bit of the index of level `Level`.
+    static constexpr unsigned int offset(std::size_t Level);
+
+    /// Largest value the field of level `Level` can hold (all bits set).
+    static constexpr Key_t fieldMask(std::size_t Level)
+      { return (Key_t(1) << bits(Level)) - 1U; }
+
+
+    /// Default constructor: an invalid ID (same as `ID{}`).
+    constexpr PackedID(): PackedID(ID{}) {}
+
+    /// Constructor: packs the specified ID.
+    explicit constexpr PackedID(ID const& id): fKey(pack(id)) {}
+
+    /// Returns a packed ID with the specified key (no check performed).
+    static constexpr PackedID fromKey(Key_t key)
+      { PackedID p; p.fKey = key; return p; }
+
+
+    /// Returns the full packed key, including the validity bit.
+    constexpr Key_t key() const { return fKey; }
+
+    /// Returns the key without the validity bit; this defines the ordering.
+    constexpr Key_t indexKey() const { return fKey >> 1U; }
+
+    /// Returns the original ID.
+    ID unpack() const;
+
+    /// Conversion to the original ID.
+    explicit operator ID() const { return unpack(); }
+
+    /// Returns the index of the level `Level` of this ID.
+    template <std::size_t Level>
+    constexpr auto getIndex() const;
+
+
+    /// @{
+    /// @name ID validity
+
+    /// Returns whether the packed ID is valid.
+    constexpr bool isValid() const { return (fKey & 1U) != 0; }
+
+    /// Returns true if the ID is valid.
+    explicit constexpr operator bool() const { return isValid(); }
+
+    /// Returns true if the ID is not valid.
+    constexpr bool operator! () const { return !isValid(); }
+
+    /// @}
+
+
+    /// Returns whether `id` can be packed without loss of information.
+    static constexpr bool canPack(ID const& id)
+      { return canPackImpl(id, std::make_index_sequence<NLevels>()); }
+
+
+      private:
+    Key_t fKey; ///< The packed representation of the ID.
+
+    /// Width of the index fields above the deepest one.
+    static constexpr unsigned int UpperLevelBits[] = { 8U, 16U, 8U };
+
+    /// Bits available for all the indices (one is taken by the validity flag).
+    static constexpr unsigned int IndexBits = 63U;
+
+    /// Type of the index of level `Level`.
+    template <std::size_t Level>
+    using Index_t = decltype(std::declval<ID>().template getIndex<Level>());
+
+    /// Returns the value of the invalid index for level `Level`.
+    template <std::size_t Level>
+    static constexpr auto invalidIndex()
+      { return ID::template ID_t<Level>::getInvalidID(); }
+
+    /// Encodes the index of level `Level` into its field (not shifted).
+    template <std::size_t Level>
+    static constexpr Key_t encodeIndex(ID const& id)
+      {
+        auto const index = id.template getIndex<Level>();
+        return (index == invalidIndex<Level>())
+          ? fieldMask(Level): static_cast<Key_t>(index);
+      }
+
+    /// Decodes the index of level `Level` from the key.
+    template <std::size_t Level>
+    static constexpr Index_t<Level> decodeIndex(Key_t key)
+      {
+        Key_t const field = (key >> offset(Level)) & fieldMask(Level);
+        return (field == fieldMask(Level))
+          ? invalidIndex<Level>(): static_cast<Index_t<Level>>(field);
+      }
+
+    template <std::size_t... Levels>
+    static constexpr Key_t packImpl
+      (ID const& id, std::index_sequence<Levels...>)
+      {
+        return (Key_t(id.isValid? 1U: 0U) | ...
+          | (encodeIndex<Levels>(id) << offset(Levels)));
+      }
+
+    template <std::size_t... Levels>
+    static constexpr bool canPackImpl
+      (ID const& id, std::index_sequence<Levels...>)
+      {
+        return (... && (
+          (id.template getIndex<Levels>() == invalidIndex<Levels>())
+          || (static_cast<Key_t>(id.template getIndex<Levels>())
+            < fieldMask(Levels))
+          ));
+      }
+
+    template <std::size_t... Levels>
+    void unpackImpl(ID& id, std::index_sequence<Levels...>) const
+      { ((id.template writeIndex<Levels>() = decodeIndex<Levels>(fKey)), ...); }
+
+    /// Returns the packed key of the specified ID.
+    static constexpr Key_t pack(ID const& id)
+      { return packImpl(id, std::make_index_sequence<NLevels>()); }
+
+  }; // class PackedID<>
+
+
+  /// Returns the packed version of the specified ID.
+  template <typename ID>
+  constexpr PackedID<ID> packID(ID const& id) { return PackedID<ID>{ id }; }
+
+
+  /// @{
+  /// @name Packed ID comparison operators
+  /// @details As for the original IDs, validity is ignored.
+
+  template <typename ID>
+  constexpr bool operator== (PackedID<ID> const& a, PackedID<ID> const& b)
+    { return a.indexKey() == b.indexKey(); }
+
+  template <typename ID>
+  constexpr bool operator!= (PackedID<ID> const& a, PackedID<ID> const& b)
+    { return a.indexKey() != b.indexKey(); }
+
+  template <typename ID>
+  constexpr bool operator< (PackedID<ID> const& a, PackedID<ID> const& b)
+    { return a.indexKey() < b.indexKey(); }
+
+  template <typename ID>
+  constexpr bool operator<= (PackedID<ID> const& a, PackedID<ID> const& b)
+    { return a.indexKey() <= b.indexKey(); }
+
+  template <typename ID>
+  constexpr bool operator> (PackedID<ID> const& a, PackedID<ID> const& b)
+    { return a.indexKey() > b.indexKey(); }
+
+  template <typename ID>
+  constexpr bool operator>= (PackedID<ID> const& a, PackedID<ID> const& b)
+    { return a.indexKey() >= b.indexKey(); }
+
+#if __cpp_impl_three_way_comparison >= 201907L
+  template <typename ID>
+  constexpr std::weak_ordering operator<=>
+    (PackedID<ID> const& a, PackedID<ID> const& b)
+    { return a.indexKey() <=> b.indexKey(); }
+#endif // __cpp_impl_three_way_comparison
+
+  /// @}
+
+
+  /// @{
+  /// @name Packed geometry ID types
+
+  using PackedCryostatID = PackedID<CryostatID>;
+  using PackedOpDetID    = PackedID<OpDetID>;
+  using PackedTPCID      = PackedID<TPCID>;
+  using PackedPlaneID    = PackedID<PlaneID>;
+  using PackedWireID     = PackedID<WireID>;
+
+  /// @}
+
+} // namespace geo
+
+
+namespace readout {
+
+  /// @{
+  /// @name Packed readout ID types
+
+  using PackedCryostatID = geo::PackedID<CryostatID>;
+  using PackedTPCsetID   = geo::PackedID<TPCsetID>;
+  using PackedROPID      = geo::PackedID<ROPID>;
+
+  /// @}
+
+  using geo::packID;
+
+} // namespace readout
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename ID>
+constexpr unsigned int geo::PackedID<ID>::bits(std::size_t Level) {
+  if (Level + 1U < NLevels) return UpperLevelBits[Level];
+  unsigned int upperBits = 0U;
+  for (std::size_t l = 0U; l + 1U < NLevels; ++l) upperBits += UpperLevelBits[l];
+  return IndexBits - upperBits;
+} // geo::PackedID<>::bits()
+
+
+template <typename ID>
+constexpr unsigned int geo::PackedID<ID>::offset(std::size_t Level) {
+  unsigned int offset = 1U; // the validity bit
+  for (std::size_t l = Level + 1U; l < NLevels; ++l) offset += bits(l);
+  return offset;
+} // geo::PackedID<>::offset()
+
+
+template <typename ID>
+ID geo::PackedID<ID>::unpack() const {
+  ID id;
+  unpackImpl(id, std::make_index_sequence<NLevels>());
+  id.setValidity(isValid());
+  return id;
+} // geo::PackedID<>::unpack()
+
+
+template <typename ID>
+template <std::size_t Level>
+constexpr auto geo::PackedID<ID>::getIndex() const {
+  static_assert
+    (Level < NLevels, "This ID type does not have the requested Index level.");
+  return decodeIndex<Level>(fKey);
+} // geo::PackedID<>::getIndex()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_PACKED_ID_H
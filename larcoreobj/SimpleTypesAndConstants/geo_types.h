@@ -18,6 +18,16 @@
 #include <sstream>
 #include <iosfwd> // std::ostream
 #include <limits> // std::numeric_limits<>
+#include <functional> // std::hash
+#include <utility> // std::index_sequence
+#include <cstdint> // std::uint64_t
+#include <charconv> // std::to_chars(), std::from_chars()
+#include <string_view>
+#include <optional>
+#include <array>
+#if __cpp_impl_three_way_comparison >= 201907L
+#  include <compare> // std::weak_ordering
+#endif
 
 namespace geo {
   namespace details {
@@ -25,6 +35,34 @@ namespace geo {
     template <typename T>
     std::string writeToString(T const& value);
     
+    /// Label of the ID level in its string representation (e.g. `'W'`).
+    template <typename ID>
+    struct IDlabel;
+    
+    /**
+     * @brief Writes `id` into `out`, honouring the formatting of the stream.
+     *
+     * When `out` formats integers in the default way (decimal, no padding,
+     * classic locale) the text from `geo::toChars()` is written in one go;
+     * otherwise the labels and indices are streamed one by one, so that for
+     * example `std::hex` applies to each index and `std::setw` to the first
+     * label only.
+     */
+    template <typename ID>
+    std::ostream& writeID(std::ostream& out, ID const& id);
+    
+    /// Streams the indices of `id` one by one (see `writeID()`).
+    template <typename ID>
+    void streamIDindices(std::ostream& out, ID const& id);
+    
+    /// Returns whether `out` surely writes integers as `std::to_chars()` does.
+    bool hasDefaultIntegerFormat(std::ostream const& out);
+    
+    /// Reads all the indices of `id` from text (validity is not set).
+    template <typename ID>
+    std::from_chars_result readIDindices
+      (char const* first, char const* last, ID& id);
+    
     /// Whether `ID` represents an element on top of the hierarchy.
     template <typename ID>
     constexpr bool isTopGeoElementID = std::is_void_v<typename ID::ParentID_t>;
@@ -72,6 +110,25 @@ namespace geo {
         else return getRelIDindex<UpIndex - 1U>(id.parentID());
       }
     
+    /// Scrambles the bits of `x` (bijective "splitmix64" finalizer).
+    constexpr std::uint64_t mixHashBits(std::uint64_t x);
+    
+    /// Returns a hash value from all the indices of the ID (validity ignored).
+    template <typename ID>
+    constexpr std::size_t hashID(ID const& id);
+    
+    /// Maximum length of the string representation of an `ID`.
+    template <typename ID>
+    constexpr std::size_t IDstringMaxLength() {
+      using Index_t = std::decay_t<decltype(std::declval<ID>().deepestIndex())>;
+      // label, colon and all the digits
+      constexpr std::size_t length
+        = 2U + std::numeric_limits<Index_t>::digits10 + 1U;
+      if constexpr (isTopGeoElementID<ID>) return length;
+      else // add a space separator
+        return IDstringMaxLength<typename ID::ParentID_t>() + 1U + length;
+    } // IDstringMaxLength()
+    
   } // namespace details
 } // namespace geo
 
@@ -643,41 +700,145 @@ namespace geo {
 
 
   //----------------------------------------------------------------------------
-  //--- ID output operators
+  //--- ID output
   //---
+  template <> struct details::IDlabel<CryostatID>
+    { static constexpr char value = 'C'; };
+  template <> struct details::IDlabel<OpDetID>
+    { static constexpr char value = 'O'; };
+  template <> struct details::IDlabel<TPCID>
+    { static constexpr char value = 'T'; };
+  template <> struct details::IDlabel<PlaneID>
+    { static constexpr char value = 'P'; };
+  template <> struct details::IDlabel<WireID>
+    { static constexpr char value = 'W'; };
+
+
+  /**
+   * @brief Writes the representation of `id` into the buffer [`first`, `last`[
+   * @tparam ID type of the ID to be written
+   * @param first pointer to the first character of the buffer
+   * @param last pointer after the last character of the buffer
+   * @param id the ID to be written
+   * @return the end of the written text and the error code, as `std::to_chars`
+   *
+   * The representation lists all the indices of the ID from the cryostat down,
+   * each with a label: for example, "C:0 T:1 P:2 W:345" for a `geo::WireID`.
+   * No terminating null character is written and no memory is allocated.
+   * If the buffer is too small, `std::errc::value_too_large` is returned
+   * together with `last`, and the buffer content is unspecified.
+   * `geo::IDstring<ID>::MaxLength` characters are always enough.
+   */
+  template <typename ID>
+  std::to_chars_result toChars(char* first, char* last, ID const& id);
+
+
+  /**
+   * @brief String representation of an ID in a fixed-size buffer.
+   * @tparam ID type of the ID being represented
+   *
+   * The buffer is large enough for any ID of type `ID`, and it is part of the
+   * object, so that formatting an ID allocates no memory.
+   * The text is the one produced by `geo::toChars()`.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::printf("%s\n", geo::IDstring{ geo::WireID{ 0, 1, 2, 345 } }.c_str());
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename ID>
+  class IDstring {
+      public:
+    /// Maximum length of the representation of an ID of type `ID`.
+    static constexpr std::size_t MaxLength = details::IDstringMaxLength<ID>();
+
+    /// Constructor: writes the representation of `id`.
+    explicit IDstring(ID const& id);
+
+    /// Returns the number of characters of the representation.
+    std::size_t size() const { return fLength; }
+
+    /// Returns the representation as a string view.
+    std::string_view view() const { return { fBuffer.data(), fLength }; }
+
+    /// Returns the representation as a null-terminated C string.
+    char const* c_str() const { return fBuffer.data(); }
+
+    /// Returns the representation as a new string.
+    std::string str() const { return std::string{ view() }; }
+
+    /// Conversion to a string view.
+    operator std::string_view() const { return view(); }
+
+      private:
+    std::array<char, MaxLength + 1U> fBuffer; ///< Text buffer.
+    std::size_t fLength = 0U; ///< Length of the text in the buffer.
+  }; // class IDstring<>
+
+
+  /**
+   * @brief Reads an ID from the text in [`first`, `last`[.
+   * @tparam ID type of the ID to be read
+   * @param first pointer to the first character of the text
+   * @param last pointer after the last character of the text
+   * @param[out] id the ID to be filled
+   * @return the end of the parsed text and the error code, as `std::from_chars`
+   *
+   * This is the inverse of `geo::toChars()`, and it accepts only the exact
+   * format that function writes, e.g. "C:0 T:1 P:2 W:345" for a `geo::WireID`
+   * (no leading or extra spaces, no signs).
+   * Parsing stops after the last index, which is not required to be at the end
+   * of the text.
+   * On failure, `std::errc::invalid_argument` is returned if the text does not
+   * match the format, and `std::errc::result_out_of_range` if an index does
+   * not fit its type; `id` is then in an unspecified state.
+   * The text does not carry the validity flag: the ID is marked as valid unless
+   * any of its indices has the special invalid value.
+   * No memory is allocated.
+   */
+  template <typename ID>
+  std::from_chars_result fromChars(char const* first, char const* last, ID& id);
+
+
+  /**
+   * @brief Returns the ID represented by `text`, if any.
+   * @tparam ID type of the ID to be read
+   * @param text the text to be parsed
+   * @return the ID, or no value if `text` is not exactly a valid representation
+   * @see `geo::fromChars()`
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::optional<geo::WireID> wid = geo::parseID<geo::WireID>("C:0 T:1 P:2 W:3");
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename ID>
+  std::optional<ID> parseID(std::string_view text);
+
+
   /// Generic output of CryostatID to stream
-  inline std::ostream& operator<< (std::ostream& out, CryostatID const& cid) {
-    out << "C:" << cid.Cryostat;
-    return out;
-  } // operator<< (CryostatID)
+  inline std::ostream& operator<< (std::ostream& out, CryostatID const& cid)
+    { return details::writeID(out, cid); }
 
 
   /// Generic output of OpDetID to stream.
-  inline std::ostream& operator<< (std::ostream& out, OpDetID const& oid) {
-    out << oid.asCryostatID() << " O:" << oid.OpDet;
-    return out;
-  } // operator<< (OpDetID)
+  inline std::ostream& operator<< (std::ostream& out, OpDetID const& oid)
+    { return details::writeID(out, oid); }
 
 
   /// Generic output of TPCID to stream
-  inline std::ostream& operator<< (std::ostream& out, TPCID const& tid) {
-    out << ((CryostatID const&) tid) << " T:" << tid.TPC;
-    return out;
-  } // operator<< (TPCID)
+  inline std::ostream& operator<< (std::ostream& out, TPCID const& tid)
+    { return details::writeID(out, tid); }
 
 
   /// Generic output of PlaneID to stream
-  inline std::ostream& operator<< (std::ostream& out, PlaneID const& pid) {
-    out << ((TPCID const&) pid) << " P:" << pid.Plane;
-    return out;
-  } // operator<< (PlaneID)
+  inline std::ostream& operator<< (std::ostream& out, PlaneID const& pid)
+    { return details::writeID(out, pid); }
 
 
   /// Generic output of WireID to stream
-  inline std::ostream& operator<< (std::ostream& out, WireID const& wid) {
-    out << ((PlaneID const&) wid) << " W:" << wid.Wire;
-    return out;
-  } // operator<< (WireID)
+  inline std::ostream& operator<< (std::ostream& out, WireID const& wid)
+    { return details::writeID(out, wid); }
 
   /// @}
   // Geometry element IDs
@@ -689,6 +850,10 @@ namespace geo {
   /// @{
   /// @name ID comparison operators
   /// @details The result of comparison with invalid IDs is undefined.
+  ///
+  /// When the compiler supports it, `operator<=>` is also provided; it yields
+  /// `std::weak_ordering` because IDs that differ only in validity compare
+  /// equivalent.
 
   /// Comparison: the IDs point to the same cryostat (validity is ignored)
   inline constexpr bool operator== (CryostatID const& a, CryostatID const& b)
@@ -792,6 +957,33 @@ namespace geo {
       return cmp_res < 0;
   } // operator< (WireID, WireID)
 
+#if __cpp_impl_three_way_comparison >= 201907L
+  /// Three-way comparison of cryostat IDs (validity is ignored).
+  inline constexpr std::weak_ordering operator<=>
+    (CryostatID const& a, CryostatID const& b)
+    { return a.cmp(b) <=> 0; }
+
+  /// Three-way comparison of optical detector IDs (validity is ignored).
+  inline constexpr std::weak_ordering operator<=>
+    (OpDetID const& a, OpDetID const& b)
+    { return a.cmp(b) <=> 0; }
+
+  /// Three-way comparison of TPC IDs (validity is ignored).
+  inline constexpr std::weak_ordering operator<=>
+    (TPCID const& a, TPCID const& b)
+    { return a.cmp(b) <=> 0; }
+
+  /// Three-way comparison of plane IDs (validity is ignored).
+  inline constexpr std::weak_ordering operator<=>
+    (PlaneID const& a, PlaneID const& b)
+    { return a.cmp(b) <=> 0; }
+
+  /// Three-way comparison of wire IDs (validity is ignored).
+  inline constexpr std::weak_ordering operator<=>
+    (WireID const& a, WireID const& b)
+    { return a.cmp(b) <=> 0; }
+#endif // __cpp_impl_three_way_comparison
+
   /// @}
 
 
@@ -847,13 +1039,52 @@ namespace geo {
       using type = ID;
     };
     
+    //--------------------------------------------------------------------------
+    constexpr std::uint64_t mixHashBits(std::uint64_t x) {
+      x += 0x9E3779B97F4A7C15ULL;
+      x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+      x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+      return x ^ (x >> 31U);
+    } // mixHashBits()
+    
+    
+    template <typename ID, std::size_t... Levels>
+    constexpr std::size_t hashIDimpl
+      (ID const& id, std::index_sequence<Levels...>)
+    {
+      // each index is added to the scrambled value of the ones above it
+      std::uint64_t h = 0U;
+      ((h = mixHashBits
+        (h + static_cast<std::uint64_t>(id.template getIndex<Levels>()))), ...);
+      return static_cast<std::size_t>(h);
+    } // hashIDimpl()
+    
+    template <typename ID>
+    constexpr std::size_t hashID(ID const& id)
+      { return hashIDimpl(id, std::make_index_sequence<ID::Level + 1U>()); }
+    
+    
+    //--------------------------------------------------------------------------
+    template <typename ID, std::size_t... Levels>
+    constexpr bool hasInvalidIndexImpl
+      (ID const& id, std::index_sequence<Levels...>)
+    {
+      return (... || (id.template getIndex<Levels>()
+        == ID::template ID_t<Levels>::getInvalidID()));
+    } // hasInvalidIndexImpl()
+    
+    /// Returns whether any of the indices of `id` has the invalid value.
+    template <typename ID>
+    constexpr bool hasInvalidIndex(ID const& id) {
+      return
+        hasInvalidIndexImpl(id, std::make_index_sequence<ID::Level + 1U>());
+    } // hasInvalidIndex()
+    
+    
     //--------------------------------------------------------------------------
     template <typename T>
-    inline std::string writeToString(T const& value) {
-      std::ostringstream sstr;
-      sstr << value;
-      return sstr.str();
-    } // writeToString()
+    inline std::string writeToString(T const& value)
+      { return geo::IDstring<T>{ value }.str(); }
     
     
     //--------------------------------------------------------------------------
@@ -862,8 +1093,162 @@ namespace geo {
 
 } // namespace geo
 
+
+//------------------------------------------------------------------------------
+//--- hash functions
+//---
+namespace std {
+  /**
+   * @name Hash functions for geometry IDs
+   *
+   * All the indices of the ID are mixed together by `geo::details::hashID()`,
+   * so that close IDs (e.g. neighbouring wires) get unrelated hash values.
+   * Consistently with the comparison operators, validity is ignored.
+   */
+  /// @{
+  template <>
+  struct hash<geo::CryostatID> {
+    std::size_t operator() (geo::CryostatID const& id) const noexcept
+      { return geo::details::hashID(id); }
+  };
+
+  template <>
+  struct hash<geo::OpDetID> {
+    std::size_t operator() (geo::OpDetID const& id) const noexcept
+      { return geo::details::hashID(id); }
+  };
+
+  template <>
+  struct hash<geo::TPCID> {
+    std::size_t operator() (geo::TPCID const& id) const noexcept
+      { return geo::details::hashID(id); }
+  };
+
+  template <>
+  struct hash<geo::PlaneID> {
+    std::size_t operator() (geo::PlaneID const& id) const noexcept
+      { return geo::details::hashID(id); }
+  };
+
+  template <>
+  struct hash<geo::WireID> {
+    std::size_t operator() (geo::WireID const& id) const noexcept
+      { return geo::details::hashID(id); }
+  };
+  /// @}
+} // namespace std
+
+
 //------------------------------------------------------------------------------
 //--- template implementation
+//------------------------------------------------------------------------------
+template <typename ID>
+std::to_chars_result geo::toChars(char* first, char* last, ID const& id) {
+  if constexpr (!details::isTopGeoElementID<ID>) {
+    std::to_chars_result const res
+      = toChars<typename ID::ParentID_t>(first, last, id.parentID());
+    if (res.ec != std::errc{}) return res;
+    first = res.ptr;
+    if (first == last) return { last, std::errc::value_too_large };
+    *first++ = ' ';
+  }
+  if (last - first < 2) return { last, std::errc::value_too_large };
+  *first++ = details::IDlabel<ID>::value;
+  *first++ = ':';
+  return std::to_chars(first, last, id.deepestIndex());
+} // geo::toChars()
+
+
+//------------------------------------------------------------------------------
+template <typename ID>
+std::from_chars_result geo::details::readIDindices
+  (char const* first, char const* last, ID& id)
+{
+  if constexpr (!isTopGeoElementID<ID>) {
+    std::from_chars_result const res
+      = readIDindices<typename ID::ParentID_t>(first, last, id.parentID());
+    if (res.ec != std::errc{}) return res;
+    first = res.ptr;
+    if ((first == last) || (*first != ' '))
+      return { first, std::errc::invalid_argument };
+    ++first;
+  }
+  if ((last - first < 2) || (first[0] != IDlabel<ID>::value) || (first[1] != ':'))
+    return { first, std::errc::invalid_argument };
+  return std::from_chars(first + 2, last, id.deepestIndex());
+} // geo::details::readIDindices()
+
+
+template <typename ID>
+std::from_chars_result geo::fromChars
+  (char const* first, char const* last, ID& id)
+{
+  std::from_chars_result const res = details::readIDindices(first, last, id);
+  if (res.ec != std::errc{}) return res;
+  
+  id.setValidity(!details::hasInvalidIndex(id));
+  return res;
+} // geo::fromChars()
+
+
+template <typename ID>
+std::optional<ID> geo::parseID(std::string_view text) {
+  char const* const last = text.data() + text.size();
+  ID id;
+  std::from_chars_result const res = fromChars(text.data(), last, id);
+  if ((res.ec != std::errc{}) || (res.ptr != last)) return std::nullopt;
+  return { id };
+} // geo::parseID()
+
+
+//------------------------------------------------------------------------------
+inline bool geo::details::hasDefaultIntegerFormat(std::ostream const& out) {
+  std::ios_base::fmtflags const base = out.flags() & std::ios_base::basefield;
+  if ((base != std::ios_base::dec) && (base != std::ios_base::fmtflags{}))
+    return false;
+  if (out.flags() & (std::ios_base::showbase | std::ios_base::showpos))
+    return false;
+  if (out.width() != 0) return false;
+  // only the classic locale is known not to group digits; any other locale
+  // takes the slower path, which is still correct
+  return out.getloc() == std::locale::classic();
+} // geo::details::hasDefaultIntegerFormat()
+
+
+template <typename ID>
+void geo::details::streamIDindices(std::ostream& out, ID const& id) {
+  if constexpr (isTopGeoElementID<ID>) {
+    char const label[] = { IDlabel<ID>::value, ':', '\0' };
+    out << label;
+  }
+  else {
+    streamIDindices(out, id.parentID());
+    char const label[] = { ' ', IDlabel<ID>::value, ':', '\0' };
+    out << label;
+  }
+  out << id.deepestIndex();
+} // geo::details::streamIDindices()
+
+
+template <typename ID>
+std::ostream& geo::details::writeID(std::ostream& out, ID const& id) {
+  if (hasDefaultIntegerFormat(out)) out << IDstring<ID>{ id }.view();
+  else streamIDindices(out, id);
+  return out;
+} // geo::details::writeID()
+
+
+//------------------------------------------------------------------------------
+template <typename ID>
+geo::IDstring<ID>::IDstring(ID const& id) {
+  // the buffer is large enough for any ID, so this can't fail
+  char* const end
+    = toChars<ID>(fBuffer.data(), fBuffer.data() + MaxLength, id).ptr;
+  *end = '\0';
+  fLength = end - fBuffer.data();
+} // geo::IDstring<>::IDstring()
+
+
 //------------------------------------------------------------------------------
 template <std::size_t Index /* = 0U */>
 constexpr auto geo::CryostatID::getIndex() const {
@@ -0,0 +1,550 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_vector_arrays.h
+ * @brief  Structure-of-arrays collections of geometry vectors.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_vectors.h
+ *
+ * This library depends on ROOT GenVector.
+ * In the CET link list in `CMakeLists.txt`, link to `${ROOT_GENVECTOR}`.
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VECTOR_ARRAYS_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VECTOR_ARRAYS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <iterator> // std::random_access_iterator_tag
+#include <cmath> // std::sqrt()
+#include <type_traits> // std::is_same_v
+#include <stdexcept> // std::length_error
+#include <string> // std::to_string()
+#include <cstddef> // std::size_t, std::ptrdiff_t
+
+
+// BEGIN Geometry group --------------------------------------------------------
+/// @ingroup Geometry
+/// @{
+namespace geo {
+
+  /**
+   * @brief Collection of 3D vectors stored as separate coordinate arrays.
+   * @tparam Vector type of the vector (e.g. `geo::Point_t`)
+   *
+   * The coordinates of all the vectors are stored in three contiguous arrays,
+   * one for each of _x_, _y_ and _z_ ("structure of arrays").
+   * Operations on the whole collection (`translate()`, `rotate()`, and for
+   * displacement vectors `Dot()`, `Mag2()` and `R()`) are written as simple
+   * loops on those arrays, which the compiler can vectorize.
+   *
+   * Single elements are accessed via `get()` and `set()`, or via a proxy
+   * (`operator[]`, iteration) that behaves like `Vector` for reading
+   * (`X()`, `Y()`, `Z()` and conversion to `Vector`) and for assignment.
+   * The iterators are random access, and mutable and constant ones can be
+   * compared with each other; proxies of the same collection can be swapped,
+   * so that algorithms like `std::sort()` and `std::reverse()` work in place.
+   *
+   * The collection can be converted to and from `std::vector<Vector>`:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * std::vector<geo::Point_t> points = ...;
+   * geo::PointArray array { points };
+   * array.translate(geo::Vector_t{ 0.0, 0.0, -5.0 });
+   * points = array.toVector();
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  template <typename Vector>
+  class CoordArray {
+
+      public:
+    using Vector_t = Vector; ///< Type of the vectors in the collection.
+    using Scalar_t = typename Vector_t::Scalar; ///< Type of the coordinates.
+
+    /// Type of displacement vector in the same coordinate system.
+    using Displacement_t = GenVector3DBase_t
+      <Scalar_t, typename Vector_t::CoordinateSystemType>;
+
+    using size_type = std::size_t;
+
+    class reference;
+    class iterator;
+    class const_iterator;
+
+
+    /// Default constructor: an empty collection.
+    CoordArray() = default;
+
+    /// Constructor: `n` vectors with all coordinates set to `0`.
+    explicit CoordArray(size_type n): fX(n), fY(n), fZ(n) {}
+
+    /// Constructor: copies all the vectors from `vectors`.
+    explicit CoordArray(std::vector<Vector_t> const& vectors);
+
+
+    // --- BEGIN -- Element access ---------------------------------------------
+    /// @name Element access
+    /// @{
+
+    /// Returns a copy of the vector at position `i`.
+    Vector_t get(size_type i) const { return { fX[i], fY[i], fZ[i] }; }
+
+    /// Sets the vector at position `i`.
+    void set(size_type i, Vector_t const& v)
+      { fX[i] = v.X(); fY[i] = v.Y(); fZ[i] = v.Z(); }
+
+    /// Returns a copy of the vector at position `i`.
+    Vector_t operator[] (size_type i) const { return get(i); }
+
+    /// Returns a proxy to the vector at position `i`.
+    reference operator[] (size_type i) { return { *this, i }; }
+
+    /// Returns the array of the _x_ coordinates.
+    Scalar_t const* xData() const { return fX.data(); }
+    /// Returns the array of the _x_ coordinates.
+    Scalar_t* xData() { return fX.data(); }
+
+    /// Returns the array of the _y_ coordinates.
+    Scalar_t const* yData() const { return fY.data(); }
+    /// Returns the array of the _y_ coordinates.
+    Scalar_t* yData() { return fY.data(); }
+
+    /// Returns the array of the _z_ coordinates.
+    Scalar_t const* zData() const { return fZ.data(); }
+    /// Returns the array of the _z_ coordinates.
+    Scalar_t* zData() { return fZ.data(); }
+
+    /// @}
+    // --- END -- Element access -----------------------------------------------
+
+
+    // --- BEGIN -- Iteration --------------------------------------------------
+    /// @name Iteration
+    /// @{
+
+    iterator begin() { return { *this, 0U }; }
+    iterator end() { return { *this, size() }; }
+    const_iterator begin() const { return { *this, 0U }; }
+    const_iterator end() const { return { *this, size() }; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    /// @}
+    // --- END -- Iteration ----------------------------------------------------
+
+
+    // --- BEGIN -- Size -------------------------------------------------------
+    /// @name Size
+    /// @{
+
+    /// Returns the number of vectors in the collection.
+    size_type size() const { return fX.size(); }
+
+    /// Returns whether the collection is empty.
+    bool empty() const { return fX.empty(); }
+
+    /// Prepares the collection to host `n` vectors.
+    void reserve(size_type n) { fX.reserve(n); fY.reserve(n); fZ.reserve(n); }
+
+    /// Changes the number of vectors; new ones have all coordinates `0`.
+    void resize(size_type n) { fX.resize(n); fY.resize(n); fZ.resize(n); }
+
+    /// Removes all the vectors.
+    void clear() { fX.clear(); fY.clear(); fZ.clear(); }
+
+    /// @}
+    // --- END -- Size ---------------------------------------------------------
+
+
+    // --- BEGIN -- Insertion and conversion -----------------------------------
+    /// @name Insertion and conversion
+    /// @{
+
+    /// Appends a vector at the end of the collection.
+    void push_back(Vector_t const& v)
+      { fX.push_back(v.X()); fY.push_back(v.Y()); fZ.push_back(v.Z()); }
+
+    /// Appends a vector with the specified coordinates.
+    void emplace_back(Scalar_t x, Scalar_t y, Scalar_t z)
+      { fX.push_back(x); fY.push_back(y); fZ.push_back(z); }
+
+    /// Replaces the content of the collection with a copy of `vectors`.
+    void assign(std::vector<Vector_t> const& vectors);
+
+    /// Returns a copy of all the vectors, as a `std::vector`.
+    std::vector<Vector_t> toVector() const;
+
+    /// @}
+    // --- END -- Insertion and conversion -------------------------------------
+
+
+    // --- BEGIN -- Bulk operations --------------------------------------------
+    /// @name Bulk operations
+    /// @{
+
+    /// Adds `shift` to all the vectors.
+    void translate(Displacement_t const& shift);
+
+    /// Applies `rot` to all the vectors.
+    void rotate(Rotation_t const& rot);
+
+    /// Returns the dot product of each vector with the one in `other`.
+    /// @throws std::length_error if `other` has a different size
+    template <typename V = Vector_t>
+    std::vector<Scalar_t> Dot(CoordArray const& other) const;
+
+    /// Returns the dot product of each vector with `v`.
+    template <typename V = Vector_t>
+    std::vector<Scalar_t> Dot(Vector_t const& v) const;
+
+    /// Returns the square of the magnitude of each vector.
+    template <typename V = Vector_t>
+    std::vector<Scalar_t> Mag2() const;
+
+    /// Returns the magnitude of each vector.
+    template <typename V = Vector_t>
+    std::vector<Scalar_t> R() const;
+
+    /// @}
+    // --- END -- Bulk operations ----------------------------------------------
+
+
+      private:
+    std::vector<Scalar_t> fX; ///< _x_ coordinates.
+    std::vector<Scalar_t> fY; ///< _y_ coordinates.
+    std::vector<Scalar_t> fZ; ///< _z_ coordinates.
+
+    /// Whether `V` is a displacement vector (dot product is defined).
+    template <typename V>
+    static constexpr bool isDisplacement = std::is_same_v<V, Displacement_t>;
+
+    /// Applies the rotation matrix `m` to the coordinates, which must not
+    /// overlap (they are declared `__restrict` so that the loop vectorizes).
+    static void rotateCoords(std::array<double, 9U> const& m, size_type n,
+      Scalar_t* __restrict x, Scalar_t* __restrict y, Scalar_t* __restrict z);
+
+  }; // class CoordArray<>
+
+
+  //----------------------------------------------------------------------------
+  /// Proxy to a vector stored in a `geo::CoordArray`.
+  template <typename Vector>
+  class CoordArray<Vector>::reference {
+      public:
+    reference(CoordArray& array, size_type i): fArray(&array), fIndex(i) {}
+
+    Scalar_t X() const { return fArray->fX[fIndex]; } ///< Returns _x_.
+    Scalar_t Y() const { return fArray->fY[fIndex]; } ///< Returns _y_.
+    Scalar_t Z() const { return fArray->fZ[fIndex]; } ///< Returns _z_.
+
+    /// Sets all the coordinates of the vector.
+    reference& SetXYZ(Scalar_t x, Scalar_t y, Scalar_t z)
+      {
+        fArray->fX[fIndex] = x; fArray->fY[fIndex] = y; fArray->fZ[fIndex] = z;
+        return *this;
+      }
+
+    /// Assigns the value of `v` to the vector.
+    reference& operator= (Vector_t const& v)
+      { fArray->set(fIndex, v); return *this; }
+
+    /// Assigns the value of another vector in a collection.
+    reference& operator= (reference const& other)
+      { return *this = other.get(); }
+
+    /// Returns a copy of the vector.
+    Vector_t get() const { return fArray->get(fIndex); }
+
+    /// Conversion to a copy of the vector.
+    operator Vector_t() const { return get(); }
+
+    /// Swaps the values of the two referenced vectors (for `std::iter_swap`).
+    friend void swap(reference a, reference b)
+      { Vector_t const tmp = a.get(); a = b.get(); b = tmp; }
+
+      private:
+    CoordArray* fArray; ///< Collection the vector belongs to.
+    size_type fIndex; ///< Position of the vector in the collection.
+  }; // class CoordArray<>::reference
+
+
+  //----------------------------------------------------------------------------
+  /// Iterator to the vectors of a `geo::CoordArray`, dereferencing to proxies.
+  template <typename Vector>
+  class CoordArray<Vector>::iterator {
+      public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Vector_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = typename CoordArray::reference;
+    using pointer = void;
+
+    iterator() = default;
+    iterator(CoordArray& array, size_type i): fArray(&array), fIndex(i) {}
+
+    reference operator* () const { return { *fArray, fIndex }; }
+    reference operator[] (difference_type n) const
+      { return { *fArray, fIndex + n }; }
+
+    iterator& operator++ () { ++fIndex; return *this; }
+    iterator& operator-- () { --fIndex; return *this; }
+    iterator operator++ (int) { auto old = *this; ++fIndex; return old; }
+    iterator operator-- (int) { auto old = *this; --fIndex; return old; }
+    iterator& operator+= (difference_type n) { fIndex += n; return *this; }
+    iterator& operator-= (difference_type n) { fIndex -= n; return *this; }
+    iterator operator+ (difference_type n) const
+      { return { *fArray, fIndex + n }; }
+    iterator operator- (difference_type n) const
+      { return { *fArray, fIndex - n }; }
+    friend iterator operator+ (difference_type n, iterator const& it)
+      { return it + n; }
+    friend difference_type operator- (iterator const& a, iterator const& b)
+      { return difference_type(a.fIndex) - difference_type(b.fIndex); }
+
+    friend bool operator== (iterator const& a, iterator const& b)
+      { return a.fIndex == b.fIndex; }
+    friend bool operator!= (iterator const& a, iterator const& b)
+      { return a.fIndex != b.fIndex; }
+    friend bool operator< (iterator const& a, iterator const& b)
+      { return a.fIndex < b.fIndex; }
+    friend bool operator> (iterator const& a, iterator const& b)
+      { return a.fIndex > b.fIndex; }
+    friend bool operator<= (iterator const& a, iterator const& b)
+      { return a.fIndex <= b.fIndex; }
+    friend bool operator>= (iterator const& a, iterator const& b)
+      { return a.fIndex >= b.fIndex; }
+
+      private:
+    friend class CoordArray::const_iterator;
+
+    CoordArray* fArray = nullptr;
+    size_type fIndex = 0U;
+  }; // class CoordArray<>::iterator
+
+
+  //----------------------------------------------------------------------------
+  /// Iterator to the vectors of a `geo::CoordArray`, dereferencing to copies.
+  template <typename Vector>
+  class CoordArray<Vector>::const_iterator {
+      public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Vector_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = Vector_t;
+    using pointer = void;
+
+    const_iterator() = default;
+    const_iterator(CoordArray const& array, size_type i)
+      : fArray(&array), fIndex(i) {}
+
+    /// Conversion from a mutable iterator.
+    const_iterator(iterator const& it): fArray(it.fArray), fIndex(it.fIndex) {}
+
+    Vector_t operator* () const { return fArray->get(fIndex); }
+    Vector_t operator[] (difference_type n) const
+      { return fArray->get(fIndex + n); }
+
+    const_iterator& operator++ () { ++fIndex; return *this; }
+    const_iterator& operator-- () { --fIndex; return *this; }
+    const_iterator operator++ (int) { auto old = *this; ++fIndex; return old; }
+    const_iterator operator-- (int) { auto old = *this; --fIndex; return old; }
+    const_iterator& operator+= (difference_type n)
+      { fIndex += n; return *this; }
+    const_iterator& operator-= (difference_type n)
+      { fIndex -= n; return *this; }
+    const_iterator operator+ (difference_type n) const
+      { return { *fArray, fIndex + n }; }
+    const_iterator operator- (difference_type n) const
+      { return { *fArray, fIndex - n }; }
+
+    // the operators below also apply to a mixture with mutable iterators
+    friend const_iterator operator+
+      (difference_type n, const_iterator const& it)
+      { return it + n; }
+    friend difference_type operator-
+      (const_iterator const& a, const_iterator const& b)
+      { return difference_type(a.fIndex) - difference_type(b.fIndex); }
+
+    friend bool operator== (const_iterator const& a, const_iterator const& b)
+      { return a.fIndex == b.fIndex; }
+    friend bool operator!= (const_iterator const& a, const_iterator const& b)
+      { return a.fIndex != b.fIndex; }
+    friend bool operator< (const_iterator const& a, const_iterator const& b)
+      { return a.fIndex < b.fIndex; }
+    friend bool operator> (const_iterator const& a, const_iterator const& b)
+      { return a.fIndex > b.fIndex; }
+    friend bool operator<= (const_iterator const& a, const_iterator const& b)
+      { return a.fIndex <= b.fIndex; }
+    friend bool operator>= (const_iterator const& a, const_iterator const& b)
+      { return a.fIndex >= b.fIndex; }
+
+      private:
+    CoordArray const* fArray = nullptr;
+    size_type fIndex = 0U;
+  }; // class CoordArray<>::const_iterator
+
+
+  //----------------------------------------------------------------------------
+  /// @{
+  /// @name Collections of standard LArSoft vectors
+
+  /// Collection of `geo::Point_t`, stored as separate coordinate arrays.
+  using PointArray = CoordArray<Point_t>;
+
+  /// Collection of `geo::Vector_t`, stored as separate coordinate arrays.
+  using VectorArray = CoordArray<Vector_t>;
+
+  /// Collection of `geo::PointF_t`, stored as separate coordinate arrays.
+  using PointFArray = CoordArray<PointF_t>;
+
+  /// Collection of `geo::VectorF_t`, stored as separate coordinate arrays.
+  using VectorFArray = CoordArray<VectorF_t>;
+
+  /// @}
+
+} // namespace geo
+/// @}
+// END Geometry group ----------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+template <typename Vector>
+geo::CoordArray<Vector>::CoordArray(std::vector<Vector_t> const& vectors)
+  { assign(vectors); }
+
+
+//------------------------------------------------------------------------------
+template <typename Vector>
+void geo::CoordArray<Vector>::assign(std::vector<Vector_t> const& vectors) {
+  size_type const n = vectors.size();
+  resize(n);
+  for (size_type i = 0; i < n; ++i) set(i, vectors[i]);
+} // geo::CoordArray<>::assign()
+
+
+//------------------------------------------------------------------------------
+template <typename Vector>
+auto geo::CoordArray<Vector>::toVector() const -> std::vector<Vector_t> {
+  std::vector<Vector_t> vectors;
+  vectors.reserve(size());
+  for (size_type i = 0; i < size(); ++i) vectors.push_back(get(i));
+  return vectors;
+} // geo::CoordArray<>::toVector()
+
+
+//------------------------------------------------------------------------------
+template <typename Vector>
+void geo::CoordArray<Vector>::translate(Displacement_t const& shift) {
+  Scalar_t const dx = shift.X(), dy = shift.Y(), dz = shift.Z();
+  size_type const n = size();
+  Scalar_t* const x = fX.data();
+  Scalar_t* const y = fY.data();
+  Scalar_t* const z = fZ.data();
+  for (size_type i = 0; i < n; ++i) x[i] += dx;
+  for (size_type i = 0; i < n; ++i) y[i] += dy;
+  for (size_type i = 0; i < n; ++i) z[i] += dz;
+} // geo::CoordArray<>::translate()
+
+
+//------------------------------------------------------------------------------
+template <typename Vector>
+void geo::CoordArray<Vector>::rotate(Rotation_t const& rot) {
+  std::array<double, 9U> m;
+  rot.GetComponents(m.begin());
+  rotateCoords(m, size(), fX.data(), fY.data(), fZ.data());
+} // geo::CoordArray<>::rotate()
+
+
+template <typename Vector>
+void geo::CoordArray<Vector>::rotateCoords(
+  std::array<double, 9U> const& m, size_type n,
+  Scalar_t* __restrict x, Scalar_t* __restrict y, Scalar_t* __restrict z
+) {
+  std::array<double, 9U> const k = m; // local copy, not aliased by the arrays
+  for (size_type i = 0; i < n; ++i) {
+    double const vx = x[i], vy = y[i], vz = z[i];
+    x[i] = static_cast<Scalar_t>(k[0] * vx + k[1] * vy + k[2] * vz);
+    y[i] = static_cast<Scalar_t>(k[3] * vx + k[4] * vy + k[5] * vz);
+    z[i] = static_cast<Scalar_t>(k[6] * vx + k[7] * vy + k[8] * vz);
+  } // for
+} // geo::CoordArray<>::rotateCoords()
+
+
+//------------------------------------------------------------------------------
+template <typename Vector>
+template <typename V>
+auto geo::CoordArray<Vector>::Dot(CoordArray const& other) const
+  -> std::vector<Scalar_t>
+{
+  static_assert(isDisplacement<V>, "Dot product is defined only for vectors.");
+  size_type const n = size();
+  if (other.size() != n) {
+    throw std::length_error("geo::CoordArray::Dot(): arrays of "
+      + std::to_string(n) + " and " + std::to_string(other.size())
+      + " vectors");
+  }
+  std::vector<Scalar_t> res(n);
+  Scalar_t const* const x = fX.data();
+  Scalar_t const* const y = fY.data();
+  Scalar_t const* const z = fZ.data();
+  Scalar_t const* const ox = other.fX.data();
+  Scalar_t const* const oy = other.fY.data();
+  Scalar_t const* const oz = other.fZ.data();
+  Scalar_t* const r = res.data();
+  for (size_type i = 0; i < n; ++i)
+    r[i] = x[i] * ox[i] + y[i] * oy[i] + z[i] * oz[i];
+  return res;
+} // geo::CoordArray<>::Dot(CoordArray)
+
+
+template <typename Vector>
+template <typename V>
+auto geo::CoordArray<Vector>::Dot(Vector_t const& v) const
+  -> std::vector<Scalar_t>
+{
+  static_assert(isDisplacement<V>, "Dot product is defined only for vectors.");
+  Scalar_t const vx = v.X(), vy = v.Y(), vz = v.Z();
+  size_type const n = size();
+  std::vector<Scalar_t> res(n);
+  Scalar_t const* const x = fX.data();
+  Scalar_t const* const y = fY.data();
+  Scalar_t const* const z = fZ.data();
+  Scalar_t* const r = res.data();
+  for (size_type i = 0; i < n; ++i) r[i] = x[i] * vx + y[i] * vy + z[i] * vz;
+  return res;
+} // geo::CoordArray<>::Dot(Vector_t)
+
+
+//------------------------------------------------------------------------------
+template <typename Vector>
+template <typename V>
+auto geo::CoordArray<Vector>::Mag2() const -> std::vector<Scalar_t> {
+  static_assert(isDisplacement<V>, "Magnitude is defined only for vectors.");
+  size_type const n = size();
+  std::vector<Scalar_t> res(n);
+  Scalar_t const* const x = fX.data();
+  Scalar_t const* const y = fY.data();
+  Scalar_t const* const z = fZ.data();
+  Scalar_t* const r = res.data();
+  for (size_type i = 0; i < n; ++i)
+    r[i] = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+  return res;
+} // geo::CoordArray<>::Mag2()
+
+
+template <typename Vector>
+template <typename V>
+auto geo::CoordArray<Vector>::R() const -> std::vector<Scalar_t> {
+  std::vector<Scalar_t> res = Mag2<V>();
+  for (Scalar_t& r: res) r = std::sqrt(r);
+  return res;
+} // geo::CoordArray<>::R()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VECTOR_ARRAYS_H
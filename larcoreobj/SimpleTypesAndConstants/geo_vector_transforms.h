@@ -0,0 +1,263 @@
+/**
+ * @file   larcoreobj/SimpleTypesAndConstants/geo_vector_transforms.h
+ * @brief  Rotation and translation of batches of geometry points.
+ * @date   October 18, 2026
+ * @ingroup Geometry
+ * @see    larcoreobj/SimpleTypesAndConstants/geo_vectors.h
+ *         larcoreobj/SimpleTypesAndConstants/geo_vector_arrays.h
+ *
+ * This library depends on ROOT GenVector.
+ * In the CET link list in `CMakeLists.txt`, link to `${ROOT_GENVECTOR}`.
+ */
+
+#ifndef LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VECTOR_TRANSFORMS_H
+#define LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VECTOR_TRANSFORMS_H
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vector_arrays.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <array>
+#include <cstddef> // std::size_t
+
+
+// BEGIN Geometry group --------------------------------------------------------
+/// @ingroup Geometry
+/// @{
+namespace geo {
+
+  /**
+   * @brief Applies a rotation and then a translation to a batch of points.
+   * @tparam T type of the coordinates
+   * @param rot rotation to apply
+   * @param shift translation to apply after the rotation
+   * @param n number of points in the batch
+   * @param x (input) array of the _x_ coordinates of the points
+   * @param y (input) array of the _y_ coordinates of the points
+   * @param z (input) array of the _z_ coordinates of the points
+   * @param outX (output) array for the _x_ coordinates of the results
+   * @param outY (output) array for the _y_ coordinates of the results
+   * @param outZ (output) array for the _z_ coordinates of the results
+   *
+   * Each point `p` becomes `rot * p + shift`. The operations are the same
+   * and in the same order as GenVector's, so the results are the same as
+   * `rot * p + shift` computed on single `geo::Point_t` objects.
+   * The computation is performed in double precision.
+   *
+   * @note Each output array must either be the same as its own input
+   *       array (in place transformation) or share no element with any of
+   *       the other arrays; in particular, if one output array is the same as
+   *       its input, all of them must be. The two cases are dispatched to
+   *       loops declaring the arrays `__restrict`, so that the compiler can
+   *       vectorize them without runtime overlap checks: any other overlap is
+   *       undefined behaviour.
+   */
+  template <typename T>
+  void transformCoords(
+    Rotation_t const& rot, Vector_t const& shift, std::size_t n,
+    T const* x, T const* y, T const* z,
+    T* outX, T* outY, T* outZ
+    );
+
+  /**
+   * @brief Applies a rotation and then a translation to a batch of points.
+   * @tparam Point type of the points
+   * @param rot rotation to apply
+   * @param shift translation to apply after the rotation
+   * @param n number of points in the batch
+   * @param points (input) array of points
+   * @param out (output) array for the transformed points
+   *
+   * This is the equivalent of `transformCoords()` for an array of point
+   * objects. `out` must either be the same as `points` or not overlap it
+   * (see the note in `transformCoords()`).
+   */
+  template <typename Point>
+  void transformPoints(
+    Rotation_t const& rot, Vector_t const& shift, std::size_t n,
+    Point const* points, Point* out
+    );
+
+  /// Applies a rotation and then a translation to all `points`, in place.
+  /// @see `transformCoords()`
+  template <typename Point>
+  void transformPoints
+    (Rotation_t const& rot, Vector_t const& shift, std::vector<Point>& points)
+    { transformPoints(rot, shift, points.size(), points.data(), points.data()); }
+
+  /// Applies a rotation and then a translation to all `points`, in place.
+  /// @see `transformCoords()`
+  template <typename Point>
+  void transformPoints
+    (Rotation_t const& rot, Vector_t const& shift, CoordArray<Point>& points);
+
+
+  namespace details {
+
+    /// Coefficients of a rotation followed by a translation.
+    struct AffineCoeffs {
+      double xx, xy, xz, yx, yy, yz, zx, zy, zz; ///< Rotation matrix.
+      double dx, dy, dz; ///< Translation.
+
+      AffineCoeffs(Rotation_t const& rot, Vector_t const& shift);
+    }; // AffineCoeffs
+
+    /// `geo::transformCoords()` with each output the same as its input.
+    template <typename T>
+    void transformCoordsInPlace(AffineCoeffs const& c, std::size_t n,
+      T* __restrict x, T* __restrict y, T* __restrict z);
+
+    /// `geo::transformCoords()` with no array overlapping another.
+    template <typename T>
+    void transformCoordsDisjoint(AffineCoeffs const& c, std::size_t n,
+      T const* __restrict x, T const* __restrict y, T const* __restrict z,
+      T* __restrict outX, T* __restrict outY, T* __restrict outZ);
+
+    /// `geo::transformPoints()` with the output the same as the input.
+    template <typename Point>
+    void transformPointsInPlace
+      (AffineCoeffs const& c, std::size_t n, Point* __restrict points);
+
+    /// `geo::transformPoints()` with the output not overlapping the input.
+    template <typename Point>
+    void transformPointsDisjoint(AffineCoeffs const& c, std::size_t n,
+      Point const* __restrict points, Point* __restrict out);
+
+  } // namespace details
+
+} // namespace geo
+/// @}
+// END Geometry group ----------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+//--- template implementation
+//------------------------------------------------------------------------------
+inline geo::details::AffineCoeffs::AffineCoeffs
+  (Rotation_t const& rot, Vector_t const& shift)
+  : dx(shift.X()), dy(shift.Y()), dz(shift.Z())
+{
+  std::array<double, 9U> m;
+  rot.GetComponents(m.begin());
+  xx = m[0]; xy = m[1]; xz = m[2];
+  yx = m[3]; yy = m[4]; yz = m[5];
+  zx = m[6]; zy = m[7]; zz = m[8];
+} // geo::details::AffineCoeffs::AffineCoeffs()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void geo::details::transformCoordsInPlace(AffineCoeffs const& c, std::size_t n,
+  T* __restrict x, T* __restrict y, T* __restrict z)
+{
+  AffineCoeffs const k = c; // local copy, not aliased by the coordinates
+  for (std::size_t i = 0; i < n; ++i) {
+    double const vx = x[i], vy = y[i], vz = z[i];
+    x[i] = static_cast<T>((k.xx * vx + k.xy * vy + k.xz * vz) + k.dx);
+    y[i] = static_cast<T>((k.yx * vx + k.yy * vy + k.yz * vz) + k.dy);
+    z[i] = static_cast<T>((k.zx * vx + k.zy * vy + k.zz * vz) + k.dz);
+  } // for
+} // geo::details::transformCoordsInPlace()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void geo::details::transformCoordsDisjoint(AffineCoeffs const& c,
+  std::size_t n,
+  T const* __restrict x, T const* __restrict y, T const* __restrict z,
+  T* __restrict outX, T* __restrict outY, T* __restrict outZ)
+{
+  AffineCoeffs const k = c; // local copy, not aliased by the coordinates
+  for (std::size_t i = 0; i < n; ++i) {
+    double const vx = x[i], vy = y[i], vz = z[i];
+    outX[i] = static_cast<T>((k.xx * vx + k.xy * vy + k.xz * vz) + k.dx);
+    outY[i] = static_cast<T>((k.yx * vx + k.yy * vy + k.yz * vz) + k.dy);
+    outZ[i] = static_cast<T>((k.zx * vx + k.zy * vy + k.zz * vz) + k.dz);
+  } // for
+} // geo::details::transformCoordsDisjoint()
+
+
+//------------------------------------------------------------------------------
+template <typename Point>
+void geo::details::transformPointsInPlace
+  (AffineCoeffs const& c, std::size_t n, Point* __restrict points)
+{
+  using Scalar_t = typename Point::Scalar;
+
+  AffineCoeffs const k = c; // local copy, not aliased by the points
+  for (std::size_t i = 0; i < n; ++i) {
+    double const vx = points[i].X(), vy = points[i].Y(), vz = points[i].Z();
+    points[i].SetXYZ(
+      static_cast<Scalar_t>((k.xx * vx + k.xy * vy + k.xz * vz) + k.dx),
+      static_cast<Scalar_t>((k.yx * vx + k.yy * vy + k.yz * vz) + k.dy),
+      static_cast<Scalar_t>((k.zx * vx + k.zy * vy + k.zz * vz) + k.dz)
+      );
+  } // for
+} // geo::details::transformPointsInPlace()
+
+
+//------------------------------------------------------------------------------
+template <typename Point>
+void geo::details::transformPointsDisjoint(AffineCoeffs const& c,
+  std::size_t n, Point const* __restrict points, Point* __restrict out)
+{
+  using Scalar_t = typename Point::Scalar;
+
+  AffineCoeffs const k = c; // local copy, not aliased by the points
+  for (std::size_t i = 0; i < n; ++i) {
+    double const vx = points[i].X(), vy = points[i].Y(), vz = points[i].Z();
+    out[i].SetXYZ(
+      static_cast<Scalar_t>((k.xx * vx + k.xy * vy + k.xz * vz) + k.dx),
+      static_cast<Scalar_t>((k.yx * vx + k.yy * vy + k.yz * vz) + k.dy),
+      static_cast<Scalar_t>((k.zx * vx + k.zy * vy + k.zz * vz) + k.dz)
+      );
+  } // for
+} // geo::details::transformPointsDisjoint()
+
+
+//------------------------------------------------------------------------------
+template <typename T>
+void geo::transformCoords(
+  Rotation_t const& rot, Vector_t const& shift, std::size_t n,
+  T const* x, T const* y, T const* z,
+  T* outX, T* outY, T* outZ
+) {
+  details::AffineCoeffs const coeffs { rot, shift };
+  if (outX == x) // in place (by precondition, all three)
+    details::transformCoordsInPlace(coeffs, n, outX, outY, outZ);
+  else
+    details::transformCoordsDisjoint(coeffs, n, x, y, z, outX, outY, outZ);
+} // geo::transformCoords()
+
+
+//------------------------------------------------------------------------------
+template <typename Point>
+void geo::transformPoints(
+  Rotation_t const& rot, Vector_t const& shift, std::size_t n,
+  Point const* points, Point* out
+) {
+  details::AffineCoeffs const coeffs { rot, shift };
+  if (out == points) // in place
+    details::transformPointsInPlace(coeffs, n, out);
+  else
+    details::transformPointsDisjoint(coeffs, n, points, out);
+} // geo::transformPoints(Point*)
+
+
+//------------------------------------------------------------------------------
+template <typename Point>
+void geo::transformPoints
+  (Rotation_t const& rot, Vector_t const& shift, CoordArray<Point>& points)
+{
+  transformCoords(rot, shift, points.size(),
+    points.xData(), points.yData(), points.zData(),
+    points.xData(), points.yData(), points.zData()
+    );
+} // geo::transformPoints(CoordArray)
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_SIMPLETYPESANDCONSTANTS_GEO_VECTOR_TRANSFORMS_H
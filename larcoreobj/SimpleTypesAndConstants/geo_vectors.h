@@ -124,11 +124,13 @@ namespace geo {
    * using LocalPoint_t = geo::Point3DBase_t<LocalCoordinateTag>;
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    * (`geo::Vector3DBase_t` is also available).
-   * If a single precision vector is desired, the most general
+   * If a single precision vector is desired, `geo::PointF_t` and
+   * `geo::VectorF_t` are provided, together with the explicit conversions
+   * `geo::toPointF()`, `geo::toVectorF()` (narrowing) and `geo::toPoint()`,
+   * `geo::toVector()` (widening). For other combinations, the most general
    * `geo::GenPoint3DBase_t` and `geo::GenVector3DBase_t` are also available:
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
-   * using PointF_t = geo::GenPoint3DBase_t<float>;
-   * using VectorF_t = geo::GenVector3DBase_t<float>;
+   * using LocalPointF_t = geo::GenPoint3DBase_t<float, LocalCoordinateTag>;
    * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
    *
    */
@@ -184,6 +186,37 @@ namespace geo {
      <ROOT::Math::Cartesian3D<double>, ROOT::Math::GlobalCoordinateSystemTag>;
 
 
+  /**
+   * @brief Type for representation of momenta in 3D space, single precision.
+   *
+   * This vector is equivalent to `geo::Vector_t`, but its coordinates are
+   * stored as `float`, which halves the memory it takes.
+   * It is meant for large collections whose precision needs are well within
+   * single precision; computations are better performed with `geo::Vector_t`.
+   *
+   * @see `geo::toVectorF()`, `geo::toVector()`
+   */
+  // the actual definition commented out is not understood by GenReflex
+//  using VectorF_t = GenVector3DBase_t<float, GlobalCoords>;
+  using VectorF_t = ROOT::Math::DisplacementVector3D
+    <ROOT::Math::Cartesian3D<float>, ROOT::Math::GlobalCoordinateSystemTag>;
+
+  /**
+   * @brief Type for representation of position in 3D space, single precision.
+   *
+   * This point is equivalent to `geo::Point_t`, but its coordinates are
+   * stored as `float`, which halves the memory it takes.
+   * It is meant for large collections whose precision needs are well within
+   * single precision; computations are better performed with `geo::Point_t`.
+   *
+   * @see `geo::toPointF()`, `geo::toPoint()`
+   */
+  // the actual definition commented out is not understood by GenReflex
+//  using PointF_t = GenPoint3DBase_t<float, GlobalCoords>;
+  using PointF_t = ROOT::Math::PositionVector3D
+    <ROOT::Math::Cartesian3D<float>, ROOT::Math::GlobalCoordinateSystemTag>;
+
+
   /**
    * @brief Type for representation of momenta in 3D space.
    * @tparam CoordSystemTag the coordinate system tag for this vector
@@ -229,6 +262,34 @@ namespace geo {
   /// @}
 
 
+  /// @{
+  /// @name Conversions between single and double precision vectors.
+
+  /// Returns a single precision copy of `p` (precision may be lost).
+  inline PointF_t toPointF(Point_t const& p)
+    {
+      return { static_cast<float>(p.X()), static_cast<float>(p.Y()),
+        static_cast<float>(p.Z()) };
+    }
+
+  /// Returns a single precision copy of `v` (precision may be lost).
+  inline VectorF_t toVectorF(Vector_t const& v)
+    {
+      return { static_cast<float>(v.X()), static_cast<float>(v.Y()),
+        static_cast<float>(v.Z()) };
+    }
+
+  /// Returns a double precision copy of `p` (no precision is lost).
+  inline Point_t toPoint(PointF_t const& p)
+    { return { p.X(), p.Y(), p.Z() }; }
+
+  /// Returns a double precision copy of `v` (no precision is lost).
+  inline Vector_t toVector(VectorF_t const& v)
+    { return { v.X(), v.Y(), v.Z() }; }
+
+  /// @}
+
+
   //----------------------------------------------------------------------------
 
 } // namespace geo
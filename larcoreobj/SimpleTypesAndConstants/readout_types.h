@@ -13,6 +13,7 @@
 
 // C/C++ standard libraries
 #include <iosfwd> // std::ostream
+#include <functional> // std::hash
 
 
 namespace readout {
@@ -298,27 +299,76 @@ namespace readout {
       return cmp_res < 0;
   } // operator< (ROPID, ROPID)
 
+#if __cpp_impl_three_way_comparison >= 201907L
+  /// Three-way comparison of TPC set IDs (validity is ignored).
+  inline constexpr std::weak_ordering operator<=>
+    (TPCsetID const& a, TPCsetID const& b)
+    { return a.cmp(b) <=> 0; }
+
+  /// Three-way comparison of readout plane IDs (validity is ignored).
+  inline constexpr std::weak_ordering operator<=>
+    (ROPID const& a, ROPID const& b)
+    { return a.cmp(b) <=> 0; }
+#endif // __cpp_impl_three_way_comparison
+
   /// @}
 
 
+} // namespace readout
+
+
+// labels of the readout IDs for their string representation (`geo::toChars()`)
+namespace geo::details {
+  template <> struct IDlabel<readout::TPCsetID>
+    { static constexpr char value = 'S'; };
+  template <> struct IDlabel<readout::ROPID>
+    { static constexpr char value = 'R'; };
+} // namespace geo::details
+
+
+namespace readout {
+
   //----------------------------------------------------------------------------
   //--- ID output operators
   //---
+  using geo::toChars;
+  using geo::IDstring;
+  using geo::fromChars;
+  using geo::parseID;
+
   /// Generic output of TPCsetID to stream
-  inline std::ostream& operator<< (std::ostream& out, TPCsetID const& sid) {
-    out << sid.asCryostatID() << " S:" << sid.TPCset;
-    return out;
-  } // operator<< (TPCsetID)
+  inline std::ostream& operator<< (std::ostream& out, TPCsetID const& sid)
+    { return geo::details::writeID(out, sid); }
 
-  inline std::ostream& operator<< (std::ostream& out, ROPID const& rid) {
-    out << rid.asTPCsetID() << " R:" << rid.ROP;
-    return out;
-  } // operator<< (ROPID)
+  /// Generic output of ROPID to stream
+  inline std::ostream& operator<< (std::ostream& out, ROPID const& rid)
+    { return geo::details::writeID(out, rid); }
 
 
 } // namespace readout
 
 
+//------------------------------------------------------------------------------
+//--- hash functions
+//---
+namespace std {
+  /// @name Hash functions for readout IDs (see `geo::details::hashID()`)
+  /// @{
+  template <>
+  struct hash<readout::TPCsetID> {
+    std::size_t operator() (readout::TPCsetID const& id) const noexcept
+      { return geo::details::hashID(id); }
+  };
+
+  template <>
+  struct hash<readout::ROPID> {
+    std::size_t operator() (readout::ROPID const& id) const noexcept
+      { return geo::details::hashID(id); }
+  };
+  /// @}
+} // namespace std
+
+
 //------------------------------------------------------------------------------
 //--- template implementation
 //------------------------------------------------------------------------------
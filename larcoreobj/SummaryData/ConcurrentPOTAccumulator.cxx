@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////
+/// \file larcoreobj/SummaryData/ConcurrentPOTAccumulator.cxx
+///
+/// Thread-safe accumulation of `sumdata::POTSummary` information
+///
+////////////////////////////////////////////////////////////////////////
+
+#include "larcoreobj/SummaryData/ConcurrentPOTAccumulator.h"
+
+#include <algorithm> // std::max()
+
+namespace {
+
+  /// Adds `value` to an atomic floating point variable.
+  void atomicAdd(std::atomic<double>& var, double value) {
+    double current = var.load(std::memory_order_relaxed);
+    while (!var.compare_exchange_weak
+      (current, current + value, std::memory_order_relaxed))
+      ;
+  } // atomicAdd()
+
+  /// Returns a number identifying the current thread: 0, 1, 2...
+  std::size_t threadSlot() {
+    static std::atomic<std::size_t> nextSlot { 0U };
+    thread_local std::size_t const slot
+      = nextSlot.fetch_add(1U, std::memory_order_relaxed);
+    return slot;
+  } // threadSlot()
+
+} // local namespace
+
+
+namespace sumdata {
+
+  //----------------------------------------------------------------------------
+  ConcurrentPOTAccumulator::ConcurrentPOTAccumulator(std::size_t nShards)
+    : fNShards(std::max(nShards, std::size_t(1U)))
+    , fShards(new Shard[fNShards])
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  void ConcurrentPOTAccumulator::add(POTSummary const& summary) {
+    Shard& shard = threadShard();
+    atomicAdd(shard.totpot, summary.totpot);
+    atomicAdd(shard.totgoodpot, summary.totgoodpot);
+    shard.totspills.fetch_add(summary.totspills, std::memory_order_relaxed);
+    shard.goodspills.fetch_add(summary.goodspills, std::memory_order_relaxed);
+  } // ConcurrentPOTAccumulator::add()
+
+  //----------------------------------------------------------------------------
+  POTSummary ConcurrentPOTAccumulator::snapshot() const {
+    POTSummary total;
+    for (std::size_t i = 0; i < fNShards; ++i) {
+      Shard const& shard = fShards[i];
+      POTSummary part;
+      part.totpot     = shard.totpot.load();
+      part.totgoodpot = shard.totgoodpot.load();
+      part.totspills  = shard.totspills.load();
+      part.goodspills = shard.goodspills.load();
+      total.aggregate(part);
+    }
+    return total;
+  } // ConcurrentPOTAccumulator::snapshot()
+
+  //----------------------------------------------------------------------------
+  void ConcurrentPOTAccumulator::reset() {
+    for (std::size_t i = 0; i < fNShards; ++i) {
+      Shard& shard = fShards[i];
+      shard.totpot.store(0.0);
+      shard.totgoodpot.store(0.0);
+      shard.totspills.store(0);
+      shard.goodspills.store(0);
+    }
+  } // ConcurrentPOTAccumulator::reset()
+
+  //----------------------------------------------------------------------------
+  ConcurrentPOTAccumulator::Shard& ConcurrentPOTAccumulator::threadShard() {
+    return fShards[threadSlot() % fNShards];
+  } // ConcurrentPOTAccumulator::threadShard()
+
+  //----------------------------------------------------------------------------
+
+} // namespace sumdata
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////
+/// \file larcoreobj/SummaryData/ConcurrentPOTAccumulator.h
+///
+/// Thread-safe accumulation of `sumdata::POTSummary` information
+///
+////////////////////////////////////////////////////////////////////////
+#ifndef LARCOREOBJ_SUMMARYDATA_CONCURRENTPOTACCUMULATOR_H
+#define LARCOREOBJ_SUMMARYDATA_CONCURRENTPOTACCUMULATOR_H
+
+#include "larcoreobj/SummaryData/POTSummary.h"
+
+#include <atomic>
+#include <memory> // std::unique_ptr
+#include <cstddef> // std::size_t
+
+
+namespace sumdata {
+
+  /**
+   * @brief Accumulates `POTSummary` information from many threads at once.
+   *
+   * Any number of threads may call `add()` concurrently, without locks.
+   * The counters are split in shards, each on its own cache line, and each
+   * thread always adds to the same shard, so that threads rarely contend
+   * the same counters. Each thread takes the next slot of a process-wide
+   * counter the first time it adds to any accumulator, and uses the shard
+   * `slot % nShards()`. Slots are never reused, so threads do share shards
+   * as soon as more than `nShards()` of them have ever added (including
+   * threads that have since terminated). The counters are therefore updated
+   * atomically (a compare-and-swap loop for the floating point ones), which
+   * keeps shared shards correct at the cost of some contention.
+   *
+   * `snapshot()` sums all the shards into a `POTSummary`. It is meant to be
+   * called at subrun or run close, when no thread is adding any more; if
+   * called while threads are still adding, it may miss some of the ongoing
+   * additions (each shard is read atomically, but not all of them together).
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * sumdata::ConcurrentPOTAccumulator accumulator;
+   * // from any thread:
+   * accumulator.add(subrunPOT);
+   * // at close:
+   * sumdata::POTSummary const total = accumulator.snapshot();
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class ConcurrentPOTAccumulator {
+  public:
+
+    /// Number of shards used by default.
+    static constexpr std::size_t DefaultShards = 16U;
+
+    /// Constructor: uses the specified number of shards (at least one).
+    explicit ConcurrentPOTAccumulator(std::size_t nShards = DefaultShards);
+
+    ConcurrentPOTAccumulator(ConcurrentPOTAccumulator const&) = delete;
+    ConcurrentPOTAccumulator& operator= (ConcurrentPOTAccumulator const&)
+      = delete;
+
+    /// Adds the content of `summary` (thread safe).
+    void add(POTSummary const& summary);
+
+    /// Returns the sum of all the additions so far.
+    POTSummary snapshot() const;
+
+    /// Removes all the additions (not thread safe).
+    void reset();
+
+    /// Returns the number of shards.
+    std::size_t nShards() const { return fNShards; }
+
+  private:
+
+    /// Counters of a shard, on their own cache line.
+    struct alignas(64) Shard {
+      std::atomic<double> totpot { 0.0 };
+      std::atomic<double> totgoodpot { 0.0 };
+      std::atomic<int> totspills { 0 };
+      std::atomic<int> goodspills { 0 };
+    };
+
+    std::size_t fNShards; ///< Number of shards.
+    std::unique_ptr<Shard[]> fShards; ///< The shards.
+
+    /// Returns the shard assigned to the current thread.
+    Shard& threadShard();
+
+  }; // ConcurrentPOTAccumulator
+
+} // namespace sumdata
+
+
+#endif // LARCOREOBJ_SUMMARYDATA_CONCURRENTPOTACCUMULATOR_H
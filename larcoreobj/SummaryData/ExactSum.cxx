@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////
+/// \file larcoreobj/SummaryData/ExactSum.cxx
+///
+/// Exact, order-independent sum of floating point numbers
+///
+////////////////////////////////////////////////////////////////////////
+
+#include "larcoreobj/SummaryData/ExactSum.h"
+
+#include <cmath> // std::frexp(), std::ldexp(), std::isfinite(), HUGE_VAL
+#include <cstdint> // std::uint64_t
+
+namespace {
+
+  /// Returns the number of bits needed to represent `x`.
+  unsigned int bitLength(std::uint64_t x) {
+    unsigned int n = 0U;
+    while (x) { ++n; x >>= 1U; }
+    return n;
+  } // bitLength()
+
+} // local namespace
+
+
+namespace sumdata {
+
+  //----------------------------------------------------------------------------
+  void ExactSum::add(double value) {
+
+    if (!std::isfinite(value)) {
+      fNonFinite += value;
+      fHasNonFinite = true;
+      return;
+    }
+    if (value == 0.0) return;
+
+    // value = mantissa * 2^(exponent - 53), with mantissa a 53-bit integer
+    int exponent = 0;
+    double const fraction = std::frexp(value, &exponent);
+    bool const negative = fraction < 0.0;
+    std::uint64_t mantissa = static_cast<std::uint64_t>
+      (std::ldexp(negative? -fraction: fraction, 53));
+    int position = exponent - 53 - MinExponent;
+    if (position < 0) { // subnormal: the bits shifted out are all zero
+      mantissa >>= -position;
+      position = 0;
+    }
+
+    std::size_t const limb = position / LimbBits;
+    unsigned int const shift = position % LimbBits;
+    std::uint64_t const mask = (std::uint64_t(1) << LimbBits) - 1U;
+    std::uint64_t const low = (mantissa & mask) << shift; // up to 63 bits
+    std::uint64_t const high = (mantissa >> LimbBits) << shift; // up to 52 bits
+
+    Limb_t const sign = negative? -1: +1;
+    fLimbs[limb]      += sign * static_cast<Limb_t>(low & mask);
+    fLimbs[limb + 1U]
+      += sign * static_cast<Limb_t>((low >> LimbBits) + (high & mask));
+    fLimbs[limb + 2U] += sign * static_cast<Limb_t>(high >> LimbBits);
+
+    checkPending();
+
+  } // ExactSum::add(double)
+
+
+  //----------------------------------------------------------------------------
+  void ExactSum::add(ExactSum const& other) {
+
+    if (other.fHasNonFinite) {
+      fNonFinite += other.fNonFinite;
+      fHasNonFinite = true;
+    }
+
+    ExactSum normalized = other;
+    normalized.normalize();
+    normalize();
+    for (std::size_t i = 0; i < NLimbs; ++i)
+      fLimbs[i] += normalized.fLimbs[i];
+    checkPending();
+
+  } // ExactSum::add(ExactSum)
+
+
+  //----------------------------------------------------------------------------
+  double ExactSum::value() const {
+
+    if (fHasNonFinite) return fNonFinite;
+
+    // work on a normalized copy holding the absolute value
+    ExactSum sum = *this;
+    sum.normalize();
+    bool const negative = sum.fLimbs.back() < 0;
+    if (negative) {
+      for (Limb_t& limb: sum.fLimbs) limb = -limb;
+      sum.normalize();
+    }
+    std::array<Limb_t, NLimbs> const& limbs = sum.fLimbs;
+
+    std::size_t top = NLimbs;
+    while (top > 0U && limbs[top - 1U] == 0) --top;
+    if (top == 0U) return 0.0;
+    --top;
+
+    auto limbAt = [&limbs](std::size_t i, std::size_t below) -> std::uint64_t
+      { return (i >= below)? limbs[i - below]: 0; };
+
+    // the 64 most significant bits, and whether any bit below them is set
+    std::uint64_t const l0 = limbAt(top, 0U);
+    std::uint64_t const l1 = limbAt(top, 1U);
+    std::uint64_t const l2 = limbAt(top, 2U);
+    unsigned int const t = bitLength(l0);
+    if (t > LimbBits) // carries beyond the last limb: way above any double
+      return negative? -HUGE_VAL: HUGE_VAL;
+    std::uint64_t const window
+      = (l0 << (64U - t)) | (l1 << (LimbBits - t)) | (l2 >> t);
+    bool sticky = (l2 & ((std::uint64_t(1) << t) - 1U)) != 0U;
+    for (std::size_t i = 3U; !sticky && i <= top; ++i)
+      sticky = (limbs[top - i] != 0);
+
+    // round the window to 53 bits, to nearest, ties to even
+    std::uint64_t mantissa = window >> 11U;
+    std::uint64_t const rest = window & 0x7FFU;
+    if ((rest > 0x400U) || ((rest == 0x400U) && (sticky || (mantissa & 1U))))
+      ++mantissa;
+
+    int const topBit = static_cast<int>(top * LimbBits + t) - 1;
+    double const magnitude
+      = std::ldexp(static_cast<double>(mantissa), topBit - 52 + MinExponent);
+    return negative? -magnitude: magnitude;
+
+  } // ExactSum::value()
+
+
+  //----------------------------------------------------------------------------
+  void ExactSum::normalize() {
+    Limb_t carry = 0;
+    for (std::size_t i = 0; i + 1U < NLimbs; ++i) {
+      Limb_t const limb = fLimbs[i] + carry;
+      carry = limb >> LimbBits; // arithmetic shift: floor division
+      fLimbs[i] = limb - carry * (Limb_t(1) << LimbBits);
+    }
+    fLimbs.back() += carry;
+    fPending = 0U;
+  } // ExactSum::normalize()
+
+  //----------------------------------------------------------------------------
+
+} // namespace sumdata
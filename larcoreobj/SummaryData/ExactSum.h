@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////
+/// \file larcoreobj/SummaryData/ExactSum.h
+///
+/// Exact, order-independent sum of floating point numbers
+///
+////////////////////////////////////////////////////////////////////////
+#ifndef LARCOREOBJ_SUMMARYDATA_EXACTSUM_H
+#define LARCOREOBJ_SUMMARYDATA_EXACTSUM_H
+
+#include <array>
+#include <cstdint> // std::int64_t
+#include <cstddef> // std::size_t
+
+
+namespace sumdata {
+
+  /**
+   * @brief Sum of `double` values without any rounding.
+   *
+   * The sum is kept as a fixed point integer wide enough to represent any
+   * finite `double` exactly (a "superaccumulator"), so additions never round.
+   * The result is therefore the same regardless of the order of the
+   * additions and of how partial sums are merged; `value()` rounds it only
+   * once, to the nearest `double`.
+   *
+   * Non-finite values (infinity and NaN) are summed separately, and if any
+   * was added, `value()` returns their sum.
+   *
+   * Example:
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+   * sumdata::ExactSum a, b;
+   * a += 1e20;
+   * b += 1.0;
+   * a += b;
+   * a += -1e20;
+   * double const one = a.value(); // 1.0
+   * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+   */
+  class ExactSum {
+  public:
+
+    ExactSum() = default;
+
+    /// Constructor: starts the sum with `value`.
+    explicit ExactSum(double value) { add(value); }
+
+    /// Adds `value` to the sum.
+    void add(double value);
+
+    /// Adds the sum in `other` to this one.
+    void add(ExactSum const& other);
+
+    /// Adds `value` to the sum.
+    ExactSum& operator+= (double value) { add(value); return *this; }
+
+    /// Adds the sum in `other` to this one.
+    ExactSum& operator+= (ExactSum const& other) { add(other); return *this; }
+
+    /// Returns the sum, rounded to the nearest `double`.
+    double value() const;
+
+    /// Resets the sum to `0`.
+    void clear() { *this = ExactSum{}; }
+
+  private:
+
+    using Limb_t = std::int64_t;
+
+    /// Bits of the integer represented by each limb.
+    static constexpr unsigned int LimbBits = 32U;
+
+    /// Position of the bit of the smallest `double` (2^-1074) in the integer.
+    static constexpr int MinExponent = -1074;
+
+    /// Limbs needed for the largest `double` (2^1024), plus room for carries.
+    static constexpr std::size_t NLimbs = 67U;
+
+    /// Additions that can be made before carries need to be propagated.
+    static constexpr unsigned int MaxPending = 1U << 30U;
+
+    std::array<Limb_t, NLimbs> fLimbs {}; ///< Integer, least significant first.
+    unsigned int fPending = 0U; ///< Additions since last carry propagation.
+    double fNonFinite = 0.0; ///< Sum of the non-finite values.
+    bool fHasNonFinite = false; ///< Whether any non-finite value was added.
+
+    /// Propagates the carries, leaving all limbs but the last in [0, 2^32[.
+    void normalize();
+
+    /// Propagates the carries if too many additions are pending.
+    void checkPending()
+      { if (++fPending >= MaxPending) normalize(); }
+
+  }; // ExactSum
+
+} // namespace sumdata
+
+
+#endif // LARCOREOBJ_SUMMARYDATA_EXACTSUM_H
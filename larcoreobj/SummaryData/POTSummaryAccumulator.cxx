@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////
+/// \file larcoreobj/SummaryData/POTSummaryAccumulator.cxx
+///
+/// Exact, order-independent aggregation of `sumdata::POTSummary`
+///
+////////////////////////////////////////////////////////////////////////
+
+#include "larcoreobj/SummaryData/POTSummaryAccumulator.h"
+
+#include <limits>
+#include <stdexcept> // std::overflow_error
+#include <string>
+
+namespace {
+
+  /// Returns `count` as an `int`, throwing `std::overflow_error` if too large.
+  int toSpillCount(long long count, char const* name) {
+    using Limits_t = std::numeric_limits<int>;
+    if ((count < Limits_t::min()) || (count > Limits_t::max())) {
+      throw std::overflow_error("sumdata::POTSummaryAccumulator: "
+        + std::to_string(count) + " " + name
+        + " do not fit into sumdata::POTSummary");
+    }
+    return static_cast<int>(count);
+  } // toSpillCount()
+
+} // local namespace
+
+
+namespace sumdata {
+
+  //----------------------------------------------------------------------------
+  void POTSummaryAccumulator::add(POTSummary const& summary) {
+    fTotPOT.add(summary.totpot);
+    fTotGoodPOT.add(summary.totgoodpot);
+    fTotSpills  += summary.totspills;
+    fGoodSpills += summary.goodspills;
+  } // POTSummaryAccumulator::add()
+
+  //----------------------------------------------------------------------------
+  void POTSummaryAccumulator::aggregate(POTSummaryAccumulator const& other) {
+    fTotPOT.add(other.fTotPOT);
+    fTotGoodPOT.add(other.fTotGoodPOT);
+    fTotSpills  += other.fTotSpills;
+    fGoodSpills += other.fGoodSpills;
+  } // POTSummaryAccumulator::aggregate()
+
+  //----------------------------------------------------------------------------
+  POTSummary POTSummaryAccumulator::summary() const {
+    POTSummary summary;
+    summary.totpot     = fTotPOT.value();
+    summary.totgoodpot = fTotGoodPOT.value();
+    summary.totspills  = toSpillCount(fTotSpills, "spills");
+    summary.goodspills = toSpillCount(fGoodSpills, "good spills");
+    return summary;
+  } // POTSummaryAccumulator::summary()
+
+  //----------------------------------------------------------------------------
+
+}// namespace sumdata
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////
+/// \file larcoreobj/SummaryData/POTSummaryAccumulator.h
+///
+/// Exact, order-independent aggregation of `sumdata::POTSummary`
+///
+////////////////////////////////////////////////////////////////////////
+#ifndef LARCOREOBJ_SUMMARYDATA_POTSUMMARYACCUMULATOR_H
+#define LARCOREOBJ_SUMMARYDATA_POTSUMMARYACCUMULATOR_H
+
+#include "larcoreobj/SummaryData/POTSummary.h"
+#include "larcoreobj/SummaryData/ExactSum.h"
+
+
+namespace sumdata {
+
+  /**
+   * @brief Aggregates `POTSummary` objects with bit-reproducible results.
+   *
+   * `POTSummary::aggregate()` sums the exposures in plain `double` precision,
+   * so large totals lose precision and depend on the order of aggregation.
+   * This accumulator sums them exactly (see `sumdata::ExactSum`): the result
+   * is the same no matter in which order the summaries are added, or how the
+   * work is split among accumulators that are later merged with
+   * `aggregate()`. The spill counts are summed in 64-bit integers.
+   *
+   * The persistent `POTSummary` is unchanged: `summary()` returns one, with
+   * the exposures rounded only once.
+   */
+  class POTSummaryAccumulator {
+  public:
+
+    POTSummaryAccumulator() = default;
+
+    /// Constructor: starts with the content of `summary`.
+    explicit POTSummaryAccumulator(POTSummary const& summary) { add(summary); }
+
+    /// Adds the content of `summary`.
+    void add(POTSummary const& summary);
+
+    /// Merges the content of another accumulator.
+    void aggregate(POTSummaryAccumulator const& other);
+
+    /**
+     * @brief Returns the total, as a `POTSummary`.
+     * @throw std::overflow_error if a spill count does not fit into an `int`
+     *
+     * The spill counts of `POTSummary` are `int`; rather than silently
+     * wrapping a larger total, this throws.
+     */
+    POTSummary summary() const;
+
+  private:
+
+    ExactSum fTotPOT; ///< Total exposure.
+    ExactSum fTotGoodPOT; ///< Exposure from good spills.
+    long long fTotSpills = 0; ///< Total number of spills.
+    long long fGoodSpills = 0; ///< Number of good spills.
+
+  }; // POTSummaryAccumulator
+
+} // namespace sumdata
+
+
+#endif // LARCOREOBJ_SUMMARYDATA_POTSUMMARYACCUMULATOR_H
@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////
+/// \file larcoreobj/SummaryData/Reduce.h
+///
+/// Parallel tree reduction of summary data products
+///
+////////////////////////////////////////////////////////////////////////
+#ifndef LARCOREOBJ_SUMMARYDATA_REDUCE_H
+#define LARCOREOBJ_SUMMARYDATA_REDUCE_H
+
+#include <future> // std::async()
+#include <thread> // std::thread::hardware_concurrency()
+#include <iterator> // std::iterator_traits
+#include <optional>
+#include <type_traits> // std::void_t, std::is_base_of
+#include <utility> // std::pair, std::declval()
+#include <vector>
+#include <algorithm> // std::min(), std::max()
+#include <cstddef> // std::size_t
+
+
+namespace sumdata {
+
+  /// Settings of `sumdata::reduce()`.
+  struct ReducePolicy {
+
+    /// Number of consecutive elements aggregated serially in a single task.
+    std::size_t grainSize = 1024U;
+
+    /**
+     * @brief Largest number of threads to use (`0` means the available cores).
+     *
+     * The default is to run in the calling thread only. `reduce()` starts its
+     * own threads with `std::async()`, which are not known to the task
+     * scheduler of the framework: within a multithreaded job they would
+     * compete with its worker threads for the same cores. More threads should
+     * be requested only where the cores are known to be idle, e.g. at the end
+     * of a job or in a standalone program.
+     * Merging a summary takes a few nanoseconds, so threads pay off only for
+     * ranges of many thousands of products; `Reduce_benchmark` reports the
+     * time per summary for 1 to 8 threads and for all the cores, and should
+     * be run on the target machine before changing this default.
+     */
+    unsigned int maxThreads = 1U;
+
+    /// Returns a policy running everything in the calling thread.
+    static ReducePolicy sequential() { return { 1024U, 1U }; }
+
+    /// Returns a policy using up to `nThreads` threads (`0`: all the cores).
+    static ReducePolicy parallel(unsigned int nThreads = 0U)
+      { return { 1024U, nThreads }; }
+
+  }; // ReducePolicy
+
+
+  /// Result of `sumdata::reduce()`.
+  template <typename T>
+  struct ReduceResult {
+
+    /// The aggregated product (default-constructed on conflict).
+    T value {};
+
+    /// Positions of the first pair of incompatible products, if any.
+    std::optional<std::pair<std::size_t, std::size_t>> conflict;
+
+    /// Returns whether the reduction was performed (no conflict).
+    explicit operator bool() const { return !conflict; }
+
+  }; // ReduceResult
+
+
+  /**
+   * @brief Aggregates all the products in a range with a tree reduction.
+   * @tparam Iter type of random access iterator to the products
+   * @param first iterator to the first product
+   * @param last iterator past the last product
+   * @param policy settings of the reduction
+   * @return the aggregated product, or the position of a conflict
+   *
+   * The products must have an `aggregate(T const&)` member function.
+   * The range is split in chunks of `policy.grainSize` consecutive products,
+   * each chunk is aggregated in order, and then the partial results are
+   * aggregated pairwise (chunk `0` with `1`, `2` with `3`, then the results
+   * of those pairs and so on).
+   * The chunks are processed in parallel on up to `policy.maxThreads`
+   * threads, which by default is just the calling one (see
+   * `ReducePolicy::maxThreads`). The shape of the tree depends only on the
+   * number of products and on the grain size, so the result does not depend
+   * on the number of threads; with a reproducible product like
+   * `POTSummaryAccumulator` it is also independent of the grain size.
+   *
+   * If the products have an `isCompatible(T const&)` member function (like
+   * `RunData`), all products are first checked for compatibility with the
+   * first one; if any is not, no aggregation is performed and the positions
+   * of that pair are returned in `conflict` instead of throwing an exception.
+   *
+   * An empty range yields a default-constructed product.
+   */
+  template <typename Iter>
+  ReduceResult<typename std::iterator_traits<Iter>::value_type> reduce
+    (Iter first, Iter last, ReducePolicy const& policy = {});
+
+
+  namespace details {
+
+    template <typename T, typename = void>
+    struct HasIsCompatible: std::false_type {};
+
+    template <typename T>
+    struct HasIsCompatible<T, std::void_t<decltype(
+      std::declval<T const&>().isCompatible(std::declval<T const&>())
+      )>>
+      : std::true_type
+    {};
+
+  } // namespace details
+
+} // namespace sumdata
+
+
+//----------------------------------------------------------------------------
+template <typename Iter>
+auto sumdata::reduce(Iter first, Iter last, ReducePolicy const& policy)
+  -> ReduceResult<typename std::iterator_traits<Iter>::value_type>
+{
+  using T = typename std::iterator_traits<Iter>::value_type;
+  static_assert(std::is_base_of_v<std::random_access_iterator_tag,
+    typename std::iterator_traits<Iter>::iterator_category>,
+    "sumdata::reduce() requires random access iterators.");
+
+  ReduceResult<T> result;
+  std::size_t const n = last - first;
+  if (n == 0U) return result;
+
+  if constexpr (details::HasIsCompatible<T>::value) {
+    for (std::size_t i = 1U; i < n; ++i) {
+      if (first[0].isCompatible(first[i])) continue;
+      result.conflict.emplace(0U, i);
+      return result;
+    }
+  }
+
+  std::size_t const grain = std::max(policy.grainSize, std::size_t(1U));
+  std::size_t const nChunks = (n + grain - 1U) / grain;
+
+  auto reduceChunk = [first, n, grain](std::size_t chunk)
+    {
+      std::size_t const begin = chunk * grain;
+      std::size_t const end = std::min(begin + grain, n);
+      T partial = first[begin];
+      for (std::size_t i = begin + 1U; i < end; ++i)
+        partial.aggregate(first[i]);
+      return partial;
+    };
+
+  unsigned int maxThreads = policy.maxThreads;
+  if (maxThreads == 0U)
+    maxThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  std::size_t const nWorkers = std::min<std::size_t>(maxThreads, nChunks);
+
+  // worker `w` reduces the chunks `w`, `w + nWorkers`, `w + 2 nWorkers`...
+  std::vector<std::optional<T>> partials(nChunks);
+  auto worker = [&partials, &reduceChunk, nChunks, nWorkers](std::size_t w)
+    {
+      for (std::size_t chunk = w; chunk < nChunks; chunk += nWorkers)
+        partials[chunk].emplace(reduceChunk(chunk));
+    };
+  std::vector<std::future<void>> tasks;
+  for (std::size_t w = 1U; w < nWorkers; ++w)
+    tasks.push_back(std::async(std::launch::async, worker, w));
+  worker(0U);
+  for (std::future<void>& task: tasks) task.get();
+
+  // pairwise aggregation of the partial results, in a fixed order
+  for (std::size_t step = 1U; step < nChunks; step *= 2U) {
+    for (std::size_t i = 0U; i + step < nChunks; i += 2U * step)
+      partials[i]->aggregate(*partials[i + step]);
+  }
+
+  result.value = std::move(*partials.front());
+  return result;
+
+} // sumdata::reduce()
+
+
+#endif // LARCOREOBJ_SUMMARYDATA_REDUCE_H
@@ -9,18 +9,42 @@
 #include "larcoreobj/SummaryData/RunData.h"
 
 #include <stdexcept> // std::runtime_error
+#include <unordered_set>
+#include <mutex>
+
+namespace {
+
+  /// Returns the interned default detector name, locking only on first call.
+  std::string const* defaultDetectorName() {
+    static std::string const* const name
+      = sumdata::details::internDetectorName("nodetectorname");
+    return name;
+  } // defaultDetectorName()
+
+} // local namespace
+
 
 namespace sumdata {
 
+  //---------------------------------------------------------
+  std::string const* details::internDetectorName(std::string const& name) {
+    // the nodes of an unordered set are never moved
+    static std::unordered_set<std::string> names;
+    static std::mutex namesMutex;
+
+    std::lock_guard<std::mutex> lock(namesMutex);
+    return &*(names.insert(name).first);
+  } // details::internDetectorName()
+
   //---------------------------------------------------------
   RunData::RunData()
-  : fDetName("nodetectorname")
+  : fDetName(defaultDetectorName())
   {
   }
 
   //---------------------------------------------------------
   RunData::RunData(std::string const& detectorName)
-  : fDetName(detectorName)
+  : fDetName(details::internDetectorName(detectorName))
   {
   }
 
@@ -30,7 +54,7 @@ namespace sumdata {
     // Each run is required to have the same detector name.
     // This might be a problem for Monte Carlo jobs which tend to use the same
     // run number for everything.
-    if (other.DetName() != DetName()) {
+    if (!isCompatible(other)) {
       throw std::runtime_error("The same run sees different detector setups: '"
         + DetName() + "' and '" + other.DetName()
         );
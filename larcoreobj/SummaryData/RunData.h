@@ -12,6 +12,27 @@
 
 namespace sumdata {
 
+  namespace details {
+
+    /// Returns the unique, process-wide copy of the detector name `name`.
+    ///
+    /// The returned pointer stays valid until the end of the process, and two
+    /// names are equal if and only if their pointers are. Thread safe.
+    std::string const* internDetectorName(std::string const& name);
+
+  } // namespace details
+
+  /**
+   * @brief Run information: the name of the detector.
+   *
+   * The detector name is held as a handle to its interned copy (see
+   * `details::internDetectorName()`), so that copies do not allocate and
+   * `isCompatible()` compares pointers.
+   *
+   * On file, the handle is written as the name it points to. Read rules in
+   * `classes_def.xml` intern the name read from the file, from class version
+   * 13 (where the member was a `std::string`) as well as from the current one.
+   */
   class RunData{
 
   public:
@@ -23,9 +44,12 @@ namespace sumdata {
     /// @throws std::runtime_error if `other` has a different `DetName()`
     void aggregate(RunData const& other);
 
+    /// Returns whether `other` can be aggregated with this object.
+    bool isCompatible(RunData const& other) const;
+
   private:
 
-    std::string  fDetName; ///< Detector name.
+    std::string const* fDetName; ///< Interned detector name (never null).
 
   public:
     explicit           RunData(std::string const& detectorName);
@@ -36,7 +60,11 @@ namespace sumdata {
 } // namespace sumdata
 
 
-inline std::string const& sumdata::RunData::DetName() const { return fDetName; }
+inline std::string const& sumdata::RunData::DetName() const
+  { return *fDetName; }
+
+inline bool sumdata::RunData::isCompatible(RunData const& other) const
+  { return other.fDetName == fDetName; }
 
 
 #endif // LARCOREOBJ_SUMMARYDATA_RUNDATA_H
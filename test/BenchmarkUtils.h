@@ -0,0 +1,36 @@
+/**
+ * @file   test/BenchmarkUtils.h
+ * @brief  Utilities shared by the benchmark programs.
+ * @date   October 18, 2026
+ *
+ * This header is for the test programs only, and it is not installed.
+ */
+
+#ifndef LARCOREOBJ_TEST_BENCHMARKUTILS_H
+#define LARCOREOBJ_TEST_BENCHMARKUTILS_H
+
+// C/C++ standard libraries
+#include <chrono>
+#include <algorithm> // std::max()
+
+
+//------------------------------------------------------------------------------
+/// Returns the shortest time [ns] of `repeat` executions of `f`.
+template <typename F>
+double bestTime(unsigned int repeat, F&& f) {
+  using Clock_t = std::chrono::steady_clock;
+  double best = -1.0;
+  for (unsigned int pass = 0; pass < std::max(repeat, 1U); ++pass) {
+    Clock_t::time_point const start = Clock_t::now();
+    f();
+    double const time = std::chrono::duration<double, std::nano>
+      (Clock_t::now() - start).count();
+    if ((best < 0.0) || (time < best)) best = time;
+  }
+  return best;
+} // bestTime()
+
+
+//------------------------------------------------------------------------------
+
+#endif // LARCOREOBJ_TEST_BENCHMARKUTILS_H
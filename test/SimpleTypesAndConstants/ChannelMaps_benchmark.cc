@@ -0,0 +1,147 @@
+/**
+ * @file   ChannelMaps_benchmark.cc
+ * @brief  Benchmark of the per-channel maps against `std::unordered_map`
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     ChannelMaps_benchmark [nChannels [nLookups [repeat]]]
+ *
+ * `raw::ChannelMap`, `raw::SparseChannelMap` and `std::unordered_map` are
+ * filled with all the `nChannels` channels of a detector (in random order),
+ * and then with 1% of them. For each occupancy, the time (best of `repeat`
+ * passes) is printed for:
+ *  * filling the map with `operator[]`, per channel;
+ *  * `nLookups` random lookups of channels of the detector, per lookup;
+ *  * iterating over the whole map, per channel.
+ * `raw::SparseChannelMap` is filled with `assign()`, as it is meant to be.
+ * The program fails if the maps disagree on the lookups.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/ChannelMaps.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <utility> // std::pair
+#include <random>
+#include <algorithm> // std::shuffle(), std::max()
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS, EXIT_FAILURE
+
+
+//------------------------------------------------------------------------------
+using Entries_t = std::vector<std::pair<raw::ChannelID_t, float>>;
+
+
+/// Fills `map` with `entries`.
+template <typename Map>
+void fill(Map& map, Entries_t const& entries) {
+  map.clear();
+  for (auto const& [ channel, value ]: entries) map[channel] = value;
+} // fill()
+
+void fill(raw::SparseChannelMap<float>& map, Entries_t const& entries)
+  { map.assign(entries); }
+
+
+/// Returns the value of `channel` in `map`, or `0` if not present.
+template <typename Map>
+float lookup(Map const& map, raw::ChannelID_t channel) {
+  float const* value = map.get(channel);
+  return value? *value: 0.0f;
+} // lookup()
+
+float lookup
+  (std::unordered_map<raw::ChannelID_t, float> const& map, raw::ChannelID_t c)
+{
+  auto const it = map.find(c);
+  return (it == map.end())? 0.0f: it->second;
+} // lookup()
+
+
+/// Measures and prints the performance of `Map` with `entries`.
+template <typename Map>
+double runBenchmark(
+  std::string const& name, Entries_t const& entries,
+  std::vector<raw::ChannelID_t> const& lookups, unsigned int repeat
+) {
+  Map map;
+  double const fillTime
+    = bestTime(repeat, [&map, &entries](){ fill(map, entries); });
+
+  double found = 0.0; // also prevents the lookups from being optimised away
+  double const lookupTime = bestTime(repeat, [&map, &lookups, &found](){
+      found = 0.0;
+      for (raw::ChannelID_t channel: lookups) found += lookup(map, channel);
+    });
+
+  double sum = 0.0;
+  double const loopTime = bestTime(repeat, [&map, &sum](){
+      for (auto const& [ channel, value ]: map) sum += value;
+    });
+
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+    << std::fixed << std::setprecision(2)
+    << std::setw(10) << (fillTime / std::max<std::size_t>(entries.size(), 1U))
+    << std::setw(10) << (lookupTime / std::max<std::size_t>(lookups.size(), 1U))
+    << std::setw(10) << (loopTime / std::max<std::size_t>(entries.size(), 1U))
+    << "   (" << std::setprecision(0) << sum << ")" << std::endl;
+  return found;
+} // runBenchmark()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  raw::ChannelID_t const nChannels
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 150000U;
+  std::size_t const nLookups
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 10000000U;
+  unsigned int const repeat
+    = (argc > 3)? std::strtoul(argv[3], nullptr, 10): 3U;
+
+  std::mt19937 engine { 12345U };
+
+  std::vector<raw::ChannelID_t> allChannels(nChannels);
+  for (raw::ChannelID_t c = 0; c < nChannels; ++c) allChannels[c] = c;
+  std::shuffle(allChannels.begin(), allChannels.end(), engine);
+
+  std::uniform_int_distribution<raw::ChannelID_t> anyChannel
+    (0U, std::max(nChannels, 1U) - 1U);
+  std::vector<raw::ChannelID_t> lookups(nLookups);
+  for (raw::ChannelID_t& channel: lookups) channel = anyChannel(engine);
+
+  bool same = true;
+  for (std::size_t const percent: { 100U, 1U }) {
+    Entries_t entries;
+    for (std::size_t i = 0; i < allChannels.size() * percent / 100U; ++i)
+      entries.emplace_back(allChannels[i], float(allChannels[i] % 1000U));
+
+    std::cout << entries.size() << " of " << nChannels << " channels, "
+      << nLookups << " lookups\n"
+      << "  time [ns]                     fill    lookup      loop"
+      << std::endl;
+    double const dense = runBenchmark<raw::ChannelMap<float>>
+      ("raw::ChannelMap", entries, lookups, repeat);
+    double const sparse = runBenchmark<raw::SparseChannelMap<float>>
+      ("raw::SparseChannelMap", entries, lookups, repeat);
+    double const hashed
+      = runBenchmark<std::unordered_map<raw::ChannelID_t, float>>
+      ("std::unordered_map", entries, lookups, repeat);
+    same = same && (dense == hashed) && (sparse == hashed);
+  } // for occupancy
+
+  if (!same) {
+    std::cerr << "The maps returned different values." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+} // main()
@@ -0,0 +1,172 @@
+/**
+ * @file   ChannelMaps_test.cc
+ * @brief  Test of ChannelMaps.h per-channel containers
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ChannelMaps_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/ChannelMaps.h"
+
+// C/C++ standard libraries
+#include <map>
+#include <vector>
+#include <utility> // std::pair
+#include <stdexcept> // std::out_of_range
+
+
+//------------------------------------------------------------------------------
+/// Fills `map` and compares its content with a `std::map` filled the same way.
+template <typename Map>
+void checkChannelMap(Map& map) {
+
+  std::map<raw::ChannelID_t, int> expected;
+  std::vector<raw::ChannelID_t> const channels
+    { 5U, 0U, 63U, 64U, 1000U, 127U, 5U, 200U };
+
+  BOOST_CHECK(map.empty());
+  BOOST_CHECK(map.begin() == map.end());
+  BOOST_CHECK(!map.contains(0U));
+  BOOST_CHECK(map.get(0U) == nullptr);
+  BOOST_CHECK_THROW(map.at(0U), std::out_of_range);
+
+  for (raw::ChannelID_t const channel: channels) {
+    bool const isNew = expected.count(channel) == 0U;
+    auto const [ it, added ] = map.try_emplace(channel, int(channel) * 2);
+    BOOST_CHECK_EQUAL(added, isNew);
+    BOOST_CHECK_EQUAL(it.channel(), channel);
+    expected.emplace(channel, int(channel) * 2);
+  } // for
+  BOOST_CHECK_EQUAL(map.size(), expected.size());
+  BOOST_CHECK(!map.empty());
+
+  // lookup
+  for (auto const& [ channel, value ]: expected) {
+    BOOST_CHECK(map.contains(channel));
+    BOOST_CHECK_EQUAL(map.count(channel), 1U);
+    BOOST_CHECK_EQUAL(map.at(channel), value);
+    BOOST_REQUIRE(map.get(channel) != nullptr);
+    BOOST_CHECK_EQUAL(*map.get(channel), value);
+    BOOST_CHECK_EQUAL(map.find(channel)->second, value);
+  }
+  BOOST_CHECK(!map.contains(1U));
+  BOOST_CHECK(!map.contains(2000U));
+  BOOST_CHECK(!map.contains(raw::InvalidChannelID));
+  BOOST_CHECK(map.find(1U) == map.end());
+  BOOST_CHECK_THROW(map.at(1U), std::out_of_range);
+
+  // iteration in channel order, also on constant map
+  auto iExpected = expected.begin();
+  for (auto [ channel, value ]: std::as_const(map)) {
+    BOOST_REQUIRE(iExpected != expected.end());
+    BOOST_CHECK_EQUAL(channel, iExpected->first);
+    BOOST_CHECK_EQUAL(value, iExpected->second);
+    ++iExpected;
+  }
+  BOOST_CHECK(iExpected == expected.end());
+
+  // modification
+  for (auto [ channel, value ]: map) value += 1;
+  BOOST_CHECK_EQUAL(map.at(63U), 127);
+
+  auto const [ it, added ] = map.insert_or_assign(63U, -1);
+  BOOST_CHECK(!added);
+  BOOST_CHECK_EQUAL(it->second, -1);
+  BOOST_CHECK_EQUAL(map.at(63U), -1);
+
+  map[2U] = 4;
+  BOOST_CHECK_EQUAL(map.size(), expected.size() + 1U);
+  BOOST_CHECK_EQUAL(map[2U], 4);
+  BOOST_CHECK_EQUAL(map[3U], 0);
+  BOOST_CHECK_EQUAL(map.size(), expected.size() + 2U);
+
+  BOOST_CHECK_EQUAL(map.erase(3U), 1U);
+  BOOST_CHECK_EQUAL(map.erase(3U), 0U);
+  BOOST_CHECK(!map.contains(3U));
+  BOOST_CHECK_EQUAL(map.size(), expected.size() + 1U);
+
+  // the invalid channel can't be stored
+  BOOST_CHECK_THROW(map.try_emplace(raw::InvalidChannelID), std::out_of_range);
+  BOOST_CHECK_THROW(map[raw::InvalidChannelID], std::out_of_range);
+
+  typename Map::const_iterator const cit = map.find(2U); // conversion
+  BOOST_CHECK_EQUAL(cit->first, 2U);
+
+  map.clear();
+  BOOST_CHECK(map.empty());
+  BOOST_CHECK_EQUAL(map.size(), 0U);
+  BOOST_CHECK(map.begin() == map.end());
+  BOOST_CHECK(!map.contains(5U));
+
+} // checkChannelMap()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ChannelMapTest) {
+
+  raw::ChannelMap<int> map;
+  checkChannelMap(map);
+
+  // preallocated map; the last channel in the last bitmap word
+  raw::ChannelMap<int> sized(128U);
+  BOOST_CHECK_EQUAL(sized.channelCapacity(), 128U);
+  BOOST_CHECK(sized.empty());
+  sized[127U] = 1;
+  sized[64U] = 2;
+  BOOST_CHECK_EQUAL(sized.channelCapacity(), 128U);
+  std::vector<raw::ChannelID_t> channels;
+  for (auto const& [ channel, value ]: sized) channels.push_back(channel);
+  BOOST_CHECK_EQUAL(channels.size(), 2U);
+  BOOST_CHECK_EQUAL(channels.front(), 64U);
+  BOOST_CHECK_EQUAL(channels.back(), 127U);
+
+  // erased data is reset
+  sized.erase(64U);
+  BOOST_CHECK_EQUAL(sized[64U], 0);
+
+  // insertion does not grow beyond the limit
+  raw::ChannelMap<int> limited;
+  BOOST_CHECK_EQUAL(limited.maxChannels(), limited.DefaultMaxChannels);
+  limited.setMaxChannels(100U);
+  BOOST_CHECK_THROW(limited[100U], std::out_of_range);
+  BOOST_CHECK(limited.empty());
+  limited[70U] = 1;
+  BOOST_CHECK_EQUAL(limited.channelCapacity(), 71U);
+  limited[71U] = 2;
+  BOOST_CHECK_EQUAL(limited.channelCapacity(), 100U);
+  BOOST_CHECK_THROW(limited.insert_or_assign(1000U, 3), std::out_of_range);
+  BOOST_CHECK_EQUAL(limited.size(), 2U);
+
+} // BOOST_AUTO_TEST_CASE(ChannelMapTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SparseChannelMapTest) {
+
+  raw::SparseChannelMap<int> map;
+  checkChannelMap(map);
+
+  // bulk assignment from unsorted data, with duplicates
+  map.assign({ { 70000U, 1 }, { 12U, 2 }, { 70000U, 3 }, { 500U, 4 } });
+  BOOST_CHECK_EQUAL(map.size(), 3U);
+  std::vector<std::pair<raw::ChannelID_t, int>> content;
+  for (auto const& [ channel, value ]: map) content.emplace_back(channel, value);
+  BOOST_REQUIRE_EQUAL(content.size(), 3U);
+  BOOST_CHECK_EQUAL(content[0].first, 12U);
+  BOOST_CHECK_EQUAL(content[0].second, 2);
+  BOOST_CHECK_EQUAL(content[1].first, 500U);
+  BOOST_CHECK_EQUAL(content[1].second, 4);
+  BOOST_CHECK_EQUAL(content[2].first, 70000U);
+  BOOST_CHECK_EQUAL(content[2].second, 3); // last one wins
+
+  BOOST_CHECK_THROW
+    (map.assign({ { 1U, 1 }, { raw::InvalidChannelID, 2 } }), std::out_of_range);
+
+} // BOOST_AUTO_TEST_CASE(SparseChannelMapTest)
+
+
+//------------------------------------------------------------------------------
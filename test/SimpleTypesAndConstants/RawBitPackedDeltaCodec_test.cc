@@ -0,0 +1,140 @@
+/**
+ * @file   RawBitPackedDeltaCodec_test.cc
+ * @brief  Test of RawBitPackedDeltaCodec.h waveform encoding
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RawBitPackedDeltaCodec_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawBitPackedDeltaCodec.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+
+// C/C++ standard libraries
+#include <array>
+#include <vector>
+#include <random>
+#include <cmath> // std::lround()
+#include <stdexcept> // std::runtime_error
+
+
+//------------------------------------------------------------------------------
+// the new mode is appended, and does not change the existing values
+static_assert(raw::kDynamicDec == 4);
+static_assert(raw::kBitPackedDelta == raw::kDynamicDec + 1);
+
+
+//------------------------------------------------------------------------------
+/// Returns a waveform with pedestal and noise.
+std::vector<short> makeNoise(std::size_t nTicks, double rms, unsigned int seed)
+{
+  std::mt19937 engine { seed };
+  std::normal_distribution<double> noise { 0.0, rms };
+  std::vector<short> adc(nTicks);
+  for (short& sample: adc)
+    sample = static_cast<short>(std::lround(2048.0 + noise(engine)));
+  return adc;
+} // makeNoise()
+
+
+void checkRoundTrip(std::vector<short> const& adc) {
+
+  raw::codec::ByteBuffer_t const data = raw::codec::encodeBitPackedDelta(adc);
+  std::vector<short> const decoded = raw::codec::decodeBitPackedDelta(data);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (decoded.begin(), decoded.end(), adc.begin(), adc.end());
+
+} // checkRoundTrip()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PackingTest) {
+
+  using raw::codec::BitPackedDelta;
+
+  BOOST_CHECK_EQUAL(BitPackedDelta::packedWords(128U, 0U), 0U);
+  BOOST_CHECK_EQUAL(BitPackedDelta::packedWords(128U, 5U), 20U);
+  BOOST_CHECK_EQUAL(BitPackedDelta::packedWords(1U, 5U), 4U);
+  BOOST_CHECK_EQUAL(BitPackedDelta::packedWords(28U, 5U), 8U);
+
+  std::mt19937 engine { 7U };
+  for (unsigned int width = 0; width <= BitPackedDelta::MaxBitWidth; ++width) {
+    std::uint32_t const mask = (std::uint32_t(1) << width) - 1U;
+    std::array<std::uint32_t, BitPackedDelta::BlockSize> values, unpacked;
+    for (std::uint32_t& value: values) value = engine() & mask;
+    values[5] = mask; // all bits set
+
+    std::array<std::uint32_t, 4U * BitPackedDelta::MaxBitWidth> packed;
+    packed.fill(0xDEADBEEFU); // the packer must not rely on zeroed output
+    BitPackedDelta::packer(width)(values.data(), packed.data());
+    BitPackedDelta::unpacker(width)(packed.data(), unpacked.data());
+    BOOST_TEST_MESSAGE("Width: " << width);
+    BOOST_CHECK_EQUAL_COLLECTIONS
+      (unpacked.begin(), unpacked.end(), values.begin(), values.end());
+  } // for width
+
+} // BOOST_AUTO_TEST_CASE(PackingTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RoundTripTest) {
+
+  checkRoundTrip({});
+  checkRoundTrip({ -5 });
+  checkRoundTrip(std::vector<short>(300U, 1000)); // bit width 0
+  checkRoundTrip({ -32768, 32767, -32768, 32767, 0, -1 }); // bit width 17
+  for (std::size_t nTicks: { 127U, 128U, 129U, 1000U, 6000U })
+    checkRoundTrip(makeNoise(nTicks, 3.0, nTicks));
+
+  // a pulse on top of the noise
+  std::vector<short> adc = makeNoise(4096U, 2.0, 1U);
+  for (std::size_t i = 0; i < 40U; ++i) adc[2000U + i] += short(20 * i);
+  checkRoundTrip(adc);
+
+  // quiet waveforms take 2-3 bits per sample
+  raw::codec::ByteBuffer_t const data
+    = raw::codec::encodeBitPackedDelta(makeNoise(6016U, 0.7, 2U));
+  BOOST_CHECK_LT(data.size(), 6016U * 2U / 4U);
+
+} // BOOST_AUTO_TEST_CASE(RoundTripTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BufferTest) {
+
+  std::vector<short> const adc = makeNoise(1000U, 3.0, 3U);
+
+  // waveforms appended to the same buffer
+  raw::codec::ByteBuffer_t buffer;
+  raw::codec::encodeBitPackedDelta(adc.data(), 300U, buffer);
+  std::size_t const split = buffer.size();
+  raw::codec::encodeBitPackedDelta(adc.data() + 300U, 700U, buffer);
+  std::vector<short> first, second;
+  raw::codec::decodeBitPackedDelta(buffer.data(), split, first);
+  raw::codec::decodeBitPackedDelta
+    (buffer.data() + split, buffer.size() - split, second);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (first.begin(), first.end(), adc.begin(), adc.begin() + 300U);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (second.begin(), second.end(), adc.begin() + 300U, adc.end());
+
+  // malformed data
+  raw::codec::ByteBuffer_t data = raw::codec::encodeBitPackedDelta(adc);
+  BOOST_CHECK_THROW(
+    raw::codec::decodeBitPackedDelta(data.data(), 5U, first),
+    std::runtime_error
+    );
+  BOOST_CHECK_THROW(
+    raw::codec::decodeBitPackedDelta(data.data(), data.size() - 1U, first),
+    std::runtime_error
+    );
+  data[raw::codec::BitPackedDelta::HeaderSize] = 18U; // bit width too large
+  BOOST_CHECK_THROW(raw::codec::decodeBitPackedDelta(data), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(BufferTest)
+
+
+//------------------------------------------------------------------------------
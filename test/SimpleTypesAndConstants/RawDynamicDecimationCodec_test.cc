@@ -0,0 +1,280 @@
+/**
+ * @file   RawDynamicDecimationCodec_test.cc
+ * @brief  Test of RawDynamicDecimationCodec.h streaming decimation
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RawDynamicDecimationCodec_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawDynamicDecimationCodec.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <random>
+#include <algorithm> // std::min()
+#include <numeric> // std::accumulate()
+#include <cmath> // std::exp(), std::lround(), std::round()
+#include <cstdlib> // std::abs()
+#include <climits> // SHRT_MIN, SHRT_MAX
+#include <stdexcept> // std::domain_error, std::runtime_error
+
+
+//------------------------------------------------------------------------------
+/// Returns a waveform with a flat pedestal, some noise and one pulse.
+std::vector<short> makeWaveform
+  (std::size_t nTicks, short pedestal, double noiseRMS, std::size_t peak)
+{
+  std::mt19937 engine { 42U };
+  std::normal_distribution<double> noise { 0.0, noiseRMS };
+  std::vector<short> adc(nTicks);
+  for (std::size_t tick = 0; tick < nTicks; ++tick) {
+    double const dt = (double(tick) - double(peak)) / 4.0;
+    adc[tick] = static_cast<short>(std::lround
+      (pedestal + noise(engine) + 200.0 * std::exp(-0.5 * dt * dt)));
+  }
+  return adc;
+} // makeWaveform()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(FilterTest) {
+
+  using raw::codec::DynamicDecimationEncoder;
+
+  for (unsigned int decimation: { 2U, 4U, 8U }) {
+    std::vector<float> const filter
+      = DynamicDecimationEncoder::defaultFilter(decimation);
+    BOOST_CHECK_EQUAL(filter.size(), 4U * decimation + 1U);
+    BOOST_CHECK_CLOSE
+      (std::accumulate(filter.begin(), filter.end(), 0.0), 1.0, 1e-4);
+    for (std::size_t i = 0; i < filter.size(); ++i)
+      BOOST_CHECK_EQUAL(filter[i], filter[filter.size() - 1U - i]);
+  }
+  BOOST_CHECK_EQUAL(DynamicDecimationEncoder::defaultFilter(1U).size(), 1U);
+
+  DynamicDecimationEncoder::Config_t config;
+  config.blockSize = 30U; // not a multiple of 4
+  BOOST_CHECK_THROW(DynamicDecimationEncoder(config, 0), std::domain_error);
+  config.blockSize = 32U;
+  config.decimation = 0U;
+  BOOST_CHECK_THROW(DynamicDecimationEncoder(config, 0), std::domain_error);
+  config.decimation = 4U;
+  config.filter = { 0.25f, 0.5f, 0.25f, 0.0f }; // even
+  BOOST_CHECK_THROW(DynamicDecimationEncoder(config, 0), std::domain_error);
+  config.filter = { 2.0f, 2.0f, -1.0f }; // may overflow
+  BOOST_CHECK_THROW(DynamicDecimationEncoder(config, 0), std::domain_error);
+  config.filter = { 0.25f, 0.5f, 0.25f };
+  BOOST_CHECK_NO_THROW(DynamicDecimationEncoder(config, 0));
+
+} // BOOST_AUTO_TEST_CASE(FilterTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(DecimationTest) {
+
+  raw::codec::DynamicDecimationEncoder::Config_t config;
+  config.blockSize = 64U;
+  config.decimation = 4U;
+  config.threshold = 10;
+  config.guardTicks = 16U;
+
+  std::size_t const nTicks = 1000U; // last block is partial
+  std::size_t const peak = 500U;
+  std::vector<short> const adc = makeWaveform(nTicks, 800, 1.0, peak);
+
+  std::vector<raw::codec::DynamicDecimationBlock> const blocks
+    = raw::codec::encodeDynamicDecimation(adc, 800, config);
+
+  std::size_t nSamples = 0U, nextTick = 0U;
+  for (auto const& block: blocks) {
+    BOOST_CHECK_EQUAL(block.firstTick, nextTick);
+    nextTick += block.nTicks;
+    nSamples += block.samples.size();
+    // blocks within reach of the pulse are at full rate
+    bool const nearPeak = (block.firstTick <= peak + 40U)
+      && (block.firstTick + block.nTicks + 40U > peak);
+    if (nearPeak) BOOST_CHECK(block.isFullRate());
+    if (block.firstTick + block.nTicks + 100U < peak)
+      BOOST_CHECK(!block.isFullRate());
+  } // for
+  BOOST_CHECK_EQUAL(nextTick, nTicks);
+  BOOST_CHECK_LT(nSamples, nTicks / 2U);
+
+  std::vector<short> const decoded
+    = raw::codec::decodeDynamicDecimation(blocks);
+  BOOST_REQUIRE_EQUAL(decoded.size(), adc.size());
+  for (std::size_t tick = 0; tick < nTicks; ++tick) {
+    if (std::abs(adc[tick] - 800) > config.threshold) { // signal is exact
+      BOOST_CHECK_EQUAL(decoded[tick], adc[tick]);
+    }
+    else BOOST_CHECK_LE(std::abs(decoded[tick] - adc[tick]), 6);
+  } // for
+
+  // a flat waveform is reproduced exactly, and a short one too
+  std::vector<short> const flat(300U, 512);
+  std::vector<short> const flatDecoded = raw::codec::decodeDynamicDecimation
+    (raw::codec::encodeDynamicDecimation(flat, 512, config));
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (flatDecoded.begin(), flatDecoded.end(), flat.begin(), flat.end());
+  std::vector<short> const tiny { 3, 3, 3 };
+  std::vector<short> const tinyDecoded = raw::codec::decodeDynamicDecimation
+    (raw::codec::encodeDynamicDecimation(tiny, 3, config));
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (tinyDecoded.begin(), tinyDecoded.end(), tiny.begin(), tiny.end());
+
+} // BOOST_AUTO_TEST_CASE(DecimationTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(StreamingTest) {
+
+  raw::codec::DynamicDecimationEncoder::Config_t const config {};
+  std::vector<short> const adc = makeWaveform(5000U, 1000, 2.0, 3000U);
+
+  std::vector<raw::codec::DynamicDecimationBlock> const reference
+    = raw::codec::encodeDynamicDecimation(adc, 1000, config);
+
+  // push in chunks of varying size, decoding while encoding
+  raw::codec::DynamicDecimationEncoder encoder { config, 1000 };
+  raw::codec::DynamicDecimationDecoder decoder;
+  std::vector<raw::codec::DynamicDecimationBlock> blocks;
+  std::vector<short> decoded;
+  raw::codec::DynamicDecimationBlock block;
+  std::size_t pushed = 0U, chunk = 1U;
+  while (pushed < adc.size()) {
+    std::size_t const n = std::min(chunk, adc.size() - pushed);
+    encoder.push(adc.data() + pushed, n);
+    pushed += n;
+    chunk = (chunk * 7U) % 301U + 1U;
+    // blocks are available before the end of the waveform
+    while (encoder.pull(block)) {
+      BOOST_CHECK_LT(block.firstTick + block.nTicks, pushed);
+      decoder.decode(block, decoded);
+      blocks.push_back(block);
+    }
+  } // while
+  BOOST_CHECK_GT(blocks.size(), reference.size() / 2U);
+  encoder.flush();
+  while (encoder.pull(block)) {
+    decoder.decode(block, decoded);
+    blocks.push_back(block);
+  }
+  BOOST_CHECK_THROW(encoder.push(adc.data(), 1U), std::runtime_error);
+
+  BOOST_REQUIRE_EQUAL(blocks.size(), reference.size());
+  for (std::size_t i = 0; i < blocks.size(); ++i) {
+    BOOST_CHECK_EQUAL(blocks[i].firstTick, reference[i].firstTick);
+    BOOST_CHECK_EQUAL(blocks[i].decimation, reference[i].decimation);
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+      blocks[i].samples.begin(), blocks[i].samples.end(),
+      reference[i].samples.begin(), reference[i].samples.end()
+      );
+  }
+  BOOST_CHECK_EQUAL(decoder.nDecoded(), adc.size());
+  BOOST_CHECK_EQUAL(decoded.size(), adc.size());
+
+  // blocks out of order are rejected
+  raw::codec::DynamicDecimationDecoder other;
+  BOOST_CHECK_THROW(other.decode(reference[1], decoded), std::runtime_error);
+  raw::codec::DynamicDecimationBlock broken = reference[0];
+  broken.samples.pop_back();
+  BOOST_CHECK_THROW(other.decode(broken, decoded), std::runtime_error);
+
+  // the encoder can be reused
+  encoder.reset(1000);
+  encoder.push(adc);
+  encoder.flush();
+  BOOST_CHECK_EQUAL(encoder.nReady(), reference.size());
+
+} // BOOST_AUTO_TEST_CASE(StreamingTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EncodedFormTest) {
+
+  raw::codec::DynamicDecimationEncoder::Config_t config;
+  config.blockSize = 64U;
+  config.decimation = 4U;
+  config.threshold = 10;
+  std::vector<short> const adc = makeWaveform(1000U, 600, 1.0, 500U);
+
+  std::vector<raw::codec::DynamicDecimationBlock> const blocks
+    = raw::codec::encodeDynamicDecimation(adc, 600, config);
+  std::vector<short> encoded;
+  raw::codec::encodeDynamicDecimation(adc, 600, config, encoded);
+
+  std::size_t expectedSize = 0U;
+  for (auto const& block: blocks) expectedSize += block.encodedSize();
+  BOOST_CHECK_EQUAL(encoded.size(), expectedSize);
+  BOOST_CHECK_LT(encoded.size(), adc.size() / 2U); // mostly baseline
+
+  // the encoded form decodes as the blocks do
+  std::vector<short> const reference
+    = raw::codec::decodeDynamicDecimation(blocks);
+  std::vector<short> decoded;
+  raw::codec::decodeDynamicDecimation(encoded.data(), encoded.size(), decoded);
+  BOOST_CHECK_EQUAL_COLLECTIONS(
+    decoded.begin(), decoded.end(), reference.begin(), reference.end());
+
+  // single blocks
+  raw::codec::DynamicDecimationBlock block;
+  std::size_t const used
+    = block.read(encoded.data(), encoded.size(), 0U);
+  BOOST_CHECK_EQUAL(used, blocks.front().encodedSize());
+  BOOST_CHECK_EQUAL(block.firstTick, 0U);
+  BOOST_CHECK_EQUAL(block.nTicks, blocks.front().nTicks);
+  BOOST_CHECK_EQUAL(block.decimation, blocks.front().decimation);
+
+  // truncated and malformed data are rejected
+  BOOST_CHECK_THROW(
+    raw::codec::decodeDynamicDecimation
+      (encoded.data(), encoded.size() - 1U, decoded),
+    std::runtime_error
+    );
+  BOOST_CHECK_THROW(block.read(encoded.data(), 2U, 0U), std::runtime_error);
+  std::vector<short> broken = encoded;
+  broken[2] = 0; // decimation
+  BOOST_CHECK_THROW(block.read(broken.data(), broken.size(), 0U),
+    std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(EncodedFormTest)
+
+
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(LargeDecimationTest) {
+
+  // the largest decimation, with steps across the full range of `short`
+  unsigned int const decimation = 0xFFFFU;
+  raw::codec::DynamicDecimationBlock block;
+  block.nTicks = 3U * decimation;
+  block.decimation = decimation;
+  block.samples = { SHRT_MIN, SHRT_MAX, SHRT_MIN };
+
+  std::vector<short> encoded;
+  block.write(encoded);
+  std::vector<short> decoded;
+  raw::codec::decodeDynamicDecimation(encoded.data(), encoded.size(), decoded);
+  BOOST_REQUIRE_EQUAL(decoded.size(), block.nTicks);
+
+  // linear interpolation between the sample ticks, rounded half away from 0
+  for (std::size_t k = 0; k + 1U < block.samples.size(); ++k) {
+    std::size_t const t0 = block.sampleTick(k), t1 = block.sampleTick(k + 1U);
+    double const v0 = block.samples[k];
+    double const step = block.samples[k + 1U] - v0;
+    for (std::size_t tick = t0; tick <= t1; ++tick) {
+      double const shift = step * double(tick - t0) / double(t1 - t0);
+      BOOST_TEST_INFO("tick " << tick);
+      BOOST_CHECK_EQUAL(decoded[tick], v0 + std::round(shift));
+    }
+  } // for
+  BOOST_CHECK_EQUAL(decoded.front(), SHRT_MIN);
+  BOOST_CHECK_EQUAL(decoded.back(), SHRT_MIN);
+
+} // BOOST_AUTO_TEST_CASE(LargeDecimationTest)
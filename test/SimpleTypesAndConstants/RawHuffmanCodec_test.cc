@@ -0,0 +1,156 @@
+/**
+ * @file   RawHuffmanCodec_test.cc
+ * @brief  Test of RawHuffmanCodec.h waveform encoding
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RawHuffmanCodec_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawHuffmanCodec.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <random>
+#include <cmath> // std::exp(), std::lround()
+#include <stdexcept> // std::runtime_error
+
+
+//------------------------------------------------------------------------------
+/// Returns a waveform with pedestal, noise and a few pulses.
+std::vector<short> makeWaveform(std::size_t nTicks, unsigned int seed) {
+
+  std::mt19937 engine { seed };
+  std::normal_distribution<double> noise { 0.0, 2.0 };
+  std::vector<short> adc(nTicks);
+  for (std::size_t tick = 0; tick < nTicks; ++tick) {
+    double value = 900.0 + noise(engine);
+    for (std::size_t const peak: { nTicks / 5U, nTicks / 2U, nTicks * 4U / 5U })
+    {
+      double const dt = (double(tick) - double(peak)) / 6.0;
+      value += 150.0 * std::exp(-0.5 * dt * dt);
+    }
+    adc[tick] = static_cast<short>(std::lround(value));
+  }
+  return adc;
+
+} // makeWaveform()
+
+
+/// Decodes one bit at a time, as a reference.
+std::vector<short> decodeBitByBit(raw::codec::ByteBuffer_t const& data) {
+
+  std::size_t const nSamples = raw::codec::readUInt32(data.data());
+  raw::codec::BitReader reader { data.data() + 4U, data.size() - 4U };
+  std::vector<short> adc;
+  int prev = 0;
+  while (adc.size() < nSamples) {
+    unsigned int length = 1U;
+    while (reader.read(1U) == 0U) {
+      if (++length > raw::codec::Huffman::EscapeBits) break;
+    }
+    if (length > raw::codec::Huffman::EscapeBits)
+      prev = static_cast<short>(reader.read(16U));
+    else prev += raw::codec::Huffman::codeDelta(length);
+    adc.push_back(static_cast<short>(prev));
+  }
+  return adc;
+
+} // decodeBitByBit()
+
+
+void checkRoundTrip(std::vector<short> const& adc) {
+
+  raw::codec::ByteBuffer_t const data = raw::codec::encodeHuffman(adc);
+  std::vector<short> const decoded = raw::codec::decodeHuffman(data);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (decoded.begin(), decoded.end(), adc.begin(), adc.end());
+
+  std::vector<short> const reference = decodeBitByBit(data);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (reference.begin(), reference.end(), adc.begin(), adc.end());
+
+} // checkRoundTrip()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(CodeTest) {
+
+  using raw::codec::Huffman;
+
+  for (int delta = -Huffman::MaxDelta; delta <= Huffman::MaxDelta; ++delta)
+    BOOST_CHECK_EQUAL(Huffman::codeDelta(Huffman::codeLength(delta)), delta);
+  BOOST_CHECK_EQUAL(Huffman::codeLength(0), 1U);
+  BOOST_CHECK_EQUAL(Huffman::codeLength(-1), 2U);
+  BOOST_CHECK_EQUAL(Huffman::codeLength(+1), 3U);
+  BOOST_CHECK_EQUAL(Huffman::codeLength(+3), Huffman::EscapeBits);
+
+  // eight samples without changes are one byte
+  std::vector<short> const flat(64U, 0);
+  BOOST_CHECK_EQUAL(raw::codec::encodeHuffman(flat).size(), 4U + 8U);
+
+  Huffman::LookupTable_t const& table = Huffman::lookupTable();
+  BOOST_CHECK_EQUAL(table[0b11111111111] & 0xFU, Huffman::MaxSymbolsPerLookup);
+  BOOST_CHECK_EQUAL(table[0b00000000000] & 0xFU, 0U); // escape
+  BOOST_CHECK_EQUAL(table[0b10000000010] & 0xFFU, (2U << 4U) | 1U); // "01"
+
+} // BOOST_AUTO_TEST_CASE(CodeTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RoundTripTest) {
+
+  checkRoundTrip({});
+  checkRoundTrip({ 0 });
+  checkRoundTrip({ 1000 });
+  checkRoundTrip({ -32768, 32767, -32768, 0, -1, -4, -1, 2, 5, 2 });
+  checkRoundTrip(std::vector<short>(1000U, 2048));
+  checkRoundTrip(makeWaveform(6000U, 1U));
+  checkRoundTrip(makeWaveform(4493U, 2U));
+
+  // all the differences in sequence, and at all the bit offsets
+  std::vector<short> adc { 100 };
+  for (int i = 0; i < 500; ++i) adc.push_back(adc.back() + (i % 9) - 4);
+  checkRoundTrip(adc);
+
+} // BOOST_AUTO_TEST_CASE(RoundTripTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BufferTest) {
+
+  std::vector<short> const adc = makeWaveform(3000U, 3U);
+
+  // waveforms appended to the same buffer
+  raw::codec::ByteBuffer_t buffer;
+  raw::codec::encodeHuffman(adc.data(), 1000U, buffer);
+  std::size_t const split = buffer.size();
+  raw::codec::encodeHuffman(adc.data() + 1000U, 2000U, buffer);
+
+  std::vector<short> first, second;
+  raw::codec::decodeHuffman(buffer.data(), split, first);
+  raw::codec::decodeHuffman
+    (buffer.data() + split, buffer.size() - split, second);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (first.begin(), first.end(), adc.begin(), adc.begin() + 1000U);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (second.begin(), second.end(), adc.begin() + 1000U, adc.end());
+
+  // malformed data
+  raw::codec::ByteBuffer_t data = raw::codec::encodeHuffman(adc);
+  BOOST_CHECK_THROW
+    (raw::codec::decodeHuffman(data.data(), 3U, first), std::runtime_error);
+  BOOST_CHECK_THROW(
+    raw::codec::decodeHuffman(data.data(), data.size() / 2U, first),
+    std::runtime_error
+    );
+  data[3] = 0x7F; // sample count larger than the data can hold
+  BOOST_CHECK_THROW(raw::codec::decodeHuffman(data), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(BufferTest)
+
+
+//------------------------------------------------------------------------------
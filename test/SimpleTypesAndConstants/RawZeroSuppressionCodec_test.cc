@@ -0,0 +1,154 @@
+/**
+ * @file   RawZeroSuppressionCodec_test.cc
+ * @brief  Test of RawZeroSuppressionCodec.h waveform zero suppression
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RawZeroSuppressionCodec_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawZeroSuppressionCodec.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <random>
+#include <cstdlib> // std::abs()
+#include <stdexcept> // std::runtime_error
+
+
+//------------------------------------------------------------------------------
+/// Returns the waveform with the samples not kept set to the pedestal.
+std::vector<short> expectedDecoding(
+  std::vector<short> const& adc, short pedestal,
+  raw::codec::ZeroSuppressionEncoder::Config_t const& config
+) {
+  std::vector<bool> keep(adc.size(), false);
+  for (std::size_t tick = 0; tick < adc.size(); ++tick) {
+    if (std::abs(adc[tick] - pedestal) <= config.threshold) continue;
+    std::size_t const first
+      = (tick > config.preSamples)? tick - config.preSamples: 0U;
+    for (std::size_t t = first; t <= tick + config.postSamples; ++t)
+      if (t < adc.size()) keep[t] = true;
+  }
+  std::vector<short> expected(adc.size());
+  for (std::size_t tick = 0; tick < adc.size(); ++tick)
+    expected[tick] = keep[tick]? adc[tick]: pedestal;
+  return expected;
+} // expectedDecoding()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RegionTest) {
+
+  raw::codec::ZeroSuppressionEncoder encoder
+    ({ /* threshold */ 5, /* pre */ 2U, /* post */ 3U });
+
+  std::vector<short> adc(40U, 100);
+  adc[1] = 106; // region clipped at the start: [ 0, 5 )
+  adc[20] = 94; // below pedestal, alone: [ 18, 24 )
+  adc[25] = 105; // exactly at threshold: not kept
+  adc[26] = 110; // touching the previous region: merged into [ 18, 30 )
+  adc[39] = 200; // region clipped at the end: [ 37, 40 )
+
+  std::vector<short> const encoded = encoder.encode(adc, 100);
+  raw::codec::ZeroSuppressedWaveform const waveform { encoded };
+  BOOST_CHECK_EQUAL(waveform.nTicks(), adc.size());
+  BOOST_CHECK_EQUAL(waveform.pedestal(), 100);
+  BOOST_CHECK_EQUAL(waveform.nROIs(), 3U);
+  BOOST_CHECK_EQUAL(waveform.nSamples(), 5U + 12U + 3U);
+  BOOST_CHECK_EQUAL(waveform.encodedSize(), encoded.size());
+
+  std::vector<std::pair<std::size_t, std::size_t>> const expected
+    { { 0U, 5U }, { 18U, 30U }, { 37U, 40U } };
+  std::size_t iROI = 0U;
+  for (raw::codec::ROI const& roi: waveform) {
+    BOOST_REQUIRE_LT(iROI, expected.size());
+    BOOST_CHECK_EQUAL(roi.begin, expected[iROI].first);
+    BOOST_CHECK_EQUAL(roi.end(), expected[iROI].second);
+    // the samples are read in place
+    BOOST_CHECK(roi.data >= encoded.data());
+    BOOST_CHECK(roi.data + roi.size <= encoded.data() + encoded.size());
+    for (std::size_t tick = roi.begin; tick < roi.end(); ++tick)
+      BOOST_CHECK_EQUAL(roi[tick], adc[tick]);
+    ++iROI;
+  }
+  BOOST_CHECK_EQUAL(iROI, expected.size());
+
+  // no sample above threshold
+  std::vector<short> const flat(1000U, 100);
+  raw::codec::ZeroSuppressedWaveform const empty { encoder.encode(flat, 100) };
+  BOOST_CHECK_EQUAL(empty.nROIs(), 0U);
+  BOOST_CHECK(empty.begin() == empty.end());
+  std::vector<short> const decoded
+    = raw::codec::decodeZeroSuppression(encoder.encode(flat, 100));
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (decoded.begin(), decoded.end(), flat.begin(), flat.end());
+
+} // BOOST_AUTO_TEST_CASE(RegionTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(BatchTest) {
+
+  raw::codec::ZeroSuppressionEncoder::Config_t const config
+    { /* threshold */ 8, /* pre */ 4U, /* post */ 6U };
+  raw::codec::ZeroSuppressionEncoder encoder { config };
+
+  std::mt19937 engine { 12345U };
+  std::normal_distribution<double> noise { 0.0, 3.0 };
+  std::vector<std::vector<short>> channels;
+  std::vector<short> pedestals;
+  for (std::size_t nTicks: { 0U, 1U, 7U, 64U, 1001U, 6000U }) {
+    short const pedestal = static_cast<short>(500 + 10 * channels.size());
+    std::vector<short> adc(nTicks);
+    for (short& sample: adc)
+      sample = static_cast<short>(pedestal + noise(engine));
+    channels.push_back(std::move(adc));
+    pedestals.push_back(pedestal);
+  }
+
+  std::vector<std::vector<short>> const encoded
+    = encoder.encode(channels, pedestals);
+  BOOST_REQUIRE_EQUAL(encoded.size(), channels.size());
+  for (std::size_t i = 0; i < channels.size(); ++i) {
+    std::vector<short> const expected
+      = expectedDecoding(channels[i], pedestals[i], config);
+    std::vector<short> const decoded
+      = raw::codec::decodeZeroSuppression(encoded[i]);
+    BOOST_CHECK_EQUAL_COLLECTIONS
+      (decoded.begin(), decoded.end(), expected.begin(), expected.end());
+  }
+
+  BOOST_CHECK_THROW
+    (encoder.encode(channels, { 1, 2 }), std::length_error);
+
+} // BOOST_AUTO_TEST_CASE(BatchTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MalformedTest) {
+
+  raw::codec::ZeroSuppressionEncoder encoder
+    ({ /* threshold */ 5, /* pre */ 1U, /* post */ 1U });
+  std::vector<short> adc(100U, 0);
+  adc[10] = 50;
+  adc[50] = 50;
+  std::vector<short> encoded = encoder.encode(adc, 0);
+
+  using raw::codec::ZeroSuppressedWaveform;
+  BOOST_CHECK_THROW
+    (ZeroSuppressedWaveform(encoded.data(), 4U), std::runtime_error);
+  BOOST_CHECK_THROW(
+    ZeroSuppressedWaveform(encoded.data(), encoded.size() - 1U),
+    std::runtime_error
+    );
+  encoded[ZeroSuppressedWaveform::HeaderSize] = 60; // overlapping regions
+  BOOST_CHECK_THROW(ZeroSuppressedWaveform{ encoded }, std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(MalformedTest)
+
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,134 @@
+/**
+ * @file   geo_compact_id_test.cc
+ * @brief  Test of geo_compact_id.h compact IDs
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_compact_id_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_compact_id.h"
+
+// C/C++ standard libraries
+#include <sstream>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// compile-time checks
+static_assert(sizeof(geo::CompactCryostatID) == sizeof(unsigned int));
+static_assert(sizeof(geo::CompactWireID) == 4U * sizeof(unsigned int));
+static_assert(sizeof(geo::CompactWireID) < sizeof(geo::WireID));
+static_assert(sizeof(readout::CompactROPID) < sizeof(readout::ROPID));
+
+static_assert(!geo::CompactWireID{}.isValid());
+static_assert(geo::CompactWireID{ 0, 1, 2, 3 }.isValid());
+static_assert
+  (geo::CompactWireID{ 0, 1, 2, 3 }.toID() == geo::WireID{ 0, 1, 2, 3 });
+static_assert(geo::compactID(geo::PlaneID{ 1, 2, 0 }).Plane == 0U);
+
+
+//------------------------------------------------------------------------------
+template <typename ID>
+void checkRoundTrip(ID const& id) {
+
+  auto const compact = compactID(id); // geo:: or readout:: (ADL)
+  BOOST_TEST_MESSAGE("  " << id << " => " << compact);
+  BOOST_CHECK_EQUAL(compact.isValid(), id.isValid);
+  BOOST_CHECK_EQUAL(bool(compact), id.isValid);
+  BOOST_CHECK_EQUAL(!compact, !id.isValid);
+
+  ID const back = compact.toID();
+  BOOST_CHECK_EQUAL(back.isValid, id.isValid);
+  if (id.isValid) {
+    BOOST_CHECK_EQUAL(back, id);
+    BOOST_CHECK_EQUAL(ID(compact), id);
+    BOOST_CHECK_EQUAL(decltype(compact){ back }, compact);
+  }
+  else { // the cryostat index is lost, the others are preserved
+    BOOST_CHECK_EQUAL(back.Cryostat, geo::CryostatID::InvalidID);
+    BOOST_CHECK_EQUAL(back.deepestIndex(), id.deepestIndex());
+  }
+
+  std::ostringstream sID, sCompact;
+  sID << back;
+  sCompact << compact;
+  BOOST_CHECK_EQUAL(sCompact.str(), sID.str());
+
+} // checkRoundTrip()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GeometryIDtest) {
+
+  checkRoundTrip(geo::CryostatID{ 2 });
+  checkRoundTrip(geo::CryostatID{});
+  checkRoundTrip(geo::OpDetID{ 1, 15 });
+  checkRoundTrip(geo::TPCID{ 1, 7 });
+  checkRoundTrip(geo::TPCID{});
+  checkRoundTrip(geo::PlaneID{ 0, 3, 2 });
+  checkRoundTrip(geo::WireID{ 1, 11, 2, 4095 });
+  checkRoundTrip(geo::WireID{});
+
+  geo::WireID invalid { 1, 11, 2, 4095 };
+  invalid.markInvalid();
+  checkRoundTrip(invalid);
+
+  geo::CompactWireID wid { 1, 2, 3, 4 };
+  BOOST_CHECK(wid.isValid());
+  wid.markInvalid();
+  BOOST_CHECK(!wid.isValid());
+  BOOST_CHECK_EQUAL(wid.Wire, 4U);
+
+} // BOOST_AUTO_TEST_CASE(GeometryIDtest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReadoutIDtest) {
+
+  checkRoundTrip(readout::TPCsetID{ 1, 3 });
+  checkRoundTrip(readout::TPCsetID{});
+  checkRoundTrip(readout::ROPID{ 0, 2, 1 });
+  checkRoundTrip(readout::ROPID{});
+
+} // BOOST_AUTO_TEST_CASE(ReadoutIDtest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ComparisonTest) {
+
+  geo::CompactWireID const a { 0, 1, 2, 3 }, b { 0, 1, 2, 4 }, c { 0, 2, 0, 0 };
+  BOOST_CHECK(a == a);
+  BOOST_CHECK(a != b);
+  BOOST_CHECK(a < b);
+  BOOST_CHECK(b < c);
+  BOOST_CHECK(!(c < a));
+  BOOST_CHECK_EQUAL(a < c, a.toID() < c.toID());
+
+  readout::CompactROPID const r1 { 0, 1, 2 }, r2 { 1, 0, 0 };
+  BOOST_CHECK(r1 < r2);
+  BOOST_CHECK(r1 != r2);
+  BOOST_CHECK(r1 == readout::compactID(readout::ROPID{ 0, 1, 2 }));
+
+  // the comparisons agree with the regular IDs, invalid IDs included
+  std::vector<geo::CompactWireID> ids { geo::CompactWireID{} };
+  for (unsigned int c = 0; c < 2; ++c)
+    for (unsigned int t = 0; t < 2; ++t)
+      for (unsigned int p = 0; p < 2; ++p)
+        for (unsigned int w = 0; w < 2; ++w) ids.emplace_back(c, t, p, w);
+  ids.emplace_back(geo::CryostatID::InvalidID, 0, 1, 0);
+  for (geo::CompactWireID const& x: ids) {
+    for (geo::CompactWireID const& y: ids) {
+      BOOST_CHECK_EQUAL(x == y, x.toID() == y.toID());
+      BOOST_CHECK_EQUAL(x < y, x.toID() < y.toID());
+      BOOST_CHECK_EQUAL(static_cast<geo::CompactPlaneID const&>(x)
+        < static_cast<geo::CompactPlaneID const&>(y),
+        x.toID().asPlaneID() < y.toID().asPlaneID());
+      if (x.isValid() && !y.isValid()) BOOST_CHECK(x < y);
+    } // for y
+  } // for x
+
+} // BOOST_AUTO_TEST_CASE(ComparisonTest)
@@ -0,0 +1,188 @@
+/**
+ * @file   geo_id_compare_benchmark.cc
+ * @brief  Benchmark of the comparison of geometry IDs
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_id_compare_benchmark [nIDs [repeat]]
+ *
+ * The ordering of `geo::WireID` is timed in:
+ *  * sorting `nIDs` random wire IDs with `std::sort()`;
+ *  * looking up `nIDs` random wire IDs with `std::lower_bound()` in them;
+ * using:
+ *  * `operator<`, as shipped (level by level through `cmp()`);
+ *  * `operator<=>`, as shipped (only when the compiler supports it);
+ *  * a reference comparing the indices packed in pairs into 64-bit keys,
+ *    without branching at each level (not shipped: it was measured not to
+ *    speed up the sort, and to slow down the lookups).
+ *
+ * The time per ID (best of `repeat` passes; the copy of the input excluded
+ * from the sort) is printed, with its ratio to `operator<`. The program fails
+ * if the comparisons do not yield the same results.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm> // std::sort(), std::lower_bound(), std::max()
+#include <functional> // std::less
+#include <cstdint> // std::uint64_t
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS, EXIT_FAILURE
+
+
+//------------------------------------------------------------------------------
+/// Comparison of wire IDs packing (cryostat, TPC) and (plane, wire) as keys.
+struct PackedLess {
+
+  static constexpr std::uint64_t join(unsigned int high, unsigned int low)
+    { return (std::uint64_t(high) << 32U) | std::uint64_t(low); }
+
+  bool operator() (geo::WireID const& a, geo::WireID const& b) const
+    {
+      std::uint64_t const ah = join(a.Cryostat, a.TPC);
+      std::uint64_t const bh = join(b.Cryostat, b.TPC);
+      return (ah < bh)
+        | ((ah == bh) & (join(a.Plane, a.Wire) < join(b.Plane, b.Wire)));
+    }
+
+}; // struct PackedLess
+
+
+#if __cpp_impl_three_way_comparison >= 201907L
+/// Ordering of wire IDs through their `operator<=>`.
+struct SpaceshipLess {
+  bool operator() (geo::WireID const& a, geo::WireID const& b) const
+    { return (a <=> b) < 0; }
+}; // struct SpaceshipLess
+#endif // __cpp_impl_three_way_comparison
+
+
+/// Times and results of sorting and looking up with one comparison.
+struct Result {
+  double sortTime = 0.0; ///< Best time for the sort [ns].
+  double lookupTime = 0.0; ///< Best time for all the lookups [ns].
+  std::vector<geo::WireID> sorted; ///< The sorted IDs.
+  std::size_t found = 0U; ///< Sum of the positions of the lookups.
+}; // struct Result
+
+
+/// Sorts a copy of `input` and looks up all `lookups` in it with `less`.
+template <typename Less>
+Result timeOrdering(
+  unsigned int repeat,
+  std::vector<geo::WireID> const& input,
+  std::vector<geo::WireID> const& lookups,
+  Less less
+) {
+  Result result;
+  result.sortTime = -1.0;
+  for (unsigned int pass = 0; pass < std::max(repeat, 1U); ++pass) {
+    result.sorted = input;
+    double const time = bestTime(1U, [&result, less](){
+        std::sort(result.sorted.begin(), result.sorted.end(), less);
+      });
+    if ((result.sortTime < 0.0) || (time < result.sortTime))
+      result.sortTime = time;
+  }
+
+  std::vector<geo::WireID> const& sorted = result.sorted;
+  result.lookupTime = bestTime(repeat, [&](){
+      result.found = 0U;
+      for (geo::WireID const& id: lookups) {
+        result.found
+          += std::lower_bound(sorted.begin(), sorted.end(), id, less)
+          - sorted.begin();
+      }
+    });
+  return result;
+} // timeOrdering()
+
+
+/// Prints the times per ID of `result`, and their ratio to `reference`.
+void printResult(
+  std::string const& name, Result const& result, Result const& reference,
+  std::size_t n
+) {
+  if (n == 0U) return;
+  std::cout << "  " << std::left << std::setw(14) << name << std::right
+    << std::fixed << std::setprecision(2)
+    << std::setw(10) << (result.sortTime / n)
+    << std::setw(8) << (result.sortTime / reference.sortTime)
+    << std::setw(10) << (result.lookupTime / n)
+    << std::setw(8) << (result.lookupTime / reference.lookupTime)
+    << std::endl;
+} // printResult()
+
+
+/// Returns whether `result` matches `reference`.
+bool sameResult(Result const& result, Result const& reference) {
+  return (result.sorted == reference.sorted)
+    && (result.found == reference.found);
+} // sameResult()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const n
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 5U;
+
+  std::mt19937 engine { 12345U };
+  std::uniform_int_distribution<unsigned int> cryo(0U, 1U);
+  std::uniform_int_distribution<unsigned int> tpc(0U, 11U);
+  std::uniform_int_distribution<unsigned int> plane(0U, 2U);
+  std::uniform_int_distribution<unsigned int> wire(0U, 4999U);
+  auto randomIDs = [&](){
+      std::vector<geo::WireID> IDs;
+      IDs.reserve(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        IDs.emplace_back
+          (cryo(engine), tpc(engine), plane(engine), wire(engine));
+      }
+      return IDs;
+    };
+  std::vector<geo::WireID> const IDs = randomIDs();
+  std::vector<geo::WireID> const lookups = randomIDs();
+
+  std::cout << "Ordering " << n << " wire IDs\n"
+    << "  [ns/ID]            std::sort()    std::lower_bound()" << std::endl;
+
+  bool same = true;
+
+  Result const less
+    = timeOrdering(repeat, IDs, lookups, std::less<geo::WireID>{});
+  printResult("operator<", less, less, n);
+
+#if __cpp_impl_three_way_comparison >= 201907L
+  Result const spaceship
+    = timeOrdering(repeat, IDs, lookups, SpaceshipLess{});
+  printResult("operator<=>", spaceship, less, n);
+  same = same && sameResult(spaceship, less);
+#else
+  std::cout << "  (operator<=> not supported by this compiler)" << std::endl;
+#endif // __cpp_impl_three_way_comparison
+
+  Result const packed = timeOrdering(repeat, IDs, lookups, PackedLess{});
+  printResult("packed keys", packed, less, n);
+  same = same && sameResult(packed, less);
+
+  std::cout << "(checksum: " << less.found << ")" << std::endl;
+
+  if (!same) {
+    std::cerr << "The comparisons do not yield the same order." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+} // main()
@@ -0,0 +1,148 @@
+/**
+ * @file   geo_id_containers_test.cc
+ * @brief  Test of geo_id_containers.h containers
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_id_containers_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_containers.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::out_of_range
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GeoIDmapperTest) {
+
+  geo::GeoIDmapper<geo::PlaneID> const mapper({ 2U, 4U, 3U });
+
+  BOOST_CHECK_EQUAL(mapper.size(), 24U);
+  BOOST_CHECK_EQUAL(mapper.extent<0U>(), 2U);
+  BOOST_CHECK_EQUAL(mapper.extent<1U>(), 4U);
+  BOOST_CHECK_EQUAL(mapper.extent<2U>(), 3U);
+
+  BOOST_CHECK_EQUAL(mapper.index({ 0, 0, 0 }), 0U);
+  BOOST_CHECK_EQUAL(mapper.index({ 0, 0, 2 }), 2U);
+  BOOST_CHECK_EQUAL(mapper.index({ 0, 1, 0 }), 3U);
+  BOOST_CHECK_EQUAL(mapper.index({ 1, 0, 0 }), 12U);
+  BOOST_CHECK_EQUAL(mapper.index({ 1, 3, 2 }), 23U);
+
+  BOOST_CHECK_EQUAL(mapper.firstID(), geo::PlaneID(0, 0, 0));
+  BOOST_CHECK_EQUAL(mapper.lastID(), geo::PlaneID(1, 3, 2));
+
+  // the linear index follows the ID ordering
+  for (std::size_t i = 0; i < mapper.size(); ++i) {
+    geo::PlaneID const pid = mapper.ID(i);
+    BOOST_CHECK(pid.isValid);
+    BOOST_CHECK(mapper.hasElement(pid));
+    BOOST_CHECK_EQUAL(mapper.index(pid), i);
+    if (i > 0) BOOST_CHECK(mapper.ID(i - 1) < pid);
+  } // for
+
+  BOOST_CHECK(!mapper.hasElement({ 2, 0, 0 }));
+  BOOST_CHECK(!mapper.hasElement({ 0, 4, 0 }));
+  BOOST_CHECK(!mapper.hasElement({ 0, 0, 3 }));
+  BOOST_CHECK(!mapper.hasElement(geo::PlaneID{}));
+
+  // only the indices matter, not the validity flag
+  geo::PlaneID invalid { 1, 2, 0 };
+  invalid.markInvalid();
+  BOOST_CHECK(mapper.hasElement(invalid));
+  BOOST_CHECK_EQUAL(mapper.index(invalid), 18U);
+  invalid.Plane = 3;
+  BOOST_CHECK(!mapper.hasElement(invalid));
+
+} // BOOST_AUTO_TEST_CASE(GeoIDmapperTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyMapperTest) {
+
+  geo::GeoIDmapper<geo::TPCID> const def;
+  BOOST_CHECK(def.empty());
+  BOOST_CHECK_EQUAL(def.size(), 0U);
+  BOOST_CHECK(!def.firstID().isValid);
+  BOOST_CHECK(!def.lastID().isValid);
+
+  // one of the levels has no element
+  geo::GeoIDmapper<geo::PlaneID> const noPlanes({ 2U, 4U, 0U });
+  BOOST_CHECK(noPlanes.empty());
+  BOOST_CHECK(!noPlanes.firstID().isValid);
+  BOOST_CHECK(!noPlanes.lastID().isValid);
+  BOOST_CHECK(!noPlanes.hasElement({ 0, 0, 0 }));
+
+  geo::PlaneDataContainer<int> const data;
+  BOOST_CHECK(data.empty());
+  BOOST_CHECK(!data.firstID().isValid);
+  BOOST_CHECK(!data.lastID().isValid);
+
+} // BOOST_AUTO_TEST_CASE(EmptyMapperTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PlaneDataContainerTest) {
+
+  geo::PlaneDataContainer<int> data({ 2U, 4U, 3U }, -1);
+
+  BOOST_CHECK_EQUAL(data.size(), 24U);
+  BOOST_CHECK(!data.empty());
+  for (int value: data) BOOST_CHECK_EQUAL(value, -1);
+
+  int count = 0;
+  for (unsigned int c = 0; c < 2; ++c)
+    for (unsigned int t = 0; t < 4; ++t)
+      for (unsigned int p = 0; p < 3; ++p)
+        data[{ c, t, p }] = count++;
+
+  // iteration follows the ID order
+  int expected = 0;
+  for (int value: data) BOOST_CHECK_EQUAL(value, expected++);
+
+  BOOST_CHECK_EQUAL((data[{ 1, 2, 1 }]), 19);
+  BOOST_CHECK_EQUAL((data.at({ 1, 2, 1 })), 19);
+  BOOST_CHECK_EQUAL(data.front(), 0);
+  BOOST_CHECK_EQUAL(data.back(), 23);
+  BOOST_CHECK_EQUAL(data.ID(19), geo::PlaneID(1, 2, 1));
+  BOOST_CHECK_EQUAL(data.indexOf({ 1, 2, 1 }), 19U);
+  BOOST_CHECK_THROW(data.at({ 1, 4, 1 }), std::out_of_range);
+  BOOST_CHECK_THROW(data.at(geo::PlaneID{}), std::out_of_range);
+
+  int sum = 0;
+  data.apply([&sum](int value){ sum += value; });
+  BOOST_CHECK_EQUAL(sum, 23 * 24 / 2);
+
+  data.fill(5);
+  for (int value: data) BOOST_CHECK_EQUAL(value, 5);
+
+  data.resize({ 1U, 2U, 3U }, 7);
+  BOOST_CHECK_EQUAL(data.size(), 6U);
+  BOOST_CHECK_EQUAL((data[{ 0, 1, 2 }]), 7);
+
+  data.clear();
+  BOOST_CHECK(data.empty());
+
+} // BOOST_AUTO_TEST_CASE(PlaneDataContainerTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ROPDataContainerTest) {
+
+  readout::ROPDataContainer<double> const data({ 1U, 6U, 4U }, 1.5);
+
+  BOOST_CHECK_EQUAL(data.size(), 24U);
+  BOOST_CHECK_EQUAL(data.extent<1U>(), 6U);
+  BOOST_CHECK_EQUAL((data[{ 0, 5, 3 }]), 1.5);
+  BOOST_CHECK_EQUAL(data.lastID(), readout::ROPID(0, 5, 3));
+  BOOST_CHECK(!data.hasElement({ 0, 6, 0 }));
+
+  geo::TPCDataContainer<std::vector<int>> tpcs({ 2U, 2U });
+  tpcs[{ 1, 1 }].push_back(3);
+  BOOST_CHECK_EQUAL((tpcs[{ 1, 1 }].size()), 1U);
+  BOOST_CHECK((tpcs[{ 0, 1 }].empty()));
+
+} // BOOST_AUTO_TEST_CASE(ROPDataContainerTest)
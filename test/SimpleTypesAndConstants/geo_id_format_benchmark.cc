@@ -0,0 +1,97 @@
+/**
+ * @file   geo_id_format_benchmark.cc
+ * @brief  Benchmark of the formatting of geometry IDs into text
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_id_format_benchmark [nIDs [repeat]]
+ *
+ * `nIDs` wire IDs are formatted with:
+ *  * `geo::IDstring` (no allocation);
+ *  * `toString()` (one allocation for the returned string);
+ *  * a new `std::ostringstream` for each ID, as `toString()` used to do;
+ *  * `operator<<` into a single stream, with default formatting;
+ *  * `operator<<` into a single stream with `std::hex`, which streams the
+ *    indices one by one.
+ *
+ * The time per ID (best of `repeat` passes) is printed.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS
+
+
+//------------------------------------------------------------------------------
+/// Prints the time per ID of a formatting method.
+void printResult(std::string const& name, double time, std::size_t nIDs) {
+  std::cout << "  " << std::left << std::setw(28) << name << std::right
+    << std::setw(10) << std::fixed << std::setprecision(1)
+    << (time / nIDs) << " ns/ID" << std::endl;
+} // printResult()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const nIDs
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 5U;
+
+  std::vector<geo::WireID> IDs;
+  IDs.reserve(nIDs);
+  for (std::size_t i = 0; i < nIDs; ++i) {
+    IDs.emplace_back
+      (i % 2U, (i / 2U) % 150U, (i / 300U) % 3U, (i * 7919U) % 4800U);
+  }
+
+  std::size_t length = 0U; // prevents the formatting from being optimised away
+
+  std::cout << "Formatting " << nIDs << " wire IDs:" << std::endl;
+
+  printResult("geo::IDstring", bestTime(repeat, [&IDs, &length](){
+      for (geo::WireID const& id: IDs)
+        length += geo::IDstring<geo::WireID>{ id }.size();
+    }), nIDs);
+
+  printResult("toString()", bestTime(repeat, [&IDs, &length](){
+      for (geo::WireID const& id: IDs) length += id.toString().size();
+    }), nIDs);
+
+  printResult("std::ostringstream per ID", bestTime(repeat, [&IDs, &length](){
+      for (geo::WireID const& id: IDs) {
+        std::ostringstream sstr;
+        sstr << "C:" << id.Cryostat << " T:" << id.TPC << " P:" << id.Plane
+          << " W:" << id.Wire;
+        length += sstr.str().size();
+      }
+    }), nIDs);
+
+  printResult("operator<< (default)", bestTime(repeat, [&IDs, &length](){
+      std::ostringstream sstr;
+      for (geo::WireID const& id: IDs) sstr << id << '\n';
+      length += sstr.str().size();
+    }), nIDs);
+
+  printResult("operator<< (std::hex)", bestTime(repeat, [&IDs, &length](){
+      std::ostringstream sstr;
+      sstr << std::hex;
+      for (geo::WireID const& id: IDs) sstr << id << '\n';
+      length += sstr.str().size();
+    }), nIDs);
+
+  std::cout << "(" << length << " characters)" << std::endl;
+
+  return EXIT_SUCCESS;
+
+} // main()
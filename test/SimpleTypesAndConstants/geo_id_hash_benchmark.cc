@@ -0,0 +1,175 @@
+/**
+ * @file   geo_id_hash_benchmark.cc
+ * @brief  Benchmark of `std::hash` of geometry IDs against xor-based hashes
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_id_hash_benchmark [scale [repeat]]
+ *
+ * Wire ID sets with the size of a few detectors are hashed by
+ * `std::hash<geo::WireID>` and by a hand-rolled hash xor'ing shifted
+ * indices and by a plain xor of the indices, as often found in user code.
+ * For each set and hash the number of distinct hash values, the longest
+ * bucket of an `std::unordered_set` and the time of its insertion and of
+ * lookups (hits and misses, in random order; best of `repeat` passes) are
+ * printed. The plain xor collides so much that filling a container is
+ * quadratic, so only its number of distinct values and the largest group of
+ * IDs sharing a value are printed.
+ * The number of wires of each plane is multiplied by `scale`.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <unordered_set>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm> // std::shuffle(), std::sort(), std::upper_bound()
+#include <cstdlib> // std::strtod(), std::strtoul(), EXIT_SUCCESS
+
+
+//------------------------------------------------------------------------------
+/// Hand-rolled hash of the kind `std::hash` replaces.
+struct XorWireIDhash {
+  std::size_t operator() (geo::WireID const& id) const noexcept
+    {
+      return (std::size_t(id.Cryostat) << 28U) ^ (std::size_t(id.TPC) << 20U)
+        ^ (std::size_t(id.Plane) << 16U) ^ std::size_t(id.Wire);
+    }
+}; // struct XorWireIDhash
+
+
+/// Plain xor of the indices, which collides on most detector layouts.
+struct PlainXorWireIDhash {
+  std::size_t operator() (geo::WireID const& id) const noexcept
+    { return id.Cryostat ^ id.TPC ^ id.Plane ^ id.Wire; }
+}; // struct PlainXorWireIDhash
+
+
+/// Detector extents.
+struct Detector_t {
+  std::string name;
+  unsigned int nCryostats;
+  unsigned int nTPCs;
+  unsigned int nPlanes;
+  unsigned int nWires;
+}; // struct Detector_t
+
+
+/// Returns all the wire IDs of the detector.
+std::vector<geo::WireID> makeWireIDs(Detector_t const& detector) {
+  std::vector<geo::WireID> IDs;
+  for (unsigned int c = 0; c < detector.nCryostats; ++c)
+    for (unsigned int t = 0; t < detector.nTPCs; ++t)
+      for (unsigned int p = 0; p < detector.nPlanes; ++p)
+        for (unsigned int w = 0; w < detector.nWires; ++w)
+          IDs.emplace_back(c, t, p, w);
+  return IDs;
+} // makeWireIDs()
+
+
+/// Measures and prints the performance of `Hash` on the set of `IDs`.
+template <typename Hash, bool timeContainer = true>
+void runBenchmark(
+  std::string const& hashName, std::vector<geo::WireID> const& IDs,
+  std::vector<geo::WireID> const& lookups,
+  std::vector<geo::WireID> const& misses, unsigned int repeat
+) {
+  Hash const hash;
+
+  std::vector<std::size_t> values;
+  values.reserve(IDs.size());
+  for (geo::WireID const& id: IDs) values.push_back(hash(id));
+  std::sort(values.begin(), values.end());
+  std::size_t nDistinct = 0U, maxShared = 0U;
+  for (auto it = values.begin(); it != values.end(); ++nDistinct) {
+    auto const next = std::upper_bound(it, values.end(), *it);
+    maxShared = std::max<std::size_t>(maxShared, next - it);
+    it = next;
+  }
+
+  if (!timeContainer) {
+    std::cout << "  " << std::left << std::setw(12) << hashName << std::right
+      << std::setw(10) << nDistinct << std::setw(10) << maxShared
+      << "         n/a         n/a         n/a" << std::endl;
+    return;
+  }
+
+  std::unordered_set<geo::WireID, Hash> set;
+  double const insertTime = bestTime(repeat, [&set, &IDs](){
+      set.clear();
+      set.insert(IDs.begin(), IDs.end());
+    });
+  std::size_t maxBucket = 0U;
+  for (std::size_t bucket = 0; bucket < set.bucket_count(); ++bucket)
+    maxBucket = std::max(maxBucket, set.bucket_size(bucket));
+
+  std::size_t found = 0U; // prevents the lookups from being optimised away
+  double const hitTime = bestTime(repeat, [&set, &lookups, &found](){
+      for (geo::WireID const& id: lookups) found += set.count(id);
+    });
+  double const missTime = bestTime(repeat, [&set, &misses, &found](){
+      for (geo::WireID const& id: misses) found += set.count(id);
+    });
+
+  std::cout << "  " << std::left << std::setw(12) << hashName << std::right
+    << std::setw(10) << nDistinct
+    << std::setw(10) << maxBucket
+    << std::setw(12) << std::fixed << std::setprecision(1)
+      << insertTime / IDs.size()
+    << std::setw(12) << hitTime / lookups.size()
+    << std::setw(12) << missTime / misses.size()
+    << "   (" << found << ")"
+    << std::endl;
+} // runBenchmark()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  double const scale = (argc > 1)? std::strtod(argv[1], nullptr): 1.0;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 5U;
+
+  std::vector<Detector_t> const detectors {
+    { "1 TPC, 3 planes",       1U,   1U, 3U, 3456U },
+    { "2x4 TPCs, 3 planes",    2U,   4U, 3U, 5600U },
+    { "300 TPCs, 3 planes",    1U, 300U, 3U,  800U },
+  };
+
+  std::mt19937 engine { 12345U };
+  for (Detector_t detector: detectors) {
+    detector.nWires = std::max(1U, unsigned(detector.nWires * scale));
+    std::vector<geo::WireID> const IDs = makeWireIDs(detector);
+
+    std::vector<geo::WireID> lookups = IDs;
+    std::shuffle(lookups.begin(), lookups.end(), engine);
+
+    // wires just beyond the last one of each plane
+    Detector_t beyond = detector;
+    beyond.nWires *= 2U;
+    std::vector<geo::WireID> misses;
+    for (geo::WireID const& id: makeWireIDs(beyond))
+      if (id.Wire >= detector.nWires) misses.push_back(id);
+    std::shuffle(misses.begin(), misses.end(), engine);
+
+    std::cout << detector.name << " x " << detector.nWires << " wires: "
+      << IDs.size() << " IDs\n"
+      << "  hash          distinct  max.bucket  insert[ns]     hit[ns]"
+      << "    miss[ns]" << std::endl;
+    runBenchmark<std::hash<geo::WireID>>
+      ("std::hash", IDs, lookups, misses, repeat);
+    runBenchmark<XorWireIDhash>("shifted xor", IDs, lookups, misses, repeat);
+    runBenchmark<PlainXorWireIDhash, false>
+      ("plain xor", IDs, lookups, misses, repeat);
+  } // for detectors
+
+  return EXIT_SUCCESS;
+
+} // main()
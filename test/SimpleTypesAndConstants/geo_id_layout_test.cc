@@ -0,0 +1,111 @@
+/**
+ * @file   geo_id_layout_test.cc
+ * @brief  Test of geo_id_layout.h fixed layouts
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_id_layout_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_layout.h"
+
+// C/C++ standard libraries
+#include <array>
+
+
+//------------------------------------------------------------------------------
+// compile-time checks
+namespace {
+
+  using PlaneLayout_t = geo::FixedPlaneLayout<2U, 4U, 3U>;
+
+  static_assert(PlaneLayout_t::dimensions() == 3U);
+  static_assert(PlaneLayout_t::size() == 24U);
+  static_assert(PlaneLayout_t::extent<1U>() == 4U);
+  static_assert(PlaneLayout_t::stride<0U>() == 12U);
+  static_assert(PlaneLayout_t::stride<2U>() == 1U);
+  static_assert(PlaneLayout_t::index(geo::PlaneID{ 1, 2, 0 }) == 18U);
+  static_assert(PlaneLayout_t::ID(23U) == geo::PlaneID{ 1, 3, 2 });
+  static_assert(PlaneLayout_t::firstID() == geo::PlaneID{ 0, 0, 0 });
+  static_assert(PlaneLayout_t::hasElement(geo::PlaneID{ 1, 3, 2 }));
+  static_assert(!PlaneLayout_t::hasElement(geo::PlaneID{ 1, 4, 2 }));
+  static_assert(!PlaneLayout_t::hasElement(geo::PlaneID{}));
+
+  // usable as array size
+  [[maybe_unused]] std::array<int, PlaneLayout_t::size()> planeData {};
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+template <typename Layout>
+void checkAgainstMapper() {
+
+  auto const mapper = Layout::mapper();
+  BOOST_CHECK_EQUAL(mapper.size(), Layout::size());
+
+  for (std::size_t i = 0; i < Layout::size(); ++i) {
+    typename Layout::ID_t const id = mapper.ID(i);
+    BOOST_CHECK_EQUAL(Layout::ID(i), id);
+    BOOST_CHECK(Layout::ID(i).isValid);
+    BOOST_CHECK(Layout::hasElement(id));
+    BOOST_CHECK_EQUAL(Layout::index(id), i);
+
+    // like the mapper, the layout checks only the indices
+    typename Layout::ID_t invalid = id;
+    invalid.markInvalid();
+    BOOST_CHECK(Layout::hasElement(invalid));
+    BOOST_CHECK(mapper.hasElement(invalid));
+  } // for
+
+  typename Layout::ID_t const defaultID;
+  BOOST_CHECK(!Layout::hasElement(defaultID));
+  BOOST_CHECK(!mapper.hasElement(defaultID));
+
+  BOOST_CHECK_EQUAL(Layout::lastID(), mapper.lastID());
+
+} // checkAgainstMapper()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(GeometryLayoutTest) {
+
+  checkAgainstMapper<geo::FixedCryostatLayout<3U>>();
+  checkAgainstMapper<geo::FixedTPCLayout<2U, 5U>>();
+  checkAgainstMapper<geo::FixedPlaneLayout<2U, 4U, 3U>>();
+  checkAgainstMapper<geo::FixedWireLayout<2U, 3U, 3U, 7U>>();
+
+} // BOOST_AUTO_TEST_CASE(GeometryLayoutTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PowerOfTwoLayoutTest) {
+
+  // all extents are powers of two: only shifts and masks
+  using Layout_t = geo::FixedWireLayout<2U, 4U, 2U, 256U>;
+  static_assert(Layout_t::size() == 4096U);
+  static_assert
+    (Layout_t::index(geo::WireID{ 1, 3, 1, 255 }) == Layout_t::size() - 1U);
+  static_assert(Layout_t::ID(2048U + 512U + 1U) == geo::WireID{ 1, 1, 0, 1 });
+  checkAgainstMapper<Layout_t>();
+
+  // mixed: power of two below planes, but not below TPCs
+  checkAgainstMapper<geo::FixedWireLayout<2U, 3U, 2U, 64U>>();
+
+} // BOOST_AUTO_TEST_CASE(PowerOfTwoLayoutTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReadoutLayoutTest) {
+
+  using ROPLayout_t = readout::FixedROPLayout<2U, 2U, 3U>;
+  static_assert(ROPLayout_t::size() == 12U);
+  static_assert(ROPLayout_t::ID(7U) == readout::ROPID{ 1, 0, 1 });
+
+  checkAgainstMapper<readout::FixedTPCsetLayout<2U, 6U>>();
+  checkAgainstMapper<ROPLayout_t>();
+
+} // BOOST_AUTO_TEST_CASE(ReadoutLayoutTest)
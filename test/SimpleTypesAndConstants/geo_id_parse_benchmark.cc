@@ -0,0 +1,130 @@
+/**
+ * @file   geo_id_parse_benchmark.cc
+ * @brief  Benchmark of the parsing of geometry IDs from text
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_id_parse_benchmark [nLines [repeat]]
+ *
+ * A text of `nLines` lines, each with a wire ID as written by `operator<<`,
+ * is parsed with:
+ *  * `geo::parseID<geo::WireID>()`;
+ *  * `std::sscanf()`;
+ *  * `std::regex_match()`, as the configuration readers used to do.
+ *
+ * The throughput (best of `repeat` passes) is printed; the regular
+ * expression is run only on the first tenth of the lines, as it is slow.
+ * The program fails if any line is not parsed back into the same ID.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <sstream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <regex>
+#include <algorithm> // std::max(), std::min()
+#include <cstdio> // std::sscanf()
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS, EXIT_FAILURE
+
+
+//------------------------------------------------------------------------------
+/// Prints the time per line and throughput of a parsing method.
+void printResult
+  (std::string const& name, double time, std::size_t nLines, std::size_t size)
+{
+  if (nLines == 0U) return;
+  std::cout << "  " << std::left << std::setw(20) << name << std::right
+    << std::setw(10) << std::fixed << std::setprecision(1)
+    << (time / nLines) << " ns/line"
+    << std::setw(10) << (double(size) / time * 1e3) << " MB/s" << std::endl;
+} // printResult()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const nLines
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 3U;
+
+  // the text, and the position of each line in it
+  std::string text;
+  {
+    std::ostringstream sstr;
+    for (std::size_t i = 0; i < nLines; ++i) {
+      sstr << geo::WireID
+        (i % 2U, (i / 2U) % 150U, (i / 300U) % 3U, (i * 7919U) % 4800U)
+        << '\n';
+    }
+    text = sstr.str();
+  }
+  std::vector<std::string_view> lines;
+  lines.reserve(nLines);
+  for (std::size_t begin = 0; begin < text.size(); ) {
+    std::size_t const end = text.find('\n', begin);
+    lines.emplace_back(text.data() + begin, end - begin);
+    begin = end + 1U;
+  }
+
+  std::size_t nParsed = 0U; // prevents the parsing from being optimised away
+
+  std::cout << "Parsing " << nLines << " lines (" << text.size() << " bytes):"
+    << std::endl;
+
+  printResult("geo::parseID", bestTime(repeat, [&lines, &nParsed](){
+      for (std::string_view line: lines)
+        nParsed += geo::parseID<geo::WireID>(line)->Wire;
+    }), lines.size(), text.size());
+
+  printResult("std::sscanf", bestTime(repeat, [&lines, &nParsed](){
+      geo::WireID id;
+      char buffer[geo::IDstring<geo::WireID>::MaxLength + 1U];
+      for (std::string_view line: lines) {
+        // std::sscanf() needs a null-terminated line
+        line.copy(buffer, sizeof(buffer) - 1U);
+        buffer[std::min(line.size(), sizeof(buffer) - 1U)] = '\0';
+        std::sscanf(buffer, "C:%u T:%u P:%u W:%u",
+          &id.Cryostat, &id.TPC, &id.Plane, &id.Wire);
+        nParsed += id.Wire;
+      }
+    }), lines.size(), text.size());
+
+  std::size_t const nRegexLines
+    = std::min(lines.size(), std::max<std::size_t>(lines.size() / 10U, 1U));
+  std::vector<std::string_view> const regexLines
+    (lines.begin(), lines.begin() + nRegexLines);
+  std::size_t const regexSize = regexLines.empty()? 0U
+    : (regexLines.back().data() + regexLines.back().size() + 1U - text.data());
+  std::regex const pattern { R"(C:(\d+) T:(\d+) P:(\d+) W:(\d+))" };
+  printResult("std::regex_match", bestTime(repeat,
+    [&regexLines, &pattern, &nParsed](){
+      std::cmatch match;
+      for (std::string_view line: regexLines) {
+        std::regex_match
+          (line.data(), line.data() + line.size(), match, pattern);
+        nParsed += std::stoul(match[4].str());
+      }
+    }), regexLines.size(), regexSize);
+
+  std::cout << "(checksum: " << nParsed << ")" << std::endl;
+
+  // check that the parser actually reads the text back
+  for (std::string_view line: lines) {
+    std::optional<geo::WireID> const id = geo::parseID<geo::WireID>(line);
+    if (id && (id->toString() == line)) continue;
+    std::cerr << "Failed to parse '" << line << "'" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+} // main()
@@ -0,0 +1,152 @@
+/**
+ * @file   geo_id_ranges_benchmark.cc
+ * @brief  Benchmark of the iteration of geo::IDRange against nested loops
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_id_ranges_benchmark [nWires [repeat]]
+ *
+ * All the wire IDs of a detector with 2 cryostats, 4 TPCs each, 3 planes each
+ * and `nWires` wires each are visited with:
+ *  * four nested loops, creating each `geo::WireID`;
+ *  * a range-based loop on a `geo::WireIDRange`;
+ *  * `geo::WireIDRange::forEach()`;
+ *  * `geo::WireIDRange::operator[]` (the ID computed from its position);
+ *  * a `std::reverse_iterator` on the range.
+ *
+ * The time per ID (best of `repeat` passes) is printed. The program fails if
+ * the methods do not visit the same IDs.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_ranges.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <string>
+#include <iterator> // std::make_reverse_iterator()
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS, EXIT_FAILURE
+
+
+//------------------------------------------------------------------------------
+/// Prints the time per ID of an iteration method.
+void printResult(std::string const& name, double time, std::size_t nIDs) {
+  if (nIDs == 0U) return;
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+    << std::setw(10) << std::fixed << std::setprecision(2)
+    << (time / nIDs) << " ns/ID" << std::endl;
+} // printResult()
+
+
+/// Returns a value depending on all the indices of `wid` and on its position.
+std::size_t digest(geo::WireID const& wid, std::size_t position) {
+  return (position + 1U) * (wid.Cryostat * 7U + wid.TPC * 5U + wid.Plane * 3U
+    + wid.Wire);
+} // digest()
+
+
+//------------------------------------------------------------------------------
+// Each iteration method has its own function, so that the register allocation
+// of one loop does not depend on the others.
+
+/// Visits all the wire IDs in `range` with nested loops.
+[[gnu::noinline]] std::size_t visitNested(geo::WireIDRange const& range) {
+  auto const& [ nCryostats, nTPCs, nPlanes, nWires ] = range.mapper().extents();
+  std::size_t sum = 0U;
+  std::size_t i = 0U;
+  for (unsigned int c = 0; c < nCryostats; ++c)
+    for (unsigned int t = 0; t < nTPCs; ++t)
+      for (unsigned int p = 0; p < nPlanes; ++p)
+        for (unsigned int w = 0; w < nWires; ++w)
+          sum += digest(geo::WireID(c, t, p, w), i++);
+  return sum;
+} // visitNested()
+
+
+/// Visits all the wire IDs in `range` with a range-based loop.
+[[gnu::noinline]] std::size_t visitRange(geo::WireIDRange const& range) {
+  std::size_t sum = 0U;
+  std::size_t i = 0U;
+  for (geo::WireID const& wid: range) sum += digest(wid, i++);
+  return sum;
+} // visitRange()
+
+
+/// Visits all the wire IDs in `range` with `forEach()`.
+[[gnu::noinline]] std::size_t visitForEach(geo::WireIDRange const& range) {
+  std::size_t sum = 0U;
+  std::size_t i = 0U;
+  range.forEach([&](geo::WireID const& wid){ sum += digest(wid, i++); });
+  return sum;
+} // visitForEach()
+
+
+/// Visits all the wire IDs in `range` by their position in it.
+[[gnu::noinline]] std::size_t visitIndex(geo::WireIDRange const& range) {
+  std::size_t sum = 0U;
+  for (std::size_t i = 0; i < range.size(); ++i) sum += digest(range[i], i);
+  return sum;
+} // visitIndex()
+
+
+/// Visits all the wire IDs in `range` backward with `std::reverse_iterator`.
+[[gnu::noinline]] std::size_t visitReverse(geo::WireIDRange const& range) {
+  std::size_t sum = 0U;
+  std::size_t i = range.size();
+  auto const rend = std::make_reverse_iterator(range.begin());
+  for (auto it = std::make_reverse_iterator(range.end()); it != rend; ++it)
+    sum += digest(*it, --i);
+  return sum;
+} // visitReverse()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  unsigned int const nWires
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 100000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 5U;
+
+  geo::WireIDRange const range({ 2U, 4U, 3U, nWires });
+  std::size_t const n = range.size();
+
+  std::cout << "Visiting " << n << " wire IDs:" << std::endl;
+
+  std::size_t nestedSum = 0U;
+  printResult("nested loops",
+    bestTime(repeat, [&](){ nestedSum = visitNested(range); }), n);
+
+  std::size_t rangeSum = 0U;
+  printResult("range-based loop",
+    bestTime(repeat, [&](){ rangeSum = visitRange(range); }), n);
+
+  std::size_t forEachSum = 0U;
+  printResult("forEach()",
+    bestTime(repeat, [&](){ forEachSum = visitForEach(range); }), n);
+
+  std::size_t indexSum = 0U;
+  printResult("operator[]",
+    bestTime(repeat, [&](){ indexSum = visitIndex(range); }), n);
+
+  std::size_t reverseSum = 0U;
+  printResult("std::reverse_iterator",
+    bestTime(repeat, [&](){ reverseSum = visitReverse(range); }), n);
+
+  std::cout << "(checksum: " << nestedSum << ")" << std::endl;
+  if ((rangeSum != nestedSum) || (forEachSum != nestedSum)
+    || (indexSum != nestedSum) || (reverseSum != nestedSum)
+  ) {
+    std::cerr << "Iterations visited different IDs (checksums: " << nestedSum
+      << ", " << rangeSum << ", " << forEachSum << ", " << indexSum << ", "
+      << reverseSum << ")" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+} // main()
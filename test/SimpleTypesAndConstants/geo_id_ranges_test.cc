@@ -0,0 +1,205 @@
+/**
+ * @file   geo_id_ranges_test.cc
+ * @brief  Test of geo_id_ranges.h ranges
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_id_ranges_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_ranges.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::is_sorted(), std::lower_bound(), std::find_if()...
+#include <iterator> // std::next(), std::prev(), std::make_reverse_iterator()
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(WireIDRangeTest) {
+
+  geo::WireIDRange const range({ 2U, 3U, 2U, 4U });
+
+  BOOST_CHECK_EQUAL(range.size(), 48U);
+  BOOST_CHECK(!range.empty());
+  BOOST_CHECK_EQUAL(std::distance(range.begin(), range.end()), 48);
+
+  // same as nested loops
+  std::vector<geo::WireID> expected;
+  for (unsigned int c = 0; c < 2U; ++c)
+    for (unsigned int t = 0; t < 3U; ++t)
+      for (unsigned int p = 0; p < 2U; ++p)
+        for (unsigned int w = 0; w < 4U; ++w)
+          expected.emplace_back(c, t, p, w);
+
+  std::vector<geo::WireID> visited;
+  for (geo::WireID const& wid: range) {
+    BOOST_CHECK(wid.isValid);
+    visited.push_back(wid);
+  }
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (visited.begin(), visited.end(), expected.begin(), expected.end());
+  BOOST_CHECK(std::is_sorted(visited.begin(), visited.end()));
+
+  // same with nested loops
+  visited.clear();
+  range.forEach([&visited](geo::WireID const& wid){
+      BOOST_CHECK(wid.isValid);
+      visited.push_back(wid);
+    });
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (visited.begin(), visited.end(), expected.begin(), expected.end());
+
+  // same as the mapper
+  for (std::size_t i = 0; i < range.size(); ++i) {
+    BOOST_CHECK_EQUAL(range[i], range.mapper().ID(i));
+    BOOST_CHECK_EQUAL(range.begin()[i], expected[i]);
+    BOOST_CHECK_EQUAL(*(range.begin() + i), expected[i]);
+    BOOST_CHECK_EQUAL(*(range.end() - (range.size() - i)), expected[i]);
+  } // for
+
+  // backward
+  auto it = range.end();
+  for (std::size_t i = range.size(); i > 0U; --i) {
+    --it;
+    BOOST_CHECK_EQUAL(*it, expected[i - 1U]);
+  }
+  BOOST_CHECK(it == range.begin());
+
+  // arithmetic and comparisons
+  auto const first = range.begin();
+  auto const middle = std::next(first, 20);
+  BOOST_CHECK_EQUAL(*middle, expected[20]);
+  BOOST_CHECK_EQUAL(*std::prev(middle, 9), expected[11]);
+  BOOST_CHECK_EQUAL(middle - first, 20);
+  BOOST_CHECK_EQUAL(first - middle, -20);
+  BOOST_CHECK(first < middle);
+  BOOST_CHECK(middle <= middle);
+  BOOST_CHECK(middle > first);
+  BOOST_CHECK(middle != first);
+  BOOST_CHECK(2 + first == std::next(first, 2));
+  BOOST_CHECK(first + range.size() == range.end());
+
+  auto jumper = first;
+  jumper += 31;
+  BOOST_CHECK_EQUAL(*jumper, expected[31]);
+  jumper -= 30;
+  BOOST_CHECK_EQUAL(*jumper, expected[1]);
+  BOOST_CHECK_EQUAL(*jumper++, expected[1]);
+  BOOST_CHECK_EQUAL(*jumper--, expected[2]);
+  BOOST_CHECK_EQUAL(jumper->Wire, expected[1].Wire);
+
+} // BOOST_AUTO_TEST_CASE(WireIDRangeTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReverseIterationTest) {
+
+  geo::PlaneIDRange const range({ 2U, 3U, 2U });
+
+  std::vector<geo::PlaneID> const forward(range.begin(), range.end());
+  BOOST_CHECK_EQUAL(forward.size(), range.size());
+
+  // `std::reverse_iterator` dereferences a temporary copy of the iterator
+  auto const rbegin = std::make_reverse_iterator(range.end());
+  auto const rend = std::make_reverse_iterator(range.begin());
+  std::vector<geo::PlaneID> const backward(rbegin, rend);
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (backward.rbegin(), backward.rend(), forward.begin(), forward.end());
+  BOOST_CHECK_EQUAL(*rbegin, geo::PlaneID(1, 2, 1));
+  BOOST_CHECK_EQUAL(rbegin[3], geo::PlaneID(1, 1, 0));
+  BOOST_CHECK_EQUAL(rbegin->Plane, 1U);
+
+} // BOOST_AUTO_TEST_CASE(ReverseIterationTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(AlgorithmTest) {
+
+  geo::WireIDRange const range({ 2U, 3U, 2U, 4U });
+
+  // binary search relies on the IDs being sorted and on random access
+  geo::WireID const target { 1, 2, 0, 3 };
+  auto const found = std::lower_bound(range.begin(), range.end(), target);
+  BOOST_CHECK(found != range.end());
+  BOOST_CHECK_EQUAL(*found, target);
+  BOOST_CHECK_EQUAL(found - range.begin(), range.mapper().index(target));
+
+  auto const firstInPlane1 = std::find_if(range.begin(), range.end(),
+    [](geo::WireID const& wid){ return wid.Plane == 1U; });
+  BOOST_CHECK_EQUAL(*firstInPlane1, geo::WireID(0, 0, 1, 0));
+
+  auto const nLastWires = std::count_if(range.begin(), range.end(),
+    [](geo::WireID const& wid){ return wid.Wire == 3U; });
+  BOOST_CHECK_EQUAL(nLastWires, 12);
+
+  std::vector<geo::WireID> reversed(range.size());
+  std::reverse_copy(range.begin(), range.end(), reversed.begin());
+  BOOST_CHECK_EQUAL(reversed.front(), range[range.size() - 1U]);
+  BOOST_CHECK_EQUAL(reversed.back(), range[0]);
+  BOOST_CHECK(std::is_sorted(reversed.rbegin(), reversed.rend()));
+
+} // BOOST_AUTO_TEST_CASE(AlgorithmTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IterateIDsTest) {
+
+  unsigned int n = 0U;
+  for (geo::PlaneID const& pid: geo::iterateIDs<geo::PlaneID>({ 2U, 4U, 3U }))
+  {
+    BOOST_CHECK_EQUAL(pid, geo::GeoIDmapper<geo::PlaneID>({ 2U, 4U, 3U }).ID(n));
+    ++n;
+  }
+  BOOST_CHECK_EQUAL(n, 24U);
+
+  geo::CryostatIDRange const cryostats({ 3U });
+  BOOST_CHECK_EQUAL(cryostats.size(), 3U);
+  BOOST_CHECK_EQUAL(*std::prev(cryostats.end()), geo::CryostatID(2));
+
+} // BOOST_AUTO_TEST_CASE(IterateIDsTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(EmptyRangeTest) {
+
+  geo::TPCIDRange const noTPCs({ 2U, 0U });
+  BOOST_CHECK(noTPCs.empty());
+  BOOST_CHECK_EQUAL(noTPCs.size(), 0U);
+  BOOST_CHECK(noTPCs.begin() == noTPCs.end());
+
+  geo::PlaneIDRange const nothing({ 0U, 0U, 0U });
+  BOOST_CHECK(nothing.empty());
+  BOOST_CHECK(nothing.begin() == nothing.end());
+
+  unsigned int nVisited = 0U;
+  noTPCs.forEach([&nVisited](geo::TPCID const&){ ++nVisited; });
+  nothing.forEach([&nVisited](geo::PlaneID const&){ ++nVisited; });
+  BOOST_CHECK_EQUAL(nVisited, 0U);
+
+} // BOOST_AUTO_TEST_CASE(EmptyRangeTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReadoutRangeTest) {
+
+  readout::ROPIDRange const range({ 2U, 2U, 3U });
+  BOOST_CHECK_EQUAL(range.size(), 12U);
+
+  std::size_t i = 0U;
+  for (readout::ROPID const& rid: range) {
+    BOOST_CHECK(rid.isValid);
+    BOOST_CHECK_EQUAL(rid.Cryostat, i / 6U);
+    BOOST_CHECK_EQUAL(rid.TPCset, (i / 3U) % 2U);
+    BOOST_CHECK_EQUAL(rid.ROP, i % 3U);
+    ++i;
+  }
+  BOOST_CHECK_EQUAL(i, 12U);
+
+  auto const sets = readout::iterateIDs<readout::TPCsetID>({ 1U, 5U });
+  BOOST_CHECK_EQUAL(*std::prev(sets.end()), readout::TPCsetID(0, 4));
+
+} // BOOST_AUTO_TEST_CASE(ReadoutRangeTest)
@@ -0,0 +1,142 @@
+/**
+ * @file   geo_id_sort_benchmark.cc
+ * @brief  Benchmark of the radix sort of geometry IDs against `std::sort()`
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_id_sort_benchmark [nIDs [repeat]]
+ *
+ * `nIDs` random wire IDs (2 cryostats, 12 TPCs, 3 planes, 5000 wires) are
+ * sorted with:
+ *  * `std::sort()` and `geo::radix_sort()`;
+ *  * `std::stable_sort()` and `geo::stable_radix_sort()`;
+ *  * `std::stable_sort()` and `geo::stable_radix_sort()` on records holding
+ *    a wire ID, sorted by it.
+ *
+ * The time per ID (best of `repeat` passes, excluding the copy of the input)
+ * is printed. The program fails if any of the sorted ranges differs from
+ * the one of the standard algorithm.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_sort.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_types.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm> // std::sort(), std::stable_sort(), std::max()
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS, EXIT_FAILURE
+
+
+//------------------------------------------------------------------------------
+/// A record with a wire ID.
+struct Hit_t {
+  geo::WireID wire;
+  int serial;
+  bool operator== (Hit_t const& other) const
+    { return (wire == other.wire) && (serial == other.serial); }
+}; // struct Hit_t
+
+
+/// Returns the shortest time [ns] of `repeat` sorts of a copy of `input`.
+template <typename T, typename Sort>
+double bestSortTime(
+  unsigned int repeat, std::vector<T> const& input, std::vector<T>& sorted,
+  Sort sort
+) {
+  using Clock_t = std::chrono::steady_clock;
+  double best = -1.0;
+  for (unsigned int pass = 0; pass < std::max(repeat, 1U); ++pass) {
+    sorted = input;
+    Clock_t::time_point const start = Clock_t::now();
+    sort(sorted.begin(), sorted.end());
+    double const time = std::chrono::duration<double, std::nano>
+      (Clock_t::now() - start).count();
+    if ((best < 0.0) || (time < best)) best = time;
+  }
+  return best;
+} // bestSortTime()
+
+
+/// Prints the time per ID of the standard and of the radix sort.
+void printResult(
+  std::string const& name, double stdTime, double radixTime, std::size_t n
+) {
+  if (n == 0U) return;
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+    << std::fixed << std::setprecision(2)
+    << std::setw(10) << (stdTime / n)
+    << std::setw(10) << (radixTime / n)
+    << std::setw(10) << (stdTime / radixTime) << std::endl;
+} // printResult()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const n
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 10000000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 3U;
+
+  std::mt19937 engine { 12345U };
+  std::uniform_int_distribution<unsigned int> cryo(0U, 1U);
+  std::uniform_int_distribution<unsigned int> tpc(0U, 11U);
+  std::uniform_int_distribution<unsigned int> plane(0U, 2U);
+  std::uniform_int_distribution<unsigned int> wire(0U, 4999U);
+  std::vector<geo::WireID> IDs;
+  IDs.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    IDs.emplace_back(cryo(engine), tpc(engine), plane(engine), wire(engine));
+  std::vector<Hit_t> hits;
+  hits.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) hits.push_back({ IDs[i], int(i) });
+
+  std::cout << "Sorting " << n << " wire IDs\n"
+    << "  time [ns/ID]              std::    radix     ratio" << std::endl;
+
+  bool same = true;
+
+  std::vector<geo::WireID> stdSorted, radixSorted;
+  double const sortTime = bestSortTime(repeat, IDs, stdSorted,
+    [](auto first, auto last){ std::sort(first, last); });
+  double const radixTime = bestSortTime(repeat, IDs, radixSorted,
+    [](auto first, auto last){ geo::radix_sort(first, last); });
+  printResult("sort", sortTime, radixTime, n);
+  same = same && (radixSorted == stdSorted);
+
+  double const stableTime = bestSortTime(repeat, IDs, stdSorted,
+    [](auto first, auto last){ std::stable_sort(first, last); });
+  double const stableRadixTime = bestSortTime(repeat, IDs, radixSorted,
+    [](auto first, auto last){ geo::stable_radix_sort(first, last); });
+  printResult("stable sort", stableTime, stableRadixTime, n);
+  same = same && (radixSorted == stdSorted);
+
+  auto const hitWire = [](Hit_t const& hit){ return hit.wire; };
+  std::vector<Hit_t> stdHits, radixHits;
+  double const hitTime = bestSortTime(repeat, hits, stdHits,
+    [](auto first, auto last){
+      std::stable_sort(first, last, [](Hit_t const& a, Hit_t const& b)
+        { return a.wire < b.wire; });
+    });
+  double const hitRadixTime = bestSortTime(repeat, hits, radixHits,
+    [hitWire](auto first, auto last)
+      { geo::stable_radix_sort(first, last, hitWire); });
+  printResult("stable sort of records", hitTime, hitRadixTime, n);
+  same = same && (radixHits == stdHits);
+
+  if (!same) {
+    std::cerr << "Radix sort results differ from the standard ones."
+      << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+} // main()
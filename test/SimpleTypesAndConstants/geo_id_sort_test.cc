@@ -0,0 +1,144 @@
+/**
+ * @file   geo_id_sort_test.cc
+ * @brief  Test of geo_id_sort.h radix sort
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_id_sort_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_id_sort.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::stable_sort(), std::is_sorted()
+#include <random>
+#include <vector>
+
+
+namespace {
+
+  /// A record with an ID.
+  struct Hit_t {
+    geo::WireID wire;
+    int serial;
+  };
+
+  /// Returns `n` random wire IDs, with many duplicates.
+  std::vector<geo::WireID> randomWireIDs
+    (std::size_t n, unsigned int nCryostats = 2U)
+  {
+    std::mt19937 gen { 12345 };
+    std::uniform_int_distribution<unsigned int> cryo(0U, nCryostats - 1U);
+    std::uniform_int_distribution<unsigned int> tpc(0U, 11U);
+    std::uniform_int_distribution<unsigned int> plane(0U, 2U);
+    std::uniform_int_distribution<unsigned int> wire(0U, 4999U);
+    std::vector<geo::WireID> wids;
+    for (std::size_t i = 0; i < n; ++i)
+      wids.emplace_back(cryo(gen), tpc(gen), plane(gen), wire(gen));
+    return wids;
+  } // randomWireIDs()
+
+} // local namespace
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SortIDsTest) {
+
+  for (std::size_t const n: { 0U, 1U, 100U, 20000U }) {
+    std::vector<geo::WireID> wids = randomWireIDs(n);
+    std::vector<geo::WireID> expected = wids;
+    std::stable_sort(expected.begin(), expected.end());
+
+    std::vector<geo::WireID> sorted = wids;
+    geo::radix_sort(sorted.begin(), sorted.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS
+      (sorted.begin(), sorted.end(), expected.begin(), expected.end());
+
+    sorted = wids;
+    geo::stable_radix_sort(sorted.begin(), sorted.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS
+      (sorted.begin(), sorted.end(), expected.begin(), expected.end());
+  } // for
+
+  // single cryostat: the cryostat byte is skipped
+  std::vector<geo::WireID> wids = randomWireIDs(5000U, 1U);
+  std::vector<geo::WireID> expected = wids;
+  std::sort(expected.begin(), expected.end());
+  geo::radix_sort(wids.begin(), wids.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (wids.begin(), wids.end(), expected.begin(), expected.end());
+
+} // BOOST_AUTO_TEST_CASE(SortIDsTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SortOtherIDsTest) {
+
+  std::mt19937 gen { 54321 };
+  std::uniform_int_distribution<unsigned int> index(0U, 300U);
+
+  std::vector<readout::ROPID> rops;
+  for (std::size_t i = 0; i < 3000U; ++i)
+    rops.emplace_back(index(gen) % 3U, index(gen), index(gen) % 4U);
+  std::vector<readout::ROPID> expected = rops;
+  std::stable_sort(expected.begin(), expected.end());
+  geo::radix_sort(rops.begin(), rops.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (rops.begin(), rops.end(), expected.begin(), expected.end());
+
+  std::vector<geo::PackedPlaneID> planes;
+  for (std::size_t i = 0; i < 3000U; ++i)
+    planes.emplace_back(geo::PlaneID(index(gen), index(gen), index(gen)));
+  geo::stable_radix_sort(planes.begin(), planes.end());
+  BOOST_CHECK(std::is_sorted(planes.begin(), planes.end()));
+
+} // BOOST_AUTO_TEST_CASE(SortOtherIDsTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SortRecordsTest) {
+
+  std::vector<geo::WireID> const wids = randomWireIDs(20000U);
+  std::vector<Hit_t> hits;
+  for (geo::WireID const& wid: wids)
+    hits.push_back({ wid, static_cast<int>(hits.size()) });
+
+  // make some of the IDs invalid: validity is ignored in the ordering
+  for (std::size_t i = 0; i < hits.size(); i += 7U)
+    hits[i].wire.markInvalid();
+
+  auto byWire = [](Hit_t const& hit){ return hit.wire; };
+  std::vector<Hit_t> expected = hits;
+  std::stable_sort(expected.begin(), expected.end(),
+    [](Hit_t const& a, Hit_t const& b){ return a.wire < b.wire; });
+
+  geo::stable_radix_sort(hits.begin(), hits.end(), byWire);
+  BOOST_REQUIRE_EQUAL(hits.size(), expected.size());
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    BOOST_CHECK_EQUAL(hits[i].wire, expected[i].wire);
+    BOOST_CHECK_EQUAL(hits[i].wire.isValid, expected[i].wire.isValid);
+    BOOST_CHECK_EQUAL(hits[i].serial, expected[i].serial);
+  }
+
+} // BOOST_AUTO_TEST_CASE(SortRecordsTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SortUnpackableTest) {
+
+  // an index too large for its packed field: falls back to comparison sorting
+  std::vector<geo::WireID> wids = randomWireIDs(1000U);
+  wids[500] = geo::WireID{ 1000, 0, 0, 0 };
+  BOOST_CHECK(!geo::PackedWireID::canPack(wids[500]));
+
+  std::vector<geo::WireID> expected = wids;
+  std::stable_sort(expected.begin(), expected.end());
+  geo::stable_radix_sort(wids.begin(), wids.end());
+  BOOST_CHECK_EQUAL_COLLECTIONS
+    (wids.begin(), wids.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(wids.back(), (geo::WireID{ 1000, 0, 0, 0 }));
+
+} // BOOST_AUTO_TEST_CASE(SortUnpackableTest)
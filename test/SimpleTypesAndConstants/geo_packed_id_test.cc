@@ -0,0 +1,153 @@
+/**
+ * @file   geo_packed_id_test.cc
+ * @brief  Test of geo_packed_id.h types
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_packed_id_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_packed_id.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::sort(), std::is_sorted()
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// compile-time tests:
+//
+static_assert(sizeof(geo::PackedWireID) == sizeof(std::uint64_t));
+static_assert(sizeof(readout::PackedROPID) == sizeof(std::uint64_t));
+
+static_assert(geo::PackedWireID::bits(0U) ==  8U);
+static_assert(geo::PackedWireID::bits(1U) == 16U);
+static_assert(geo::PackedWireID::bits(2U) ==  8U);
+static_assert(geo::PackedWireID::bits(3U) == 31U);
+static_assert(geo::PackedWireID::offset(3U) ==  1U);
+static_assert(geo::PackedWireID::offset(0U) == 56U);
+static_assert(geo::PackedPlaneID::bits(2U) == 39U);
+static_assert(geo::PackedCryostatID::bits(0U) == 63U);
+
+static_assert(geo::PackedWireID{ geo::WireID{ 0, 1, 2, 3 } }.getIndex<0U>() == 0);
+static_assert(geo::PackedWireID{ geo::WireID{ 0, 1, 2, 3 } }.getIndex<1U>() == 1);
+static_assert(geo::PackedWireID{ geo::WireID{ 0, 1, 2, 3 } }.getIndex<2U>() == 2);
+static_assert(geo::PackedWireID{ geo::WireID{ 0, 1, 2, 3 } }.getIndex<3U>() == 3);
+static_assert(geo::PackedWireID{ geo::WireID{ 0, 1, 2, 3 } }.isValid());
+static_assert(!geo::PackedWireID{}.isValid());
+static_assert
+  (geo::PackedWireID{}.getIndex<3U>() == geo::WireID::InvalidID);
+
+static_assert( geo::PackedWireID::canPack(geo::WireID{ 254, 0, 0, 0 }));
+static_assert(!geo::PackedWireID::canPack(geo::WireID{ 255, 0, 0, 0 }));
+static_assert( geo::PackedWireID::canPack(geo::WireID{}));
+
+
+//------------------------------------------------------------------------------
+// run-time tests:
+//
+template <typename ID>
+void TestRoundTrip(ID const& id) {
+
+  BOOST_TEST_CHECKPOINT("Round trip of " << id);
+
+  geo::PackedID<ID> const packed { id };
+  BOOST_CHECK(geo::PackedID<ID>::canPack(id));
+
+  ID const unpacked = packed.unpack();
+  BOOST_CHECK_EQUAL(unpacked, id);
+  BOOST_CHECK_EQUAL(unpacked.isValid, id.isValid);
+  BOOST_CHECK_EQUAL(packed.isValid(), id.isValid);
+  BOOST_CHECK_EQUAL(static_cast<ID>(packed), id);
+
+} // TestRoundTrip()
+
+
+template <typename ID>
+void TestOrdering(std::vector<ID> ids) {
+
+  std::vector<geo::PackedID<ID>> packed;
+  for (ID const& id: ids) packed.emplace_back(id);
+
+  for (std::size_t i = 0; i < ids.size(); ++i) {
+    for (std::size_t j = 0; j < ids.size(); ++j) {
+      int const cmp = ids[i].cmp(ids[j]);
+      BOOST_CHECK_EQUAL(packed[i] <  packed[j], cmp <  0);
+      BOOST_CHECK_EQUAL(packed[i] == packed[j], cmp == 0);
+      BOOST_CHECK_EQUAL(packed[i] >  packed[j], cmp >  0);
+      BOOST_CHECK_EQUAL(packed[i] <= packed[j], cmp <= 0);
+      BOOST_CHECK_EQUAL(packed[i] >= packed[j], cmp >= 0);
+      BOOST_CHECK_EQUAL(packed[i] != packed[j], cmp != 0);
+    } // for j
+  } // for i
+
+  std::sort(ids.begin(), ids.end());
+  std::sort(packed.begin(), packed.end());
+  for (std::size_t i = 0; i < ids.size(); ++i)
+    BOOST_CHECK_EQUAL(packed[i].unpack(), ids[i]);
+
+} // TestOrdering()
+
+
+BOOST_AUTO_TEST_CASE(WireIDtest) {
+
+  TestRoundTrip(geo::WireID{});
+  TestRoundTrip(geo::WireID{ 0, 0, 0, 0 });
+  TestRoundTrip(geo::WireID{ 1, 15, 2, 4567 });
+  TestRoundTrip(geo::WireID{ 254, 65534, 254, 0x7FFFFFFE });
+  TestRoundTrip(geo::WireID{ geo::PlaneID{ 1, 2, 0 }, geo::WireID::InvalidID });
+
+  geo::WireID invalid { 1, 15, 2, 4567 };
+  invalid.markInvalid();
+  TestRoundTrip(invalid);
+
+  // validity does not affect comparison
+  BOOST_CHECK(geo::PackedWireID{ invalid }
+    == geo::PackedWireID(geo::WireID{ 1, 15, 2, 4567 }));
+
+  TestOrdering<geo::WireID>({
+    geo::WireID{ 1, 0, 0, 0 }, geo::WireID{ 0, 1, 0, 0 },
+    geo::WireID{ 0, 0, 1, 0 }, geo::WireID{ 0, 0, 0, 1 },
+    geo::WireID{ 0, 0, 0, 0 }, geo::WireID{ 1, 2, 3, 4 },
+    geo::WireID{ 1, 2, 3, 4 }, geo::WireID{ 0, 3, 2, 4 },
+    geo::WireID{ 0, 3, 2, geo::WireID::InvalidID }, geo::WireID{},
+  });
+
+} // BOOST_AUTO_TEST_CASE(WireIDtest)
+
+
+BOOST_AUTO_TEST_CASE(GeoIDtest) {
+
+  TestRoundTrip(geo::CryostatID{});
+  TestRoundTrip(geo::CryostatID{ 0 });
+  TestRoundTrip(geo::CryostatID{ geo::CryostatID::InvalidID - 1U });
+  TestRoundTrip(geo::OpDetID{ 1, 300 });
+  TestRoundTrip(geo::TPCID{ 1, 149 });
+  TestRoundTrip(geo::PlaneID{ 0, 5, 2 });
+
+  TestOrdering<geo::PlaneID>({
+    geo::PlaneID{ 1, 0, 0 }, geo::PlaneID{ 0, 1, 0 }, geo::PlaneID{ 0, 0, 1 },
+    geo::PlaneID{ 0, 0, 0 }, geo::PlaneID{ 0, 1, 2 }, geo::PlaneID{},
+  });
+
+} // BOOST_AUTO_TEST_CASE(GeoIDtest)
+
+
+BOOST_AUTO_TEST_CASE(ReadoutIDtest) {
+
+  TestRoundTrip(readout::TPCsetID{});
+  TestRoundTrip(readout::TPCsetID{ 1, 65534 });
+  TestRoundTrip(readout::ROPID{});
+  TestRoundTrip(readout::ROPID{ 1, 3, 7 });
+
+  BOOST_CHECK_EQUAL(readout::packID(readout::ROPID{ 1, 3, 7 }).getIndex<1U>(), 3);
+
+  TestOrdering<readout::ROPID>({
+    readout::ROPID{ 1, 0, 0 }, readout::ROPID{ 0, 1, 0 },
+    readout::ROPID{ 0, 0, 1 }, readout::ROPID{ 0, 0, 0 }, readout::ROPID{},
+  });
+
+} // BOOST_AUTO_TEST_CASE(ReadoutIDtest)
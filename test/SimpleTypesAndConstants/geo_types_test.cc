@@ -30,6 +30,15 @@
 
 // C/C++ standard libraries
 #include <type_traits> // add_const<>
+#include <unordered_map>
+#include <unordered_set>
+#include <sstream>
+#include <iomanip> // std::setw(), std::setfill()
+#include <locale> // std::numpunct
+#include <string>
+#include <optional>
+#include <array>
+#include <vector>
 
 //------------------------------------------------------------------------------
 template <typename T>
@@ -786,6 +795,261 @@ void test_WireID_directConstructor() {
 // --- END WireID tests -------------------------------------------------------
 
 
+// --- BEGIN hash tests --------------------------------------------------------
+void test_IDhash() {
+
+  BOOST_TEST_CHECKPOINT("Testing hash of geometry IDs");
+
+  // validity does not affect the hash value, as it does not affect comparison
+  geo::WireID wid { 1, 2, 3, 4 };
+  geo::WireID invalid_wid { wid };
+  invalid_wid.markInvalid();
+  BOOST_CHECK_EQUAL
+    (std::hash<geo::WireID>{}(wid), std::hash<geo::WireID>{}(invalid_wid));
+
+  // the hash of a detector-sized set of IDs has no collisions
+  std::unordered_set<std::size_t> wireHashes, planeHashes;
+  std::unordered_map<geo::PlaneID, unsigned int> planeWires;
+  std::size_t nWires = 0U, nPlanes = 0U;
+  for (unsigned int c = 0; c < 2; ++c) {
+    for (unsigned int t = 0; t < 12; ++t) {
+      for (unsigned int p = 0; p < 3; ++p) {
+        geo::PlaneID const pid { c, t, p };
+        planeHashes.insert(std::hash<geo::PlaneID>{}(pid));
+        ++nPlanes;
+        for (unsigned int w = 0; w < 2000; ++w) {
+          wireHashes.insert(std::hash<geo::WireID>{}(geo::WireID{ pid, w }));
+          ++planeWires[pid];
+          ++nWires;
+        } // for wires
+      } // for planes
+    } // for TPCs
+  } // for cryostats
+  BOOST_CHECK_EQUAL(planeHashes.size(), nPlanes);
+  BOOST_CHECK_EQUAL(wireHashes.size(), nWires);
+  BOOST_CHECK_EQUAL(planeWires.size(), nPlanes);
+  BOOST_CHECK_EQUAL((planeWires[{ 1, 11, 2 }]), 2000U);
+
+  // all the ID types are hashable
+  BOOST_CHECK_NE(std::hash<geo::CryostatID>{}(geo::CryostatID{ 0 }),
+    std::hash<geo::CryostatID>{}(geo::CryostatID{ 1 }));
+  BOOST_CHECK_NE(std::hash<geo::OpDetID>{}(geo::OpDetID{ 0, 1 }),
+    std::hash<geo::OpDetID>{}(geo::OpDetID{ 1, 0 }));
+  BOOST_CHECK_NE(std::hash<geo::TPCID>{}(geo::TPCID{ 0, 1 }),
+    std::hash<geo::TPCID>{}(geo::TPCID{ 1, 0 }));
+
+} // test_IDhash()
+
+// --- END hash tests ----------------------------------------------------------
+
+
+// --- BEGIN ordering tests ----------------------------------------------------
+void test_IDordering() {
+
+  BOOST_TEST_CHECKPOINT("Testing ordering of geometry IDs");
+
+  // reference: lexicographic comparison of the indices, level by level
+  auto const refCmp = [](std::array<unsigned int, 4U> const& a,
+    std::array<unsigned int, 4U> const& b)
+    { return (a < b)? -1: ((b < a)? +1: 0); };
+
+  unsigned int const values[]
+    = { 0U, 1U, 2U, 0x7FFFFFFFU, 0x80000000U, geo::WireID::InvalidID - 1U,
+        geo::WireID::InvalidID };
+  std::vector<std::array<unsigned int, 4U>> indices;
+  for (unsigned int c: { 0U, 1U, geo::CryostatID::InvalidID })
+    for (unsigned int t: { 0U, 5U, geo::TPCID::InvalidID })
+      for (unsigned int p: { 0U, 2U, 0x80000000U })
+        for (unsigned int w: values) indices.push_back({ c, t, p, w });
+
+  for (auto const& a: indices) {
+    for (auto const& b: indices) {
+      int const expected = refCmp(a, b);
+
+      geo::WireID const wa { a[0], a[1], a[2], a[3] };
+      geo::WireID const wb { b[0], b[1], b[2], b[3] };
+      BOOST_CHECK_EQUAL(wa.cmp(wb), expected);
+      BOOST_CHECK_EQUAL(wa < wb, expected < 0);
+      BOOST_CHECK_EQUAL(wa == wb, expected == 0);
+
+      geo::PlaneID const pa { a[0], a[1], a[2] };
+      geo::PlaneID const pb { b[0], b[1], b[2] };
+      int const planeExpected
+        = refCmp({ a[0], a[1], a[2] }, { b[0], b[1], b[2] });
+      BOOST_CHECK_EQUAL(pa.cmp(pb), planeExpected);
+      BOOST_CHECK_EQUAL(pa < pb, planeExpected < 0);
+
+      geo::TPCID const ta { a[0], a[3] };
+      geo::TPCID const tb { b[0], b[3] };
+      int const tpcExpected = refCmp({ a[0], a[3] }, { b[0], b[3] });
+      BOOST_CHECK_EQUAL(ta.cmp(tb), tpcExpected);
+      BOOST_CHECK_EQUAL(ta < tb, tpcExpected < 0);
+
+      geo::OpDetID const oa { a[1], a[3] };
+      geo::OpDetID const ob { b[1], b[3] };
+      int const opDetExpected = refCmp({ a[1], a[3] }, { b[1], b[3] });
+      BOOST_CHECK_EQUAL(oa.cmp(ob), opDetExpected);
+      BOOST_CHECK_EQUAL(oa < ob, opDetExpected < 0);
+
+#if __cpp_impl_three_way_comparison >= 201907L
+      BOOST_CHECK((wa <=> wb) == (expected <=> 0));
+      BOOST_CHECK((pa <=> pb) == (planeExpected <=> 0));
+      BOOST_CHECK((ta <=> tb) == (tpcExpected <=> 0));
+      BOOST_CHECK((oa <=> ob) == (opDetExpected <=> 0));
+#endif // __cpp_impl_three_way_comparison
+    } // for b
+  } // for a
+
+  // validity is ignored
+  geo::WireID invalid { 1, 2, 3, 4 };
+  invalid.markInvalid();
+  BOOST_CHECK_EQUAL(invalid.cmp(geo::WireID{ 1, 2, 3, 4 }), 0);
+  BOOST_CHECK(!(invalid < geo::WireID{ 1, 2, 3, 4 }));
+
+} // test_IDordering()
+// --- END ordering tests ------------------------------------------------------
+
+
+// --- BEGIN string tests ------------------------------------------------------
+template <typename ID>
+void TestIDstring(ID const& id, std::string const& expected) {
+
+  BOOST_CHECK_EQUAL(id.toString(), expected);
+  BOOST_CHECK_EQUAL(std::string(id), expected);
+  BOOST_CHECK_EQUAL(geo::IDstring<ID>{ id }.str(), expected);
+  BOOST_CHECK_EQUAL(geo::IDstring<ID>{ id }.c_str(), expected);
+  BOOST_CHECK_LE(expected.length(), geo::IDstring<ID>::MaxLength);
+
+  std::ostringstream sstr;
+  sstr << id;
+  BOOST_CHECK_EQUAL(sstr.str(), expected);
+
+  // exact buffer size is enough; one character less is not
+  std::string buffer(expected.length(), '\0');
+  auto const res = geo::toChars(buffer.data(), buffer.data() + buffer.size(), id);
+  BOOST_CHECK(res.ec == std::errc{});
+  BOOST_CHECK_EQUAL(res.ptr, buffer.data() + buffer.size());
+  BOOST_CHECK_EQUAL(buffer, expected);
+
+  auto const resShort
+    = geo::toChars(buffer.data(), buffer.data() + buffer.size() - 1U, id);
+  BOOST_CHECK(resShort.ec == std::errc::value_too_large);
+
+} // TestIDstring()
+
+
+void test_IDstring() {
+
+  BOOST_TEST_CHECKPOINT("Testing string representation of geometry IDs");
+
+  TestIDstring(geo::CryostatID{ 1 }, "C:1");
+  TestIDstring(geo::OpDetID{ 1, 15 }, "C:1 O:15");
+  TestIDstring(geo::TPCID{ 1, 15 }, "C:1 T:15");
+  TestIDstring(geo::PlaneID{ 0, 1, 2 }, "C:0 T:1 P:2");
+  TestIDstring(geo::WireID{ 0, 1, 2, 345 }, "C:0 T:1 P:2 W:345");
+  TestIDstring(geo::WireID{},
+    "C:4294967295 T:4294967295 P:4294967295 W:4294967295");
+
+  BOOST_CHECK_EQUAL(geo::IDstring<geo::WireID>::MaxLength, 51U);
+
+} // test_IDstring()
+
+
+/// Digit grouping by thousands, to test streaming with a custom locale.
+struct ThousandsGrouping: std::numpunct<char> {
+  char do_thousands_sep() const override { return ','; }
+  std::string do_grouping() const override { return "\3"; }
+}; // struct ThousandsGrouping
+
+
+void test_IDstreamFormat() {
+
+  BOOST_TEST_CHECKPOINT("Testing stream formatting of geometry IDs");
+
+  // the formatting of the stream applies to each index
+  std::ostringstream sstr;
+  sstr << std::hex << geo::WireID{ 0, 1, 10, 255 };
+  BOOST_CHECK_EQUAL(sstr.str(), "C:0 T:1 P:a W:ff");
+
+  // the field width applies to the first label only
+  sstr.str("");
+  sstr << std::dec << std::setw(6) << geo::TPCID{ 1, 2 } << " " << geo::TPCID{};
+  BOOST_CHECK_EQUAL(sstr.str(), "    C:1 T:2 C:4294967295 T:4294967295");
+
+  sstr.str("");
+  sstr << std::left << std::setfill('.') << std::setw(5)
+    << geo::OpDetID{ 3, 4 };
+  BOOST_CHECK_EQUAL(sstr.str(), "C:...3 O:4");
+
+  // the locale of the stream applies to each index
+  std::ostringstream grouped;
+  grouped.imbue(std::locale(grouped.getloc(), new ThousandsGrouping));
+  grouped << geo::PlaneID{ 0, 12345, 2 };
+  BOOST_CHECK_EQUAL(grouped.str(), "C:0 T:12,345 P:2");
+
+} // test_IDstreamFormat()
+
+
+template <typename ID>
+void TestParseID(ID const& id) {
+
+  std::optional<ID> const parsed = geo::parseID<ID>(id.toString());
+  BOOST_TEST_CHECKPOINT("Parsing '" << id.toString() << "'");
+  BOOST_CHECK(parsed.has_value());
+  if (!parsed) return;
+  BOOST_CHECK_EQUAL(*parsed, id);
+  BOOST_CHECK_EQUAL(parsed->isValid, id.isValid);
+
+} // TestParseID()
+
+
+void test_parseID() {
+
+  BOOST_TEST_CHECKPOINT("Testing parsing of geometry IDs");
+
+  TestParseID(geo::CryostatID{ 1 });
+  TestParseID(geo::OpDetID{ 1, 15 });
+  TestParseID(geo::TPCID{ 1, 15 });
+  TestParseID(geo::PlaneID{ 0, 1, 2 });
+  TestParseID(geo::WireID{ 0, 1, 2, 345 });
+  TestParseID(geo::WireID{ 4294967294, 0, 0, 0 });
+  TestParseID(geo::WireID{}); // invalid
+
+  // the text must match exactly the output format
+  BOOST_CHECK(!geo::parseID<geo::WireID>(""));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0 T:1 P:2"));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0 T:1 P:2 W:"));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0 T:1 P:2 W:3 "));
+  BOOST_CHECK(!geo::parseID<geo::WireID>(" C:0 T:1 P:2 W:3"));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0  T:1 P:2 W:3"));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0 T:1 P:2 W:-3"));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0 T:1 P:2 W:+3"));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0 T:1 W:2 P:3"));
+  BOOST_CHECK(!geo::parseID<geo::WireID>("C:0 T:1 P:2 W:4294967296"));
+  BOOST_CHECK(!geo::parseID<geo::TPCID>("C:0 O:1"));
+  BOOST_CHECK(!geo::parseID<geo::OpDetID>("C:0 T:1"));
+
+  // fromChars() stops at the end of the ID
+  std::string const text = "C:1 T:2 P:0, C:1 T:2 P:1";
+  geo::PlaneID pid;
+  auto const res
+    = geo::fromChars(text.data(), text.data() + text.size(), pid);
+  BOOST_CHECK(res.ec == std::errc{});
+  BOOST_CHECK_EQUAL(res.ptr, text.data() + 11);
+  BOOST_CHECK_EQUAL(pid, geo::PlaneID(1, 2, 0));
+  BOOST_CHECK(pid.isValid);
+
+  // a shallower ID just reads fewer levels
+  auto const resTPC
+    = geo::fromChars(text.data(), text.data() + text.size(), pid.asTPCID());
+  BOOST_CHECK(resTPC.ec == std::errc{});
+  BOOST_CHECK_EQUAL(resTPC.ptr, text.data() + 7);
+
+} // test_parseID()
+
+// --- END string tests --------------------------------------------------------
+
+
 //
 // CryostatID test
 //
@@ -834,3 +1098,31 @@ BOOST_AUTO_TEST_CASE(WireIDtest) {
   test_WireID_integralConstructor();
 }
 
+//
+// hash test
+//
+BOOST_AUTO_TEST_CASE(IDhashTest) {
+  test_IDhash();
+}
+
+//
+// ordering test
+//
+BOOST_AUTO_TEST_CASE(IDorderingTest) {
+  test_IDordering();
+}
+
+//
+// string test
+//
+BOOST_AUTO_TEST_CASE(IDstringTest) {
+  test_IDstring();
+  test_IDstreamFormat();
+}
+
+//
+// parsing test
+//
+BOOST_AUTO_TEST_CASE(IDparseTest) {
+  test_parseID();
+}
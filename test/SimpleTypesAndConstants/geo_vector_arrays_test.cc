@@ -0,0 +1,223 @@
+/**
+ * @file   geo_vector_arrays_test.cc
+ * @brief  Test of geo_vector_arrays.h collections
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_vector_arrays_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vector_arrays.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <algorithm> // std::sort(), std::reverse(), std::count_if(), ...
+#include <numeric> // std::accumulate()
+#include <iterator> // std::back_inserter(), std::make_reverse_iterator()
+#include <utility> // std::as_const()
+#include <stdexcept> // std::length_error
+
+
+//------------------------------------------------------------------------------
+template <typename Vector>
+void CheckVectorClose(Vector const& a, Vector const& b) {
+  BOOST_CHECK_SMALL(a.X() - b.X(), 1e-9);
+  BOOST_CHECK_SMALL(a.Y() - b.Y(), 1e-9);
+  BOOST_CHECK_SMALL(a.Z() - b.Z(), 1e-9);
+} // CheckVectorClose()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(PointArrayTest) {
+
+  std::vector<geo::Point_t> const points {
+    { 1.0, 2.0, 3.0 }, { -1.0, 0.5, 4.0 }, { 0.0, 0.0, 0.0 }
+  };
+
+  geo::PointArray array { points };
+  BOOST_CHECK_EQUAL(array.size(), points.size());
+  BOOST_CHECK(!array.empty());
+  BOOST_CHECK_EQUAL(array.xData()[1], -1.0);
+  BOOST_CHECK_EQUAL(array.yData()[1],  0.5);
+  BOOST_CHECK_EQUAL(array.zData()[1],  4.0);
+
+  std::vector<geo::Point_t> const copy = array.toVector();
+  BOOST_CHECK_EQUAL(copy.size(), points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    BOOST_CHECK_EQUAL(copy[i], points[i]);
+    BOOST_CHECK_EQUAL(array.get(i), points[i]);
+  }
+
+  // proxy access
+  array[2] = geo::Point_t{ 7.0, 8.0, 9.0 };
+  BOOST_CHECK_EQUAL(array[2].X(), 7.0);
+  BOOST_CHECK_EQUAL(array.get(2), (geo::Point_t{ 7.0, 8.0, 9.0 }));
+  array[2].SetXYZ(0.0, 0.0, 0.0);
+  BOOST_CHECK_EQUAL(geo::Point_t(array[2]), points[2]);
+
+  // iteration
+  std::size_t n = 0;
+  for (geo::Point_t const& p: std::as_const(array))
+    BOOST_CHECK_EQUAL(p, points[n++]);
+  BOOST_CHECK_EQUAL(n, points.size());
+  BOOST_CHECK_EQUAL(array.end() - array.begin(), 3);
+
+  // translation
+  geo::Vector_t const shift { 0.5, -1.0, 2.0 };
+  array.translate(shift);
+  for (std::size_t i = 0; i < points.size(); ++i)
+    CheckVectorClose(array.get(i), points[i] + shift);
+
+  // rotation by 90 degrees around z
+  geo::Rotation_t const rot { 0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0 };
+  array.assign(points);
+  array.rotate(rot);
+  for (std::size_t i = 0; i < points.size(); ++i)
+    CheckVectorClose(array.get(i), rot * points[i]);
+
+  array.push_back({ 1.0, 1.0, 1.0 });
+  array.emplace_back(2.0, 2.0, 2.0);
+  BOOST_CHECK_EQUAL(array.size(), points.size() + 2U);
+  BOOST_CHECK_EQUAL(array.get(4), (geo::Point_t{ 2.0, 2.0, 2.0 }));
+
+  array.clear();
+  BOOST_CHECK(array.empty());
+
+} // BOOST_AUTO_TEST_CASE(PointArrayTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(IteratorTest) {
+
+  std::vector<geo::Point_t> const points {
+    { 3.0, 0.0, 1.0 }, { 1.0, 1.0, 2.0 }, { 4.0, 2.0, 3.0 }, { 1.5, 3.0, 4.0 }
+  };
+  geo::PointArray array { points };
+  geo::PointArray const& carray = array;
+
+  // random access operators, also mixing mutable and constant iterators
+  geo::PointArray::iterator const it = array.begin();
+  geo::PointArray::const_iterator const cit = it; // conversion
+  BOOST_CHECK(cit == carray.begin());
+  BOOST_CHECK(it == carray.cbegin());
+  BOOST_CHECK(carray.cend() != it);
+  BOOST_CHECK(it < array.end());
+  BOOST_CHECK(!(it > array.end()));
+  BOOST_CHECK(array.end() > it);
+  BOOST_CHECK(it <= it);
+  BOOST_CHECK(it >= cit);
+  BOOST_CHECK(cit <= array.end());
+  BOOST_CHECK((2 + it) == (it + 2));
+  BOOST_CHECK((2 + cit) == (it + 2));
+  BOOST_CHECK_EQUAL(carray.cend() - it, 4);
+  BOOST_CHECK_EQUAL((*(1 + it)).X(), 1.0);
+  BOOST_CHECK_EQUAL(it[2].X(), 4.0);
+
+  // reverse iteration
+  std::vector<geo::Point_t> reversed;
+  std::copy(std::make_reverse_iterator(carray.end()),
+    std::make_reverse_iterator(carray.begin()), std::back_inserter(reversed));
+  BOOST_CHECK_EQUAL(reversed.size(), points.size());
+  BOOST_CHECK_EQUAL(reversed.front(), points.back());
+  BOOST_CHECK_EQUAL(reversed.back(), points.front());
+  BOOST_CHECK_EQUAL((*std::make_reverse_iterator(array.end())).Z(), 4.0);
+
+  // standard algorithms, including those swapping the elements
+  BOOST_CHECK_EQUAL(std::count_if(carray.begin(), carray.end(),
+    [](geo::Point_t const& p){ return p.X() > 2.0; }), 2);
+  BOOST_CHECK_EQUAL(std::accumulate(carray.begin(), carray.end(), 0.0,
+    [](double sum, geo::Point_t const& p){ return sum + p.Z(); }), 10.0);
+  auto const found = std::find_if(array.begin(), array.end(),
+    [](geo::Point_t const& p){ return p.Y() == 2.0; });
+  BOOST_CHECK_EQUAL(found - array.begin(), 2);
+
+  std::iter_swap(array.begin(), array.begin() + 3);
+  BOOST_CHECK_EQUAL(array.get(0), points[3]);
+  BOOST_CHECK_EQUAL(array.get(3), points[0]);
+
+  std::reverse(array.begin(), array.end()); // { 0, 2, 1, 3 }
+  BOOST_CHECK_EQUAL(array.get(0), points[0]);
+  BOOST_CHECK_EQUAL(array.get(1), points[2]);
+  BOOST_CHECK_EQUAL(array.get(3), points[3]);
+
+  std::sort(array.begin(), array.end(),
+    [](geo::Point_t const& a, geo::Point_t const& b){ return a.X() < b.X(); });
+  std::vector<geo::Point_t> sorted = points;
+  std::sort(sorted.begin(), sorted.end(),
+    [](geo::Point_t const& a, geo::Point_t const& b){ return a.X() < b.X(); });
+  for (std::size_t i = 0; i < points.size(); ++i)
+    BOOST_CHECK_EQUAL(array.get(i), sorted[i]);
+  BOOST_CHECK(std::is_sorted(carray.begin(), carray.end(),
+    [](geo::Point_t const& a, geo::Point_t const& b){ return a.X() < b.X(); }));
+
+  std::fill(array.begin(), array.begin() + 2, geo::Point_t{ 0.0, 0.0, 0.0 });
+  std::copy(points.begin(), points.begin() + 2, array.begin() + 2);
+  BOOST_CHECK_EQUAL(array.get(1), (geo::Point_t{ 0.0, 0.0, 0.0 }));
+  BOOST_CHECK_EQUAL(array.get(3), points[1]);
+
+} // BOOST_AUTO_TEST_CASE(IteratorTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(VectorArrayTest) {
+
+  std::vector<geo::Vector_t> const vectors {
+    { 3.0, 4.0, 0.0 }, { 1.0, 2.0, 2.0 }, { 0.0, 0.0, -1.0 }
+  };
+  geo::VectorArray const array { vectors };
+
+  geo::Vector_t const dir { 0.0, 1.0, 1.0 };
+  std::vector<double> const dots = array.Dot(dir);
+  std::vector<double> const selfDots = array.Dot(array);
+  std::vector<double> const mag2 = array.Mag2();
+  std::vector<double> const mag = array.R();
+  BOOST_CHECK_EQUAL(dots.size(), vectors.size());
+  for (std::size_t i = 0; i < vectors.size(); ++i) {
+    BOOST_CHECK_CLOSE(dots[i], vectors[i].Dot(dir), 1e-9);
+    BOOST_CHECK_CLOSE(selfDots[i], vectors[i].Mag2(), 1e-9);
+    BOOST_CHECK_CLOSE(mag2[i], vectors[i].Mag2(), 1e-9);
+    BOOST_CHECK_CLOSE(mag[i], vectors[i].R(), 1e-9);
+  }
+  BOOST_CHECK_EQUAL(mag[0], 5.0);
+
+  // the two arrays must have the same size
+  geo::VectorArray const shorter { std::vector<geo::Vector_t>
+    (vectors.begin(), vectors.end() - 1) };
+  BOOST_CHECK_THROW(array.Dot(shorter), std::length_error);
+  BOOST_CHECK_THROW(shorter.Dot(array), std::length_error);
+  BOOST_CHECK(geo::VectorArray{}.Dot(geo::VectorArray{}).empty());
+
+} // BOOST_AUTO_TEST_CASE(VectorArrayTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SinglePrecisionTest) {
+
+  static_assert(sizeof(geo::PointF_t) == 3U * sizeof(float));
+  static_assert(sizeof(geo::VectorF_t) == 3U * sizeof(float));
+
+  geo::Point_t const p { 1.5, -2.25, 1.0/3.0 };
+  geo::PointF_t const pf = geo::toPointF(p);
+  BOOST_CHECK_EQUAL(pf.X(),  1.5f);
+  BOOST_CHECK_EQUAL(pf.Y(), -2.25f);
+  BOOST_CHECK_EQUAL(pf.Z(), 1.0f/3.0f);
+  BOOST_CHECK_EQUAL(geo::toPoint(pf), (geo::Point_t{ 1.5, -2.25, pf.Z() }));
+
+  geo::Vector_t const v { 0.0, 3.0, -4.0 };
+  geo::VectorF_t const vf = geo::toVectorF(v);
+  BOOST_CHECK_EQUAL(geo::toVector(vf), v);
+
+  geo::PointFArray points;
+  points.push_back(pf);
+  points.translate(geo::VectorF_t{ 1.0f, 1.0f, 1.0f });
+  BOOST_CHECK_EQUAL(points.get(0).X(), 2.5f);
+
+  geo::VectorFArray vectors;
+  vectors.push_back(vf);
+  BOOST_CHECK_EQUAL(vectors.R()[0], 5.0f);
+
+} // BOOST_AUTO_TEST_CASE(SinglePrecisionTest)
@@ -0,0 +1,118 @@
+/**
+ * @file   geo_vector_float_benchmark.cc
+ * @brief  Benchmark of single against double precision geometry vectors
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_vector_float_benchmark [nVectors [repeat]]
+ *
+ * For `nVectors` random vectors in double (`geo::Vector_t`, `geo::Point_t`)
+ * and single precision (`geo::VectorF_t`, `geo::PointF_t`), this prints the
+ * memory used by their collections and the time per vector (best of `repeat`
+ * passes) of:
+ *  * the sum of the squared magnitudes over a `std::vector`;
+ *  * `translate()` of a `geo::PointArray` or `geo::PointFArray`;
+ *  * `R()` of a `geo::VectorArray` or `geo::VectorFArray`.
+ * The time of the narrowing conversion of a whole collection is also printed.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vector_arrays.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS
+
+
+//------------------------------------------------------------------------------
+/// Prints the double and single precision time per vector of an operation.
+void printResult(
+  std::string const& name, double doubleTime, double floatTime, std::size_t n
+) {
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+    << std::fixed << std::setprecision(2)
+    << std::setw(10) << (doubleTime / n)
+    << std::setw(10) << (floatTime / n)
+    << std::setw(10) << (doubleTime / floatTime) << std::endl;
+} // printResult()
+
+
+/// Returns the sum of the squared magnitudes of all the vectors.
+template <typename Vector>
+double sumMag2(std::vector<Vector> const& vectors) {
+  typename Vector::Scalar sum = 0;
+  for (Vector const& v: vectors) sum += v.Mag2();
+  return sum;
+} // sumMag2()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const n
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 5U;
+
+  std::mt19937 engine { 12345U };
+  std::uniform_real_distribution<double> coord { -500.0, 500.0 };
+  std::vector<geo::Vector_t> vectors(n);
+  for (geo::Vector_t& v: vectors)
+    v.SetXYZ(coord(engine), coord(engine), coord(engine));
+  std::vector<geo::Point_t> points(n);
+  for (geo::Point_t& p: points)
+    p.SetXYZ(coord(engine), coord(engine), coord(engine));
+
+  std::vector<geo::VectorF_t> vectorsF(n);
+  std::vector<geo::PointF_t> pointsF(n);
+  double const narrowTime = bestTime(repeat, [&](){
+      for (std::size_t i = 0; i < n; ++i)
+        vectorsF[i] = geo::toVectorF(vectors[i]);
+    });
+  for (std::size_t i = 0; i < n; ++i) pointsF[i] = geo::toPointF(points[i]);
+
+  std::cout << n << " vectors\n"
+    << "  memory [bytes/vector]: " << sizeof(geo::Vector_t) << " (double), "
+    << sizeof(geo::VectorF_t) << " (float)\n"
+    << "  time [ns/vector]            double     float     ratio"
+    << std::endl;
+
+  double check = 0.0; // prevents the computations from being optimised away
+
+  printResult("sum of Mag2()",
+    bestTime(repeat, [&](){ check += sumMag2(vectors); }),
+    bestTime(repeat, [&](){ check += sumMag2(vectorsF); }),
+    n);
+
+  geo::PointArray pointArray { points };
+  geo::PointFArray pointFArray { pointsF };
+  geo::Vector_t const shift { 0.5, -0.5, 0.25 };
+  geo::VectorF_t const shiftF = geo::toVectorF(shift);
+  printResult("PointArray::translate()",
+    bestTime(repeat, [&](){ pointArray.translate(shift); }),
+    bestTime(repeat, [&](){ pointFArray.translate(shiftF); }),
+    n);
+  check += pointArray.get(0).X() + pointFArray.get(0).X();
+
+  geo::VectorArray const vectorArray { vectors };
+  geo::VectorFArray const vectorFArray { vectorsF };
+  printResult("VectorArray::R()",
+    bestTime(repeat, [&](){ check += vectorArray.R().back(); }),
+    bestTime(repeat, [&](){ check += vectorFArray.R().back(); }),
+    n);
+
+  std::cout << "  narrowing conversion: " << std::setprecision(2)
+    << (narrowTime / n) << " ns/vector" << std::endl;
+  std::cout << "(checksum: " << std::setprecision(0) << check << ")"
+    << std::endl;
+
+  return EXIT_SUCCESS;
+
+} // main()
@@ -0,0 +1,124 @@
+/**
+ * @file   geo_vector_transforms_benchmark.cc
+ * @brief  Benchmark of batched transformations against a per-point loop
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     geo_vector_transforms_benchmark [nPoints [repeat]]
+ *
+ * `nPoints` random points are rotated and translated with:
+ *  * a loop computing `rot * p + shift` on each `geo::Point_t`;
+ *  * `geo::transformPoints()` on a `std::vector<geo::Point_t>`;
+ *  * `geo::transformCoords()` on the arrays of a `geo::PointArray`
+ *    (structure of arrays), into another one;
+ *  * `geo::transformPoints()` on a `geo::PointArray`, in place (the points
+ *    are restored before each pass, and that copy is timed too).
+ *
+ * The time per point (best of `repeat` passes) is printed, together with the
+ * largest difference of the batched results from the per-point loop.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vector_transforms.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vector_arrays.h"
+#include "larcoreobj/SimpleTypesAndConstants/geo_vectors.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm> // std::max()
+#include <cmath> // std::abs(), std::sin(), std::cos()
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS
+
+
+//------------------------------------------------------------------------------
+/// Returns the largest coordinate difference between `a` and `b`.
+template <typename Points>
+double maxDifference(std::vector<geo::Point_t> const& a, Points const& b) {
+  double diff = 0.0;
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    geo::Point_t const p = b[i];
+    diff = std::max({ diff, std::abs(a[i].X() - p.X()),
+      std::abs(a[i].Y() - p.Y()), std::abs(a[i].Z() - p.Z()) });
+  }
+  return diff;
+} // maxDifference()
+
+
+/// Prints the time per point of a method, and its difference from reference.
+void printResult
+  (std::string const& name, double time, std::size_t nPoints, double diff)
+{
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+    << std::setw(8) << std::fixed << std::setprecision(2)
+    << (time / nPoints) << " ns/point"
+    << "    max. difference: " << std::scientific << std::setprecision(1)
+    << diff << std::endl;
+} // printResult()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const nPoints
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 5U;
+
+  std::mt19937 engine { 12345U };
+  std::uniform_real_distribution<double> coord { -500.0, 500.0 };
+  std::vector<geo::Point_t> points(nPoints);
+  for (geo::Point_t& p: points)
+    p.SetXYZ(coord(engine), coord(engine), coord(engine));
+
+  // a rotation around z followed by one around x
+  double const a = 0.3, b = -1.1;
+  geo::Rotation_t const rot {
+                 std::cos(a),             -std::sin(a),          0.0,
+    std::cos(b) * std::sin(a), std::cos(b) * std::cos(a), -std::sin(b),
+    std::sin(b) * std::sin(a), std::sin(b) * std::cos(a),  std::cos(b)
+  };
+  geo::Vector_t const shift { 10.0, -20.0, 30.0 };
+
+  std::cout << "Transforming " << nPoints << " points:" << std::endl;
+
+  std::vector<geo::Point_t> reference(nPoints);
+  printResult("per-point loop", bestTime(repeat, [&](){
+      for (std::size_t i = 0; i < nPoints; ++i)
+        reference[i] = rot * points[i] + shift;
+    }), nPoints, 0.0);
+
+  std::vector<geo::Point_t> aos(nPoints);
+  double const aosTime = bestTime(repeat, [&](){
+      geo::transformPoints(rot, shift, nPoints, points.data(), aos.data());
+    });
+  printResult("transformPoints (AoS)", aosTime, nPoints,
+    maxDifference(reference, aos));
+
+  geo::PointArray const original { points };
+  geo::PointArray soa { nPoints };
+  double const soaTime = bestTime(repeat, [&](){
+      geo::transformCoords(rot, shift, nPoints,
+        original.xData(), original.yData(), original.zData(),
+        soa.xData(), soa.yData(), soa.zData()
+        );
+    });
+  printResult("transformCoords (SoA)", soaTime, nPoints,
+    maxDifference(reference, soa));
+
+  geo::PointArray inPlace { nPoints };
+  double const inPlaceTime = bestTime(repeat, [&](){
+      inPlace = original;
+      geo::transformPoints(rot, shift, inPlace);
+    });
+  printResult("in place (SoA)", inPlaceTime, nPoints,
+    maxDifference(reference, inPlace));
+
+  return EXIT_SUCCESS;
+
+} // main()
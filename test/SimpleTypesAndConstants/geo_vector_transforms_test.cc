@@ -0,0 +1,115 @@
+/**
+ * @file   geo_vector_transforms_test.cc
+ * @brief  Test of geo_vector_transforms.h batched transformations
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( geo_vector_transforms_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/geo_vector_transforms.h"
+
+// C/C++ standard libraries
+#include <vector>
+#include <algorithm> // std::max()
+#include <array>
+#include <limits>
+#include <cmath> // std::abs(), std::sin(), std::cos()
+
+
+//------------------------------------------------------------------------------
+/// Checks that `a` and `b` are the same to within the last digit.
+void CheckCoordinate(double a, double b) {
+  double const tol = std::numeric_limits<double>::epsilon()
+    * std::max({ std::abs(a), std::abs(b), 1.0 });
+  BOOST_CHECK_LE(std::abs(a - b), tol);
+} // CheckCoordinate()
+
+
+void CheckPoint(geo::Point_t const& a, geo::Point_t const& b) {
+  BOOST_TEST_CHECKPOINT("Comparing " << a << " to " << b);
+  CheckCoordinate(a.X(), b.X());
+  CheckCoordinate(a.Y(), b.Y());
+  CheckCoordinate(a.Z(), b.Z());
+} // CheckPoint()
+
+
+/// Rotation by `angle` around z followed by `angle` around x.
+geo::Rotation_t makeRotation(double angle) {
+  double const c = std::cos(angle), s = std::sin(angle);
+  geo::Rotation_t const rotZ { c, -s, 0.0, s, c, 0.0, 0.0, 0.0, 1.0 };
+  geo::Rotation_t const rotX { 1.0, 0.0, 0.0, 0.0, c, -s, 0.0, s, c };
+  std::array<double, 9U> mz, mx, m;
+  rotZ.GetComponents(mz.begin());
+  rotX.GetComponents(mx.begin());
+  for (std::size_t i = 0; i < 3; ++i) for (std::size_t j = 0; j < 3; ++j) {
+    m[i*3 + j] = 0.0;
+    for (std::size_t k = 0; k < 3; ++k) m[i*3 + j] += mx[i*3 + k] * mz[k*3 + j];
+  }
+  return { m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8] };
+} // makeRotation()
+
+
+std::vector<geo::Point_t> makePoints(std::size_t n) {
+  std::vector<geo::Point_t> points;
+  for (std::size_t i = 0; i < n; ++i) {
+    double const t = static_cast<double>(i);
+    points.emplace_back(0.5 * t - 30.0, 250.0 - 1.5 * t, 0.25 * t * t);
+  }
+  return points;
+} // makePoints()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(TransformCoordsTest) {
+
+  geo::Rotation_t const rot = makeRotation(0.6);
+  geo::Vector_t const shift { 10.0, -5.0, 300.0 };
+  std::vector<geo::Point_t> const points = makePoints(37U);
+  std::size_t const n = points.size();
+
+  std::vector<double> x, y, z;
+  for (geo::Point_t const& p: points) {
+    x.push_back(p.X()); y.push_back(p.Y()); z.push_back(p.Z());
+  }
+
+  std::vector<double> outX(n), outY(n), outZ(n);
+  geo::transformCoords(rot, shift, n, x.data(), y.data(), z.data(),
+    outX.data(), outY.data(), outZ.data());
+  for (std::size_t i = 0; i < n; ++i)
+    CheckPoint({ outX[i], outY[i], outZ[i] }, rot * points[i] + shift);
+
+  // in place
+  geo::transformCoords(rot, shift, n, x.data(), y.data(), z.data(),
+    x.data(), y.data(), z.data());
+  BOOST_CHECK(x == outX);
+  BOOST_CHECK(y == outY);
+  BOOST_CHECK(z == outZ);
+
+} // BOOST_AUTO_TEST_CASE(TransformCoordsTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(TransformPointsTest) {
+
+  geo::Rotation_t const rot = makeRotation(-1.3);
+  geo::Vector_t const shift { -1.0, 2.0, -3.0 };
+  std::vector<geo::Point_t> const points = makePoints(20U);
+
+  std::vector<geo::Point_t> transformed = points;
+  geo::transformPoints(rot, shift, transformed);
+
+  geo::PointArray array { points };
+  geo::transformPoints(rot, shift, array);
+
+  BOOST_CHECK_EQUAL(transformed.size(), points.size());
+  BOOST_CHECK_EQUAL(array.size(), points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    CheckPoint(transformed[i], rot * points[i] + shift);
+    BOOST_CHECK_EQUAL(array.get(i), transformed[i]);
+  }
+
+} // BOOST_AUTO_TEST_CASE(TransformPointsTest)
@@ -0,0 +1,724 @@
+/**
+ * @file   raw_codec_benchmark.cc
+ * @brief  Benchmark of the raw waveform codecs, one for each `raw::Compress_t`
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     raw_codec_benchmark [--channels=N] [--ticks=N] [--pedestal=ADC]
+ *       [--noise=RMS] [--occupancy=F] [--threshold=ADC] [--repeat=N]
+ *       [--seed=N] [--modes=kNone,kHuffman,...] [--output=file.json]
+ *
+ * A set of synthetic waveforms is generated: a flat pedestal, gaussian noise
+ * and unipolar pulses covering on average a fraction `occupancy` of the
+ * ticks, digitised in the 12-bit range of the ADC. Both `noise` and
+ * `occupancy` may be `0` (no noise, no pulses); `ticks` may not.
+ * Each channel is then encoded and decoded with each compression mode, and
+ * the compression ratio, the throughput and the per-channel latency (best of
+ * `repeat` passes) are written in JSON format.
+ * The lossy modes also report the largest and average difference from the
+ * original samples; for the lossless ones any difference is an error, and
+ * makes the program exit with a non-zero code.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/RawTypes.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawHuffmanCodec.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawZeroSuppressionCodec.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawDynamicDecimationCodec.h"
+#include "larcoreobj/SimpleTypesAndConstants/RawBitPackedDeltaCodec.h"
+
+// C/C++ standard libraries
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip> // std::setprecision()
+#include <memory> // std::unique_ptr
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm> // std::sort(), std::min(), std::clamp()
+#include <cmath> // std::exp(), std::lround(), std::ceil(), std::sqrt()
+#include <cstdlib> // std::abs(), EXIT_SUCCESS, EXIT_FAILURE
+#include <cstdint> // std::uint16_t
+#include <stdexcept> // std::runtime_error
+
+
+//------------------------------------------------------------------------------
+/// Parameters of the benchmark.
+struct BenchmarkConfig_t {
+  std::size_t nChannels = 1000U; ///< Number of waveforms.
+  std::size_t nTicks = 6000U; ///< Ticks per waveform.
+  short pedestal = 900; ///< Pedestal [ADC].
+  double noise = 2.5; ///< Noise RMS [ADC].
+  double occupancy = 0.02; ///< Average fraction of ticks with signal.
+  short threshold = 0; ///< Suppression threshold (`0`: 4 noise RMS).
+  unsigned int repeat = 5U; ///< Passes of each measurement.
+  unsigned int seed = 12345U; ///< Seed of the waveform generator.
+  std::vector<raw::Compress_t> modes; ///< Modes to test (empty: all).
+  std::string output; ///< Output file name (empty: standard output).
+}; // struct BenchmarkConfig_t
+
+
+/// Returns the name of the compression mode.
+std::string modeName(raw::Compress_t mode) {
+  switch (mode) {
+    case raw::kNone:            return "kNone";
+    case raw::kHuffman:         return "kHuffman";
+    case raw::kZeroSuppression: return "kZeroSuppression";
+    case raw::kZeroHuffman:     return "kZeroHuffman";
+    case raw::kDynamicDec:      return "kDynamicDec";
+    case raw::kBitPackedDelta:  return "kBitPackedDelta";
+  } // switch
+  return "unknown";
+} // modeName()
+
+
+/// All the compression modes, in order.
+std::vector<raw::Compress_t> allModes() {
+  std::vector<raw::Compress_t> modes;
+  for (int mode = raw::kNone; mode <= raw::kBitPackedDelta; ++mode)
+    modes.push_back(static_cast<raw::Compress_t>(mode));
+  return modes;
+} // allModes()
+
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Interface to encode and decode a set of waveforms.
+ *
+ * Each implementation keeps the encoded form of all the channels, so that
+ * the decoding can be timed separately from the encoding.
+ */
+class WaveformCodec {
+    public:
+  virtual ~WaveformCodec() = default;
+
+  /// Prepares to encode `nChannels` waveforms.
+  virtual void resize(std::size_t nChannels) = 0;
+
+  /// Encodes the waveform `adc` as channel number `channel`.
+  virtual void encode(std::size_t channel, std::vector<short> const& adc) = 0;
+
+  /// Decodes the channel number `channel` into `adc`.
+  virtual void decode(std::size_t channel, std::vector<short>& adc) const = 0;
+
+  /// Returns the size of the encoded channel number `channel` [bytes].
+  virtual std::size_t encodedSize(std::size_t channel) const = 0;
+
+  /// Returns whether the encoding preserves all the samples.
+  virtual bool isLossless() const = 0;
+
+}; // class WaveformCodec
+
+
+/// `raw::kNone`: the samples are copied.
+class NoCodec: public WaveformCodec {
+  std::vector<std::vector<short>> fData;
+    public:
+  void resize(std::size_t nChannels) override { fData.resize(nChannels); }
+  void encode(std::size_t channel, std::vector<short> const& adc) override
+    { fData[channel].assign(adc.begin(), adc.end()); }
+  void decode(std::size_t channel, std::vector<short>& adc) const override
+    { adc.assign(fData[channel].begin(), fData[channel].end()); }
+  std::size_t encodedSize(std::size_t channel) const override
+    { return fData[channel].size() * sizeof(short); }
+  bool isLossless() const override { return true; }
+}; // class NoCodec
+
+
+/// `raw::kHuffman`
+class HuffmanCodec: public WaveformCodec {
+  std::vector<raw::codec::ByteBuffer_t> fData;
+    public:
+  void resize(std::size_t nChannels) override { fData.resize(nChannels); }
+  void encode(std::size_t channel, std::vector<short> const& adc) override
+    {
+      fData[channel].clear();
+      raw::codec::encodeHuffman(adc.data(), adc.size(), fData[channel]);
+    }
+  void decode(std::size_t channel, std::vector<short>& adc) const override
+    {
+      raw::codec::decodeHuffman
+        (fData[channel].data(), fData[channel].size(), adc);
+    }
+  std::size_t encodedSize(std::size_t channel) const override
+    { return fData[channel].size(); }
+  bool isLossless() const override { return true; }
+}; // class HuffmanCodec
+
+
+/// `raw::kZeroSuppression`
+class ZeroSuppressionCodec: public WaveformCodec {
+  raw::codec::ZeroSuppressionEncoder fEncoder;
+  short fPedestal;
+  std::vector<std::vector<short>> fData;
+    public:
+  ZeroSuppressionCodec
+    (raw::codec::ZeroSuppressionEncoder::Config_t const& config, short ped)
+    : fEncoder(config), fPedestal(ped) {}
+  void resize(std::size_t nChannels) override { fData.resize(nChannels); }
+  void encode(std::size_t channel, std::vector<short> const& adc) override
+    {
+      fData[channel].clear();
+      fEncoder.encode(adc.data(), adc.size(), fPedestal, fData[channel]);
+    }
+  void decode(std::size_t channel, std::vector<short>& adc) const override
+    { raw::codec::ZeroSuppressedWaveform{ fData[channel] }.decode(adc); }
+  std::size_t encodedSize(std::size_t channel) const override
+    { return fData[channel].size() * sizeof(short); }
+  bool isLossless() const override { return false; }
+}; // class ZeroSuppressionCodec
+
+
+/**
+ * @brief `raw::kZeroHuffman`: zero suppression, then Huffman encoding.
+ *
+ * The headers of the zero-suppressed waveform (ticks, pedestal and regions)
+ * are stored verbatim, two bytes per word, and only the samples of the
+ * regions are Huffman encoded: coding the headers as differences would
+ * spend an escape code on almost every header word.
+ * With noisy waveforms many differences between samples exceed
+ * `raw::codec::Huffman::MaxDelta` and cost more than the sample itself;
+ * in that case the samples are stored verbatim too. A byte after the
+ * headers records the choice.
+ */
+class ZeroHuffmanCodec: public WaveformCodec {
+  using Waveform_t = raw::codec::ZeroSuppressedWaveform;
+  raw::codec::ZeroSuppressionEncoder fEncoder;
+  short fPedestal;
+  std::vector<short> fSuppressed; ///< Buffer for the encoding.
+  std::vector<raw::codec::ByteBuffer_t> fData;
+  mutable std::vector<short> fSamples; ///< Buffer for the decoding.
+  mutable std::vector<short> fDecoded; ///< Buffer for the decoding.
+
+  /// Values of the byte recording how the samples are stored.
+  static constexpr raw::codec::Byte_t RawSamples = 0U, HuffmanSamples = 1U;
+
+  static void writeWord(raw::codec::ByteBuffer_t& buffer, short word)
+    {
+      auto const value = static_cast<std::uint16_t>(word);
+      buffer.push_back(static_cast<raw::codec::Byte_t>(value));
+      buffer.push_back(static_cast<raw::codec::Byte_t>(value >> 8U));
+    }
+  static short readWord(raw::codec::Byte_t const* data)
+    { return static_cast<short>(data[0] | (data[1] << 8U)); }
+
+    public:
+  ZeroHuffmanCodec
+    (raw::codec::ZeroSuppressionEncoder::Config_t const& config, short ped)
+    : fEncoder(config), fPedestal(ped) {}
+  void resize(std::size_t nChannels) override { fData.resize(nChannels); }
+  void encode(std::size_t channel, std::vector<short> const& adc) override
+    {
+      fSuppressed.clear();
+      fEncoder.encode(adc.data(), adc.size(), fPedestal, fSuppressed);
+      std::size_t const nHeaderWords = Waveform_t::HeaderSize
+        + Waveform_t::RegionHeaderSize * fEncoder.lastRegions().size();
+      raw::codec::ByteBuffer_t& buffer = fData[channel];
+      buffer.clear();
+      for (std::size_t i = 0; i < nHeaderWords; ++i)
+        writeWord(buffer, fSuppressed[i]);
+      std::size_t const flagPos = buffer.size();
+      buffer.push_back(HuffmanSamples);
+      std::size_t const nSamples = fSuppressed.size() - nHeaderWords;
+      raw::codec::encodeHuffman
+        (fSuppressed.data() + nHeaderWords, nSamples, buffer);
+      if (buffer.size() - flagPos - 1U <= nSamples * 2U) return;
+      buffer.resize(flagPos);
+      buffer.push_back(RawSamples);
+      for (std::size_t i = nHeaderWords; i < fSuppressed.size(); ++i)
+        writeWord(buffer, fSuppressed[i]);
+    }
+  void decode(std::size_t channel, std::vector<short>& adc) const override
+    {
+      raw::codec::ByteBuffer_t const& buffer = fData[channel];
+      constexpr std::size_t WordBytes = 2U;
+      if (buffer.size() < Waveform_t::HeaderSize * WordBytes)
+        throw std::runtime_error("ZeroHuffmanCodec: truncated header");
+      fDecoded.resize(Waveform_t::HeaderSize);
+      for (std::size_t i = 0; i < Waveform_t::HeaderSize; ++i)
+        fDecoded[i] = readWord(buffer.data() + WordBytes * i);
+      std::size_t const nROIs
+        = raw::codec::details::readWords32(fDecoded.data() + 3U);
+      if (nROIs > buffer.size() / WordBytes / Waveform_t::RegionHeaderSize)
+        throw std::runtime_error("ZeroHuffmanCodec: truncated region headers");
+      std::size_t const nHeaderWords
+        = Waveform_t::HeaderSize + Waveform_t::RegionHeaderSize * nROIs;
+      if (buffer.size() < nHeaderWords * WordBytes)
+        throw std::runtime_error("ZeroHuffmanCodec: truncated region headers");
+      fDecoded.resize(nHeaderWords);
+      for (std::size_t i = Waveform_t::HeaderSize; i < nHeaderWords; ++i)
+        fDecoded[i] = readWord(buffer.data() + WordBytes * i);
+
+      std::size_t const flagPos = nHeaderWords * WordBytes;
+      if (buffer.size() <= flagPos)
+        throw std::runtime_error("ZeroHuffmanCodec: missing samples");
+      raw::codec::Byte_t const* const samples = buffer.data() + flagPos + 1U;
+      std::size_t const samplesSize = buffer.size() - flagPos - 1U;
+      if (buffer[flagPos] == RawSamples) {
+        for (std::size_t i = 0; i + 1U < samplesSize; i += WordBytes)
+          fDecoded.push_back(readWord(samples + i));
+      }
+      else {
+        raw::codec::decodeHuffman(samples, samplesSize, fSamples);
+        fDecoded.insert(fDecoded.end(), fSamples.begin(), fSamples.end());
+      }
+      Waveform_t{ fDecoded }.decode(adc);
+    }
+  std::size_t encodedSize(std::size_t channel) const override
+    { return fData[channel].size(); }
+  bool isLossless() const override { return false; }
+}; // class ZeroHuffmanCodec
+
+
+/// `raw::kDynamicDec`: the blocks are stored in their encoded form.
+class DynamicDecimationCodec: public WaveformCodec {
+  raw::codec::DynamicDecimationEncoder fEncoder;
+  short fPedestal;
+  raw::codec::DynamicDecimationBlock fBlock; ///< Buffer for the encoding.
+  std::vector<std::vector<short>> fData;
+    public:
+  DynamicDecimationCodec(
+    raw::codec::DynamicDecimationEncoder::Config_t const& config, short ped
+    )
+    : fEncoder(config, ped), fPedestal(ped) {}
+  void resize(std::size_t nChannels) override { fData.resize(nChannels); }
+  void encode(std::size_t channel, std::vector<short> const& adc) override
+    {
+      fData[channel].clear();
+      fEncoder.reset(fPedestal);
+      fEncoder.push(adc);
+      fEncoder.flush();
+      while (fEncoder.pull(fBlock)) fBlock.write(fData[channel]);
+    }
+  void decode(std::size_t channel, std::vector<short>& adc) const override
+    {
+      raw::codec::decodeDynamicDecimation
+        (fData[channel].data(), fData[channel].size(), adc);
+    }
+  std::size_t encodedSize(std::size_t channel) const override
+    { return fData[channel].size() * sizeof(short); }
+  bool isLossless() const override { return false; }
+}; // class DynamicDecimationCodec
+
+
+/// `raw::kBitPackedDelta`
+class BitPackedDeltaCodec: public WaveformCodec {
+  std::vector<raw::codec::ByteBuffer_t> fData;
+    public:
+  void resize(std::size_t nChannels) override { fData.resize(nChannels); }
+  void encode(std::size_t channel, std::vector<short> const& adc) override
+    {
+      fData[channel].clear();
+      raw::codec::encodeBitPackedDelta(adc.data(), adc.size(), fData[channel]);
+    }
+  void decode(std::size_t channel, std::vector<short>& adc) const override
+    {
+      raw::codec::decodeBitPackedDelta
+        (fData[channel].data(), fData[channel].size(), adc);
+    }
+  std::size_t encodedSize(std::size_t channel) const override
+    { return fData[channel].size(); }
+  bool isLossless() const override { return true; }
+}; // class BitPackedDeltaCodec
+
+
+/// Returns the codec for the specified compression mode.
+std::unique_ptr<WaveformCodec> makeCodec
+  (raw::Compress_t mode, BenchmarkConfig_t const& config)
+{
+  raw::codec::ZeroSuppressionEncoder::Config_t zsConfig;
+  zsConfig.threshold = config.threshold;
+  raw::codec::DynamicDecimationEncoder::Config_t ddConfig;
+  ddConfig.threshold = config.threshold;
+
+  switch (mode) {
+    case raw::kNone:
+      return std::make_unique<NoCodec>();
+    case raw::kHuffman:
+      return std::make_unique<HuffmanCodec>();
+    case raw::kZeroSuppression:
+      return std::make_unique<ZeroSuppressionCodec>
+        (zsConfig, config.pedestal);
+    case raw::kZeroHuffman:
+      return std::make_unique<ZeroHuffmanCodec>(zsConfig, config.pedestal);
+    case raw::kDynamicDec:
+      return std::make_unique<DynamicDecimationCodec>
+        (ddConfig, config.pedestal);
+    case raw::kBitPackedDelta:
+      return std::make_unique<BitPackedDeltaCodec>();
+  } // switch
+  throw std::runtime_error("No codec for mode " + std::to_string(mode));
+} // makeCodec()
+
+
+//------------------------------------------------------------------------------
+/// Returns synthetic waveforms with the specified features.
+std::vector<std::vector<short>> generateWaveforms
+  (BenchmarkConfig_t const& config)
+{
+  constexpr double PulseWidth = 3.0; // gaussian sigma [ticks]
+  constexpr double PulseTicks = 6.0 * PulseWidth; // ticks above noise
+  constexpr short MaxADC = 4095; // 12-bit ADC
+
+  // the distributions need a positive width and mean: without noise or
+  // pulses they are constructed with a placeholder and never used
+  bool const hasNoise = config.noise > 0.0;
+  double const meanPulses
+    = config.occupancy * double(config.nTicks) / PulseTicks;
+  bool const hasPulses = meanPulses > 0.0;
+
+  std::mt19937 engine { config.seed };
+  std::normal_distribution<double> noise
+    { 0.0, hasNoise? config.noise: 1.0 };
+  std::poisson_distribution<unsigned int> nPulses
+    { hasPulses? meanPulses: 1.0 };
+  std::uniform_real_distribution<double> peakTime
+    { 0.0, double(config.nTicks) };
+  std::exponential_distribution<double> amplitude { 1.0 / 60.0 };
+
+  std::vector<std::vector<short>> waveforms(config.nChannels);
+  std::vector<double> signal(config.nTicks);
+  for (std::vector<short>& adc: waveforms) {
+    std::fill(signal.begin(), signal.end(), 0.0);
+    for (unsigned int n = hasPulses? nPulses(engine): 0U; n > 0U; --n) {
+      double const peak = peakTime(engine);
+      double const height = 10.0 * config.noise + amplitude(engine);
+      std::size_t const first = static_cast<std::size_t>
+        (std::max(0.0, peak - PulseTicks / 2.0));
+      std::size_t const last = std::min(config.nTicks, static_cast<std::size_t>
+        (peak + PulseTicks / 2.0) + 1U);
+      for (std::size_t tick = first; tick < last; ++tick) {
+        double const dt = (double(tick) - peak) / PulseWidth;
+        signal[tick] += height * std::exp(-0.5 * dt * dt);
+      }
+    } // for pulses
+
+    adc.resize(config.nTicks);
+    for (std::size_t tick = 0; tick < config.nTicks; ++tick) {
+      long const value = std::lround(config.pedestal + signal[tick]
+        + (hasNoise? noise(engine): 0.0));
+      adc[tick] = static_cast<short>(std::clamp(value, 0L, long(MaxADC)));
+    }
+  } // for channels
+
+  return waveforms;
+} // generateWaveforms()
+
+
+//------------------------------------------------------------------------------
+/// Statistics of the per-channel latency [microseconds].
+struct LatencyStats_t {
+  double mean = 0.0;
+  double median = 0.0;
+  double p99 = 0.0;
+  double max = 0.0;
+}; // struct LatencyStats_t
+
+
+/// Results of the benchmark of a single compression mode.
+struct ModeResult_t {
+  raw::Compress_t mode;
+  bool lossless = true;
+  std::size_t rawBytes = 0U;
+  std::size_t encodedBytes = 0U;
+  double encodeSeconds = 0.0; ///< Total encoding time (best of each channel).
+  double decodeSeconds = 0.0; ///< Total decoding time (best of each channel).
+  LatencyStats_t encodeLatency;
+  LatencyStats_t decodeLatency;
+  long maxAbsError = 0; ///< Largest difference from the original [ADC].
+  double rmsError = 0.0; ///< RMS of the difference from the original [ADC].
+  bool failed = false; ///< A lossless mode did not reproduce the original.
+}; // struct ModeResult_t
+
+
+/// Returns the statistics of the latencies (in nanoseconds).
+LatencyStats_t latencyStats(std::vector<double> latencies) {
+  LatencyStats_t stats;
+  if (latencies.empty()) return stats;
+  std::sort(latencies.begin(), latencies.end());
+  double sum = 0.0;
+  for (double latency: latencies) sum += latency;
+  std::size_t const n = latencies.size();
+  stats.mean = sum / double(n) / 1000.0;
+  stats.median = latencies[n / 2U] / 1000.0;
+  stats.p99 = latencies[std::min(n - 1U, (n * 99U) / 100U)] / 1000.0;
+  stats.max = latencies.back() / 1000.0;
+  return stats;
+} // latencyStats()
+
+
+/// Encodes and decodes all the waveforms with the specified mode.
+ModeResult_t runBenchmark(
+  raw::Compress_t mode, BenchmarkConfig_t const& config,
+  std::vector<std::vector<short>> const& waveforms
+) {
+  using Clock_t = std::chrono::steady_clock;
+  auto const elapsed = [](Clock_t::time_point start, Clock_t::time_point stop)
+    { return std::chrono::duration<double, std::nano>(stop - start).count(); };
+
+  std::unique_ptr<WaveformCodec> codec = makeCodec(mode, config);
+  std::size_t const nChannels = waveforms.size();
+  codec->resize(nChannels);
+
+  ModeResult_t result;
+  result.mode = mode;
+  result.lossless = codec->isLossless();
+
+  // each pass encodes and decodes all the channels; the best time is kept
+  std::vector<double> encodeTimes(nChannels, -1.0);
+  std::vector<double> decodeTimes(nChannels, -1.0);
+  std::vector<short> decoded;
+  decoded.reserve(config.nTicks);
+  for (unsigned int pass = 0; pass < std::max(config.repeat, 1U); ++pass) {
+    for (std::size_t channel = 0; channel < nChannels; ++channel) {
+      Clock_t::time_point const start = Clock_t::now();
+      codec->encode(channel, waveforms[channel]);
+      double const time = elapsed(start, Clock_t::now());
+      if ((encodeTimes[channel] < 0.0) || (time < encodeTimes[channel]))
+        encodeTimes[channel] = time;
+    } // for encoding
+    for (std::size_t channel = 0; channel < nChannels; ++channel) {
+      Clock_t::time_point const start = Clock_t::now();
+      codec->decode(channel, decoded);
+      double const time = elapsed(start, Clock_t::now());
+      if ((decodeTimes[channel] < 0.0) || (time < decodeTimes[channel]))
+        decodeTimes[channel] = time;
+    } // for decoding
+  } // for passes
+
+  // size and fidelity
+  double sumError2 = 0.0;
+  for (std::size_t channel = 0; channel < nChannels; ++channel) {
+    std::vector<short> const& adc = waveforms[channel];
+    result.rawBytes += adc.size() * sizeof(short);
+    result.encodedBytes += codec->encodedSize(channel);
+    codec->decode(channel, decoded);
+    if (decoded.size() != adc.size()) {
+      result.failed = true;
+      continue;
+    }
+    for (std::size_t tick = 0; tick < adc.size(); ++tick) {
+      long const error = std::abs(long(decoded[tick]) - long(adc[tick]));
+      result.maxAbsError = std::max(result.maxAbsError, error);
+      sumError2 += double(error) * double(error);
+    }
+  } // for channels
+  if (result.rawBytes > 0U)
+    result.rmsError = std::sqrt(sumError2 / double(result.rawBytes / 2U));
+  if (result.lossless && (result.maxAbsError != 0)) result.failed = true;
+
+  for (double time: encodeTimes) result.encodeSeconds += time / 1e9;
+  for (double time: decodeTimes) result.decodeSeconds += time / 1e9;
+  result.encodeLatency = latencyStats(encodeTimes);
+  result.decodeLatency = latencyStats(decodeTimes);
+
+  return result;
+} // runBenchmark()
+
+
+//------------------------------------------------------------------------------
+/// Writes the latency statistics as a JSON object.
+void writeLatency(std::ostream& out, LatencyStats_t const& stats) {
+  out << "{ \"mean\": " << stats.mean << ", \"median\": " << stats.median
+    << ", \"p99\": " << stats.p99 << ", \"max\": " << stats.max << " }";
+} // writeLatency()
+
+
+/// Writes the configuration and the results in JSON format.
+void writeJSON(
+  std::ostream& out, BenchmarkConfig_t const& config,
+  std::vector<ModeResult_t> const& results
+) {
+  auto const throughput = [](std::size_t bytes, double seconds)
+    { return (seconds > 0.0)? double(bytes) / seconds / 1e6: 0.0; };
+
+  out << std::setprecision(6);
+  out << "{\n  \"config\": {"
+    << "\n    \"channels\": " << config.nChannels
+    << ",\n    \"ticks\": " << config.nTicks
+    << ",\n    \"pedestal\": " << config.pedestal
+    << ",\n    \"noise\": " << config.noise
+    << ",\n    \"occupancy\": " << config.occupancy
+    << ",\n    \"threshold\": " << config.threshold
+    << ",\n    \"repeat\": " << config.repeat
+    << ",\n    \"seed\": " << config.seed
+    << "\n  },\n  \"results\": [";
+  bool first = true;
+  for (ModeResult_t const& result: results) {
+    if (!first) out << ",";
+    first = false;
+    out << "\n    {"
+      << "\n      \"mode\": \"" << modeName(result.mode) << "\""
+      << ",\n      \"id\": " << static_cast<int>(result.mode)
+      << ",\n      \"lossless\": " << (result.lossless? "true": "false")
+      << ",\n      \"rawBytes\": " << result.rawBytes
+      << ",\n      \"encodedBytes\": " << result.encodedBytes
+      << ",\n      \"ratio\": " << ((result.encodedBytes > 0U)
+        ? double(result.rawBytes) / double(result.encodedBytes): 0.0)
+      << ",\n      \"encodeMBps\": "
+        << throughput(result.rawBytes, result.encodeSeconds)
+      << ",\n      \"decodeMBps\": "
+        << throughput(result.rawBytes, result.decodeSeconds)
+      << ",\n      \"encodeLatencyUs\": ";
+    writeLatency(out, result.encodeLatency);
+    out << ",\n      \"decodeLatencyUs\": ";
+    writeLatency(out, result.decodeLatency);
+    out << ",\n      \"maxAbsError\": " << result.maxAbsError
+      << ",\n      \"rmsError\": " << result.rmsError
+      << ",\n      \"failed\": " << (result.failed? "true": "false")
+      << "\n    }";
+  } // for
+  out << "\n  ]\n}\n";
+} // writeJSON()
+
+
+//------------------------------------------------------------------------------
+/// Converts the value of an option, throwing on malformed input.
+template <typename T>
+T parseValue(std::string const& name, std::string const& value) {
+  std::istringstream sstr { value };
+  T result;
+  if (!(sstr >> result) || !sstr.eof()) {
+    throw std::runtime_error
+      ("Invalid value '" + value + "' for option '--" + name + "'");
+  }
+  return result;
+} // parseValue()
+
+
+/// Parses a comma-separated list of compression mode names.
+std::vector<raw::Compress_t> parseModes(std::string const& list) {
+  std::vector<raw::Compress_t> const known = allModes();
+  std::vector<raw::Compress_t> modes;
+  std::istringstream sstr { list };
+  std::string name;
+  while (std::getline(sstr, name, ',')) {
+    auto const iMode = std::find_if(known.begin(), known.end(),
+      [&name](raw::Compress_t mode){ return modeName(mode) == name; });
+    if (iMode == known.end())
+      throw std::runtime_error("Unknown compression mode '" + name + "'");
+    modes.push_back(*iMode);
+  }
+  return modes;
+} // parseModes()
+
+
+/// Parses the command line; returns `false` if only help was requested.
+bool parseCommandLine(int argc, char** argv, BenchmarkConfig_t& config) {
+
+  for (int iArg = 1; iArg < argc; ++iArg) {
+    std::string arg = argv[iArg];
+    if ((arg == "-h") || (arg == "--help")) {
+      std::cout << "Usage:  " << argv[0]
+        << " [--channels=N] [--ticks=N] [--pedestal=ADC] [--noise=RMS]"
+        << "\n    [--occupancy=F] [--threshold=ADC] [--repeat=N] [--seed=N]"
+        << "\n    [--modes=kNone,kHuffman,...] [--output=file.json]"
+        << std::endl;
+      return false;
+    }
+    if (arg.compare(0U, 2U, "--") != 0)
+      throw std::runtime_error("Unexpected argument '" + arg + "'");
+
+    // both "--name=value" and "--name value" are accepted
+    std::string name, value;
+    std::size_t const equal = arg.find('=');
+    if (equal != std::string::npos) {
+      name = arg.substr(2U, equal - 2U);
+      value = arg.substr(equal + 1U);
+    }
+    else {
+      name = arg.substr(2U);
+      if (++iArg >= argc)
+        throw std::runtime_error("Option '" + arg + "' requires a value");
+      value = argv[iArg];
+    }
+
+    if (name == "channels")
+      config.nChannels = parseValue<std::size_t>(name, value);
+    else if (name == "ticks")
+      config.nTicks = parseValue<std::size_t>(name, value);
+    else if (name == "pedestal")
+      config.pedestal = parseValue<short>(name, value);
+    else if (name == "noise")
+      config.noise = parseValue<double>(name, value);
+    else if (name == "occupancy")
+      config.occupancy = parseValue<double>(name, value);
+    else if (name == "threshold")
+      config.threshold = parseValue<short>(name, value);
+    else if (name == "repeat")
+      config.repeat = parseValue<unsigned int>(name, value);
+    else if (name == "seed")
+      config.seed = parseValue<unsigned int>(name, value);
+    else if (name == "modes")
+      config.modes = parseModes(value);
+    else if (name == "output")
+      config.output = value;
+    else throw std::runtime_error("Unknown option '--" + name + "'");
+  } // for
+
+  if (config.nTicks == 0U)
+    throw std::runtime_error("Waveforms must have at least one tick");
+  if ((config.noise < 0.0) || (config.occupancy < 0.0)
+    || (config.occupancy > 1.0))
+  {
+    throw std::runtime_error
+      ("Noise must be non-negative and occupancy within [ 0, 1 ]");
+  }
+  if (config.threshold <= 0) {
+    config.threshold = static_cast<short>
+      (std::max(1.0, std::ceil(4.0 * config.noise)));
+  }
+  if (config.modes.empty()) config.modes = allModes();
+  return true;
+} // parseCommandLine()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  BenchmarkConfig_t config;
+  try {
+    if (!parseCommandLine(argc, argv, config)) return EXIT_SUCCESS;
+  }
+  catch (std::exception const& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::vector<short>> const waveforms = generateWaveforms(config);
+
+  int nErrors = 0;
+  std::vector<ModeResult_t> results;
+  for (raw::Compress_t mode: config.modes) {
+    try {
+      results.push_back(runBenchmark(mode, config, waveforms));
+    }
+    catch (std::exception const& e) {
+      std::cerr << "Mode " << modeName(mode) << " failed: " << e.what()
+        << std::endl;
+      ++nErrors;
+      continue;
+    }
+    if (results.back().failed) {
+      std::cerr << "Mode " << modeName(mode)
+        << " did not reproduce the original waveforms!" << std::endl;
+      ++nErrors;
+    }
+  } // for
+
+  if (config.output.empty()) writeJSON(std::cout, config, results);
+  else {
+    std::ofstream out { config.output };
+    writeJSON(out, config, results);
+    if (!out) {
+      std::cerr << "Failed to write '" << config.output << "'" << std::endl;
+      ++nErrors;
+    }
+  }
+
+  return (nErrors == 0)? EXIT_SUCCESS: EXIT_FAILURE;
+
+} // main()
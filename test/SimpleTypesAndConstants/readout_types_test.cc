@@ -28,6 +28,13 @@
 // LArSoft libraries
 #include "larcoreobj/SimpleTypesAndConstants/readout_types.h"
 
+// C/C++ standard libraries
+#include <unordered_set>
+#include <sstream>
+#include <iomanip> // std::setw()
+#include <string>
+#include <optional>
+
 
 //------------------------------------------------------------------------------
 template <typename ID>
@@ -437,6 +444,67 @@ void test_ROPID_directConstructor() {
 
 
 
+void test_IDhash() {
+
+  BOOST_TEST_CHECKPOINT("Testing hash of readout IDs");
+
+  std::unordered_set<std::size_t> setHashes, ropHashes;
+  std::size_t nSets = 0U, nROPs = 0U;
+  for (unsigned int c = 0; c < 4; ++c) {
+    for (unsigned short s = 0; s < 150; ++s) {
+      readout::TPCsetID const sid { c, s };
+      setHashes.insert(std::hash<readout::TPCsetID>{}(sid));
+      ++nSets;
+      for (unsigned int r = 0; r < 4; ++r) {
+        ropHashes.insert(std::hash<readout::ROPID>{}(readout::ROPID{ sid, r }));
+        ++nROPs;
+      } // for ROPs
+    } // for TPC sets
+  } // for cryostats
+  BOOST_CHECK_EQUAL(setHashes.size(), nSets);
+  BOOST_CHECK_EQUAL(ropHashes.size(), nROPs);
+
+} // test_IDhash()
+
+
+void test_IDstring() {
+
+  BOOST_TEST_CHECKPOINT("Testing string representation of readout IDs");
+
+  readout::TPCsetID const sid { 1, 15 };
+  BOOST_CHECK_EQUAL(sid.toString(), "C:1 S:15");
+
+  readout::ROPID const rid { 1, 15, 32 };
+  BOOST_CHECK_EQUAL(rid.toString(), "C:1 S:15 R:32");
+  BOOST_CHECK_EQUAL(readout::IDstring<readout::ROPID>{ rid }.view(), "C:1 S:15 R:32");
+
+  std::ostringstream sstr;
+  sstr << readout::ROPID{};
+  BOOST_CHECK_EQUAL(sstr.str(), "C:4294967295 S:65535 R:4294967295");
+
+  // stream formatting applies to each index, and the width to the first label
+  std::ostringstream hexstr;
+  hexstr << std::hex << rid << std::dec << " " << std::setw(4) << sid;
+  BOOST_CHECK_EQUAL(hexstr.str(), "C:1 S:f R:20   C:1 S:15");
+
+  // parsing back
+  std::optional<readout::ROPID> const parsed
+    = readout::parseID<readout::ROPID>(rid.toString());
+  BOOST_CHECK(parsed.has_value());
+  if (parsed) {
+    BOOST_CHECK_EQUAL(*parsed, rid);
+    BOOST_CHECK(parsed->isValid);
+  }
+  BOOST_CHECK(readout::parseID<readout::TPCsetID>("C:1 S:15") == sid);
+  BOOST_CHECK(!readout::parseID<readout::ROPID>(sstr.str())->isValid);
+  BOOST_CHECK(!readout::parseID<readout::TPCsetID>("C:1 S:65536"));
+  BOOST_CHECK(!readout::parseID<readout::TPCsetID>("C:1 T:15"));
+
+} // test_IDstring()
+
+
+
+
 //
 // CryostatID test
 //
@@ -465,3 +533,16 @@ BOOST_AUTO_TEST_CASE(ROPIDtest) {
   test_ROPID_integralConstructor();
 }
 
+//
+// hash test
+//
+BOOST_AUTO_TEST_CASE(IDhashTest) {
+  test_IDhash();
+}
+
+//
+// string test
+//
+BOOST_AUTO_TEST_CASE(IDstringTest) {
+  test_IDstring();
+}
@@ -0,0 +1,215 @@
+/**
+ * @file   recombination_benchmark.cc
+ * @brief  Benchmark of the batched recombination functions
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     recombination_benchmark [nDeposits [repeat]]
+ *
+ * The recombination factors of `nDeposits` random energy depositions are
+ * computed in double and single precision with the Birks and the modified box
+ * models, both with a loop calling the scalar function through a function
+ * pointer (as a non-inlined per-deposit call in user code would) and with the
+ * batched function on arrays.
+ *
+ * The modified box factors are then computed with inlined loops with:
+ *  * the exact formula (`util::ModBoxRecombination()`, one `log()` per
+ *    deposit), the reference;
+ *  * the batched function (`util::details::approxLog()`);
+ *  * the run-time table `util::ModBoxRecombinationTable`;
+ *  * the compile-time table `util::FixedModBoxRecombinationTable`;
+ * the tables both with their scalar and batched `operator()`, and their
+ * speedup over the exact formula is printed.
+ *
+ * The time per deposition (best of `repeat` passes) is printed.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SimpleTypesAndConstants/Recombination.h"
+#include "larcoreobj/SimpleTypesAndConstants/RecombinationTable.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <vector>
+#include <string>
+#include <random>
+#include <numeric> // std::accumulate()
+#include <type_traits> // std::is_same_v
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS
+
+
+//------------------------------------------------------------------------------
+/// Prints the per-deposit and the batched time of a model.
+void printResult(
+  std::string const& name, double loopTime, double batchTime, std::size_t n
+) {
+  if (n == 0U) return;
+  std::cout << "  " << std::left << std::setw(18) << name << std::right
+    << std::fixed << std::setprecision(2)
+    << std::setw(10) << (loopTime / n)
+    << std::setw(10) << (batchTime / n)
+    << std::setw(10) << (loopTime / batchTime) << std::endl;
+} // printResult()
+
+
+/// Scalar recombination function.
+template <typename T>
+using RecombFunc_t = T(*)(T, T, T);
+
+
+/// Times a model with a per-deposit loop and with its batched version.
+template <typename T>
+double runBenchmark(
+  std::string const& name, RecombFunc_t<T> scalar,
+  void (*batched)(std::size_t, T const*, T const*, T, T*),
+  std::vector<T> const& dEdx, std::vector<T> const& EField,
+  unsigned int repeat
+) {
+  std::size_t const n = dEdx.size();
+  T const density = T(1.39);
+  std::vector<T> recomb(n);
+  double check = 0.0;
+  RecombFunc_t<T> volatile const function = scalar; // keeps the call opaque
+
+  double const loopTime = bestTime(repeat, [&](){
+      RecombFunc_t<T> const f = function;
+      for (std::size_t i = 0; i < n; ++i)
+        recomb[i] = f(dEdx[i], EField[i], density);
+    });
+  check += std::accumulate(recomb.begin(), recomb.end(), T(0));
+
+  double const batchTime = bestTime(repeat, [&](){
+      batched(n, dEdx.data(), EField.data(), density, recomb.data());
+    });
+  check += std::accumulate(recomb.begin(), recomb.end(), T(0));
+
+  printResult(name, loopTime, batchTime, n);
+  return check;
+} // runBenchmark()
+
+
+/// Times `scalar` in an inlined loop and `batched` on arrays, and prints
+/// their time and speedup with respect to `referenceTime` (0 if none).
+template <typename T, typename Scalar, typename Batched>
+double runModBoxMode(
+  std::string const& name, Scalar scalar, Batched batched,
+  std::vector<T> const& dEdx, std::vector<T> const& EField,
+  unsigned int repeat, double& referenceTime
+) {
+  std::size_t const n = dEdx.size();
+  if (n == 0U) return 0.0;
+  T const density = T(1.39);
+  std::vector<T> recomb(n);
+  double check = 0.0;
+
+  double const loopTime = bestTime(repeat, [&](){
+      for (std::size_t i = 0; i < n; ++i)
+        recomb[i] = scalar(dEdx[i], EField[i], density);
+    });
+  check += std::accumulate(recomb.begin(), recomb.end(), T(0));
+
+  double const batchTime = bestTime(repeat, [&](){
+      batched(n, dEdx.data(), EField.data(), density, recomb.data());
+    });
+  check += std::accumulate(recomb.begin(), recomb.end(), T(0));
+
+  if (referenceTime <= 0.0) referenceTime = loopTime;
+  std::cout << "  " << std::left << std::setw(22) << name << std::right
+    << std::fixed << std::setprecision(2)
+    << std::setw(9) << (loopTime / n)
+    << std::setw(9) << (batchTime / n)
+    << std::setw(9) << (referenceTime / loopTime)
+    << std::setw(9) << (referenceTime / batchTime) << std::endl;
+  return check;
+} // runModBoxMode()
+
+
+/// Times the ways to compute the modified box factors in precision `T`.
+template <typename T>
+double runModBoxModes(
+  std::string const& type,
+  std::vector<T> const& dEdx, std::vector<T> const& EField,
+  unsigned int repeat
+) {
+  // tabulated range covering the generated depositions
+  double const density = 1.39;
+  double const xiMin = util::ModBoxXi(1.0, 0.6, density);
+  double const xiMax = util::ModBoxXi(20.0, 0.4, density);
+  util::ModBoxRecombinationTable<T> const table {
+    xiMin, xiMax, std::is_same_v<T, float>? 1e-6: 1e-8
+    };
+  static constexpr util::FixedModBoxRecombinationTable<4096U, T> fixedTable
+    { 0.2, 20.0 };
+
+  std::cout << "ModBox, " << type << " (table: " << table.size()
+    << " samples, error " << std::scientific << std::setprecision(1)
+    << table.maxRelError() << "; fixed table: " << fixedTable.size()
+    << " samples, error " << fixedTable.maxRelError() << ")\n"
+    << "  time [ns/deposit]        scalar  batched  speedup (scalar, batched)"
+    << std::endl;
+
+  double check = 0.0;
+  double exactTime = 0.0;
+  check += runModBoxMode<T>("exact, approxLog()",
+    [](T dEdx, T EField, T density)
+      { return util::ModBoxRecombination(dEdx, EField, density); },
+    [](std::size_t n, T const* dEdx, T const* EField, T density, T* recomb)
+      { util::ModBoxRecombination(n, dEdx, EField, density, recomb); },
+    dEdx, EField, repeat, exactTime);
+  check += runModBoxMode<T>("run-time table", table, table,
+    dEdx, EField, repeat, exactTime);
+  check += runModBoxMode<T>("compile-time table", fixedTable, fixedTable,
+    dEdx, EField, repeat, exactTime);
+  return check;
+} // runModBoxModes()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const n
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  unsigned int const repeat
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 5U;
+
+  std::mt19937 engine { 12345U };
+  std::uniform_real_distribution<double> dEdxDist { 1.0, 20.0 }; // MeV/cm
+  std::uniform_real_distribution<double> fieldDist { 0.4, 0.6 }; // kV/cm
+  std::vector<double> dEdx(n), EField(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    dEdx[i] = dEdxDist(engine);
+    EField[i] = fieldDist(engine);
+  }
+  std::vector<float> const dEdxF(dEdx.begin(), dEdx.end());
+  std::vector<float> const EFieldF(EField.begin(), EField.end());
+
+  std::cout << n << " depositions\n"
+    << "  time [ns/deposit]    per-call   batched     ratio" << std::endl;
+
+  double check = 0.0; // prevents the computations from being optimised away
+
+  check += runBenchmark<double>("Birks (double)",
+    &util::BirksRecombination<double>, &util::BirksRecombination<double>,
+    dEdx, EField, repeat);
+  check += runBenchmark<float>("Birks (float)",
+    &util::BirksRecombination<float>, &util::BirksRecombination<float>,
+    dEdxF, EFieldF, repeat);
+  check += runBenchmark<double>("ModBox (double)",
+    &util::ModBoxRecombination<double>, &util::ModBoxRecombination<double>,
+    dEdx, EField, repeat);
+  check += runBenchmark<float>("ModBox (float)",
+    &util::ModBoxRecombination<float>, &util::ModBoxRecombination<float>,
+    dEdxF, EFieldF, repeat);
+
+  check += runModBoxModes<double>("double", dEdx, EField, repeat);
+  check += runModBoxModes<float>("float", dEdxF, EFieldF, repeat);
+
+  std::cout << "(checksum: " << std::setprecision(0) << check << ")"
+    << std::endl;
+
+  return EXIT_SUCCESS;
+
+} // main()
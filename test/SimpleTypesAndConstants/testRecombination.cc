@@ -0,0 +1,114 @@
+//
+// A simple test of Recombination.h
+//
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include "larcoreobj/SimpleTypesAndConstants/Recombination.h"
+
+namespace {
+
+  // reference values, computed by hand from the published formulae
+  constexpr double density = 1.39;  // g/cm^3
+  constexpr double EField = 0.5;    // kV/cm
+  constexpr double dEdx = 2.1;      // MeV/cm
+
+  int check(char const* what, double value, double expected, double tol) {
+    if (std::abs(value - expected) <= tol * std::abs(expected)) return 0;
+    std::cout << what << ": got " << value << ", expected " << expected
+      << std::endl;
+    return 1;
+  }
+
+  template <typename T>
+  int testBatched(double tol) {
+    int nbad = 0;
+    std::vector<T> const dEdxs { T(1.5), T(2.1), T(10.0), T(50.0) };
+    std::vector<T> const fields { T(0.5), T(0.5), T(0.273), T(1.0) };
+    std::size_t const n = dEdxs.size();
+    std::vector<T> birks(n), modbox(n), electrons(n);
+    std::vector<T> const energies(n, T(1e-3));
+
+    util::BirksRecombination
+      (n, dEdxs.data(), fields.data(), T(density), birks.data());
+    util::ModBoxRecombination
+      (n, dEdxs.data(), fields.data(), T(density), modbox.data());
+    util::IonizationElectrons
+      (n, energies.data(), modbox.data(), electrons.data());
+
+    for (std::size_t i = 0; i < n; ++i) {
+      double const xi
+        = util::kModBoxB * dEdxs[i] / (double(fields[i]) * density);
+      nbad += check("batched Birks", birks[i],
+        util::kRecombA / (1.0 + dEdxs[i] * util::kRecombk / (fields[i] * density)),
+        tol);
+      nbad += check("batched ModBox", modbox[i],
+        std::log(util::kModBoxA + xi) / xi, tol);
+      nbad += check("batched electrons", electrons[i],
+        1e-3 * util::kGeVToElectrons * modbox[i], tol);
+      // batched and single results must be identical, but for the
+      // approximate logarithm of the batched modified box model
+      if (birks[i] != util::BirksRecombination(dEdxs[i], fields[i], T(density)))
+        ++nbad;
+      nbad += check("batched vs. single ModBox", modbox[i],
+        util::ModBoxRecombination(dEdxs[i], fields[i], T(density)),
+        8 * std::numeric_limits<T>::epsilon());
+    }
+    return nbad;
+  }
+
+  // util::details::approxLog() must be within 3 ulp over many decades
+  template <typename T>
+  int testApproxLog() {
+    int nbad = 0;
+    for (long double x = 1e-30L; x < 1e30L; x *= 1.0001L) {
+      T const value = static_cast<T>(x);
+      long double const exact = std::log(static_cast<long double>(value));
+      if (exact == 0.0L) continue;
+      T const ulp = std::nextafter(std::abs(static_cast<T>(exact)),
+        std::numeric_limits<T>::max()) - std::abs(static_cast<T>(exact));
+      long double const error
+        = std::abs(util::details::approxLog(value) - exact);
+      if (error <= 3.0L * ulp) continue;
+      std::cout << "approxLog(" << value << "): error " << (error / ulp)
+        << " ulp" << std::endl;
+      if (++nbad >= 10) break;
+    }
+    if (util::details::approxLog(T(1)) != T(0)) ++nbad;
+    return nbad;
+  }
+
+} // local namespace
+
+
+int main() {
+
+  int nbad = 0;
+
+  // Birks: R = A / (1 + k dE/dx / (E rho))
+  double const birksExp = 0.8 / (1.0 + 0.0486 * 2.1 / (0.5 * 1.39));
+  nbad += check("Birks", util::BirksRecombination(dEdx, EField, density),
+    birksExp, 1e-12);
+
+  // modified box: R = ln(alpha + xi) / xi, xi = beta dE/dx / (E rho)
+  double const xi = 0.212 * 2.1 / (0.5 * 1.39);
+  double const modBoxExp = std::log(0.930 + xi) / xi;
+  nbad += check("ModBox", util::ModBoxRecombination(dEdx, EField, density),
+    modBoxExp, 1e-12);
+  // at a MIP and 500 V/cm the modified box gives about 70% survival
+  nbad += check("ModBox at MIP", modBoxExp, 0.70, 0.01);
+
+  static_assert(util::BirksRecombination(2.1, 0.5, 1.39) > 0.0);
+  nbad += check("electrons",
+    util::IonizationElectrons(1e-3, modBoxExp), 4.237e4 * modBoxExp, 1e-12);
+
+  nbad += testBatched<double>(1e-12);
+  nbad += testBatched<float>(1e-5);
+  nbad += testApproxLog<double>();
+  nbad += testApproxLog<float>();
+
+  return nbad;
+
+}
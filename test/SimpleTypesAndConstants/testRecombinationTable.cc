@@ -0,0 +1,94 @@
+//
+// A simple test of RecombinationTable.h
+//
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include <cmath>
+#include "larcoreobj/SimpleTypesAndConstants/RecombinationTable.h"
+
+namespace {
+
+  int check(char const* what, double value, double expected, double tol) {
+    if (std::abs(value - expected) <= tol * std::abs(expected)) return 0;
+    std::cout << what << ": got " << value << ", expected " << expected
+      << std::endl;
+    return 1;
+  }
+
+  // compile-time table
+  constexpr util::FixedModBoxRecombinationTable<512> fixedTable { 0.2, 20.0 };
+  static_assert(fixedTable.maxRelError() < 1e-4);
+  static_assert(fixedTable.size() <= 512U);
+
+} // local namespace
+
+
+int main() {
+
+  int nbad = 0;
+
+  // constant expression logarithm
+  for (double x: { 1e-6, 0.1, 0.5, 0.93, 1.0, 1.5, 2.0, 10.0, 1e6 })
+    nbad += check("constexprLog", util::details::constexprLog(x) + 1.0,
+      std::log(x) + 1.0, 1e-14);
+
+  double const density = 1.39;
+  double const tol = 1e-6;
+  double const xiMin = util::ModBoxXi(0.5, 1.0, density);
+  double const xiMax = util::ModBoxXi(200.0, 0.1, density);
+  util::ModBoxRecombinationTable<double> const table { xiMin, xiMax, tol };
+  if (table.maxRelError() > tol) ++nbad;
+
+  // compare with the exact formula, including outside the table range
+  std::vector<double> dEdxs, fields, exact;
+  for (double dEdx = 0.2; dEdx < 500.0; dEdx *= 1.07) {
+    for (double EField: { 0.05, 0.273, 0.5, 1.0 }) {
+      double const R = table(dEdx, EField, density);
+      double const expected
+        = util::ModBoxRecombination(dEdx, EField, density);
+      nbad += check("table", R, expected, tol);
+      dEdxs.push_back(dEdx);
+      fields.push_back(EField);
+      exact.push_back(expected);
+    }
+  }
+
+  // batched lookup
+  std::vector<double> recomb(dEdxs.size());
+  table(dEdxs.size(), dEdxs.data(), fields.data(), density, recomb.data());
+  for (std::size_t i = 0; i < recomb.size(); ++i)
+    nbad += check("batched table", recomb[i], exact[i], tol);
+
+  // single precision table
+  util::ModBoxRecombinationTable<float> const tableF { xiMin, xiMax, 1e-4 };
+  nbad += check("float table", tableF(2.1f, 0.5f, float(density)),
+    util::ModBoxRecombination(2.1, 0.5, density), 1e-4);
+
+  // compile-time table
+  for (double xi = 0.21; xi < 19.0; xi *= 1.1) {
+    nbad += check("fixed table", fixedTable.atXi(xi),
+      std::log(util::kModBoxA + xi) / xi, 1e-4);
+  }
+  fixedTable(dEdxs.size(), dEdxs.data(), fields.data(), density, recomb.data());
+  for (std::size_t i = 0; i < recomb.size(); ++i) {
+    nbad += check("batched fixed table", recomb[i],
+      fixedTable(dEdxs[i], fields[i], density), 1e-15);
+  }
+
+  // invalid configurations
+  try {
+    util::ModBoxRecombinationTable<double>{ 1.0, 0.5, tol };
+    ++nbad;
+  }
+  catch (std::domain_error const&) {}
+  try {
+    util::ModBoxRecombinationTable<double>{ 1.0, 2.0, 1e-20 };
+    ++nbad;
+  }
+  catch (std::domain_error const&) {}
+
+  return nbad;
+
+}
@@ -0,0 +1,119 @@
+/**
+ * @file   ConcurrentPOTAccumulator_benchmark.cc
+ * @brief  Benchmark of sumdata::ConcurrentPOTAccumulator against a mutex
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     ConcurrentPOTAccumulator_benchmark [nAdds [maxThreads [repeat]]]
+ *
+ * `nAdds` summaries are added, split evenly among 1, 2, 4... up to
+ * `maxThreads` threads, into:
+ *  * a `sumdata::POTSummary` with `aggregate()` guarded by a `std::mutex`;
+ *  * a `sumdata::ConcurrentPOTAccumulator`.
+ *
+ * The time per addition (best of `repeat` passes, including the start and
+ * join of the threads) is printed for each number of threads. The program
+ * fails if the two totals differ.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/ConcurrentPOTAccumulator.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm> // std::max()
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS, EXIT_FAILURE
+
+
+//------------------------------------------------------------------------------
+/// Runs `add(i)` for each `i` of `nAdds`, split among `nThreads` threads.
+template <typename Add>
+void runThreads(std::size_t nAdds, unsigned int nThreads, Add add) {
+  std::vector<std::thread> threads;
+  threads.reserve(nThreads);
+  for (unsigned int t = 0; t < nThreads; ++t) {
+    threads.emplace_back([nAdds, nThreads, t, &add](){
+        for (std::size_t i = t; i < nAdds; i += nThreads) add(i);
+      });
+  }
+  for (std::thread& thread: threads) thread.join();
+} // runThreads()
+
+
+/// Returns a small summary of the spill number `i`.
+sumdata::POTSummary makeSummary(std::size_t i) {
+  sumdata::POTSummary summary;
+  summary.totpot = 1e12 + (i % 7U) * 1e10;
+  summary.totgoodpot = summary.totpot / 2.0;
+  summary.totspills = 1;
+  summary.goodspills = (i % 3U)? 1: 0;
+  return summary;
+} // makeSummary()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const nAdds
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  unsigned int const maxThreads
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 64U;
+  unsigned int const repeat
+    = (argc > 3)? std::strtoul(argv[3], nullptr, 10): 3U;
+
+  std::cout << "Adding " << nAdds << " summaries ("
+    << std::thread::hardware_concurrency() << " hardware threads):\n"
+    << "  threads   mutex[ns]   accumulator[ns]     ratio" << std::endl;
+
+  for (unsigned int nThreads = 1U; nThreads <= std::max(maxThreads, 1U);
+    nThreads *= 2U
+  ) {
+
+    sumdata::POTSummary locked;
+    std::mutex lock;
+    double const mutexTime = bestTime(repeat, [&](){
+        locked = sumdata::POTSummary{};
+        runThreads(nAdds, nThreads, [&locked, &lock](std::size_t i){
+            sumdata::POTSummary const summary = makeSummary(i);
+            std::lock_guard<std::mutex> guard { lock };
+            locked.aggregate(summary);
+          });
+      });
+
+    sumdata::ConcurrentPOTAccumulator accumulator;
+    double const accumulatorTime = bestTime(repeat, [&](){
+        accumulator.reset();
+        runThreads(nAdds, nThreads, [&accumulator](std::size_t i){
+            accumulator.add(makeSummary(i));
+          });
+      });
+
+    std::cout << "  " << std::setw(7) << nThreads
+      << std::fixed << std::setprecision(1)
+      << std::setw(12) << (mutexTime / nAdds)
+      << std::setw(18) << (accumulatorTime / nAdds)
+      << std::setw(10) << std::setprecision(2)
+      << (mutexTime / accumulatorTime) << std::endl;
+
+    sumdata::POTSummary const total = accumulator.snapshot();
+    if ((total.totspills != locked.totspills)
+      || (total.goodspills != locked.goodspills)
+    ) {
+      std::cerr << "Accumulator total (" << total.totspills << " spills, "
+        << total.goodspills << " good) differs from the locked one ("
+        << locked.totspills << " spills, " << locked.goodspills << " good)"
+        << std::endl;
+      return EXIT_FAILURE;
+    }
+  } // for threads
+
+  return EXIT_SUCCESS;
+
+} // main()
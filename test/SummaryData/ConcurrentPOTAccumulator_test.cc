@@ -0,0 +1,85 @@
+/**
+ * @file   ConcurrentPOTAccumulator_test.cc
+ * @brief  Test of sumdata::ConcurrentPOTAccumulator
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ConcurrentPOTAccumulator_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/ConcurrentPOTAccumulator.h"
+
+// C/C++ standard libraries
+#include <thread>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+sumdata::POTSummary makeSummary(double pot, int spills) {
+  sumdata::POTSummary summary;
+  summary.totpot = pot;
+  summary.totgoodpot = pot / 2.0;
+  summary.totspills = spills;
+  summary.goodspills = spills - 1;
+  return summary;
+} // makeSummary()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(SingleThreadTest) {
+
+  sumdata::ConcurrentPOTAccumulator accumulator { 4U };
+  BOOST_CHECK_EQUAL(accumulator.nShards(), 4U);
+
+  sumdata::POTSummary empty = accumulator.snapshot();
+  BOOST_CHECK_EQUAL(empty.totpot, 0.0);
+  BOOST_CHECK_EQUAL(empty.totspills, 0);
+
+  sumdata::POTSummary expected;
+  for (int i = 1; i <= 10; ++i) {
+    sumdata::POTSummary const summary = makeSummary(i * 1e12, i);
+    accumulator.add(summary);
+    expected.aggregate(summary);
+  }
+
+  sumdata::POTSummary const total = accumulator.snapshot();
+  BOOST_CHECK_EQUAL(total.totpot, expected.totpot);
+  BOOST_CHECK_EQUAL(total.totgoodpot, expected.totgoodpot);
+  BOOST_CHECK_EQUAL(total.totspills, expected.totspills);
+  BOOST_CHECK_EQUAL(total.goodspills, expected.goodspills);
+
+  accumulator.reset();
+  BOOST_CHECK_EQUAL(accumulator.snapshot().totpot, 0.0);
+  BOOST_CHECK_EQUAL(accumulator.snapshot().goodspills, 0);
+
+} // BOOST_AUTO_TEST_CASE(SingleThreadTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(MultiThreadTest) {
+
+  constexpr unsigned int NThreads = 8U;
+  constexpr int NAdds = 20000;
+
+  // fewer shards than threads, so that some threads share them
+  sumdata::ConcurrentPOTAccumulator accumulator { 3U };
+
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < NThreads; ++t) {
+    threads.emplace_back([&accumulator](){
+        // integral values: the sum is exact regardless of the order
+        for (int i = 0; i < NAdds; ++i) accumulator.add(makeSummary(4.0, 3));
+      });
+  }
+  for (std::thread& thread: threads) thread.join();
+
+  sumdata::POTSummary const total = accumulator.snapshot();
+  BOOST_CHECK_EQUAL(total.totpot, 4.0 * NThreads * NAdds);
+  BOOST_CHECK_EQUAL(total.totgoodpot, 2.0 * NThreads * NAdds);
+  BOOST_CHECK_EQUAL(total.totspills, 3 * int(NThreads) * NAdds);
+  BOOST_CHECK_EQUAL(total.goodspills, 2 * int(NThreads) * NAdds);
+
+} // BOOST_AUTO_TEST_CASE(MultiThreadTest)
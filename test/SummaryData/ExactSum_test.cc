@@ -0,0 +1,165 @@
+/**
+ * @file   ExactSum_test.cc
+ * @brief  Test of sumdata::ExactSum and sumdata::POTSummaryAccumulator
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( ExactSum_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/ExactSum.h"
+#include "larcoreobj/SummaryData/POTSummaryAccumulator.h"
+
+// C/C++ standard libraries
+#include <algorithm> // std::shuffle(), std::reverse()
+#include <random>
+#include <vector>
+#include <limits>
+#include <cmath> // std::ldexp(), std::isinf(), std::isnan()
+#include <stdexcept> // std::overflow_error
+
+
+//------------------------------------------------------------------------------
+double exactSum(std::vector<double> const& values) {
+  sumdata::ExactSum sum;
+  for (double value: values) sum += value;
+  return sum.value();
+} // exactSum()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ExactSumTest) {
+
+  BOOST_CHECK_EQUAL(sumdata::ExactSum{}.value(), 0.0);
+  BOOST_CHECK_EQUAL(sumdata::ExactSum{ 1.5 }.value(), 1.5);
+  BOOST_CHECK_EQUAL(exactSum({ -5.5, 2.25 }), -3.25);
+
+  // cancellation
+  BOOST_CHECK_EQUAL(exactSum({ 1e20, 1.0, -1e20 }), 1.0);
+  BOOST_CHECK_EQUAL(exactSum({ 1e300, -1e-300, -1e300 }), -1e-300);
+
+  // the exact sum of ten 0.1 rounds to 1 (plain summation does not)
+  BOOST_CHECK_EQUAL(exactSum(std::vector<double>(10U, 0.1)), 1.0);
+
+  // rounding to nearest, ties to even
+  double const two53 = std::ldexp(1.0, 53);
+  BOOST_CHECK_EQUAL(exactSum({ two53, 1.0 }), two53);
+  BOOST_CHECK_EQUAL(exactSum({ two53, 1.0, std::ldexp(1.0, -60) }), two53 + 2.0);
+  BOOST_CHECK_EQUAL(exactSum({ two53 + 2.0, 1.0 }), two53 + 4.0);
+
+  // subnormal values
+  double const tiny = std::numeric_limits<double>::denorm_min();
+  BOOST_CHECK_EQUAL(exactSum({ tiny, tiny, tiny }), 3.0 * tiny);
+  BOOST_CHECK_EQUAL(exactSum({ 1.0, tiny, -1.0 }), tiny);
+
+  // overflow and non-finite values
+  double const huge = std::numeric_limits<double>::max();
+  BOOST_CHECK(std::isinf(exactSum({ huge, huge })));
+  BOOST_CHECK_EQUAL(exactSum({ huge, huge, -huge }), huge);
+  double const inf = std::numeric_limits<double>::infinity();
+  BOOST_CHECK_EQUAL(exactSum({ 1.0, inf }), inf);
+  BOOST_CHECK(std::isnan(exactSum({ inf, -inf })));
+
+  sumdata::ExactSum sum { 3.0 };
+  sum.clear();
+  BOOST_CHECK_EQUAL(sum.value(), 0.0);
+
+} // BOOST_AUTO_TEST_CASE(ExactSumTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(OrderIndependenceTest) {
+
+  std::mt19937_64 engine { 12345U };
+  std::uniform_real_distribution<double> mantissa { -1.0, 1.0 };
+  std::uniform_int_distribution<int> exponent { -20, 70 };
+  std::vector<double> values;
+  for (int i = 0; i < 20000; ++i)
+    values.push_back(std::ldexp(mantissa(engine), exponent(engine)));
+
+  double const reference = exactSum(values);
+
+  std::reverse(values.begin(), values.end());
+  BOOST_CHECK_EQUAL(exactSum(values), reference);
+
+  std::shuffle(values.begin(), values.end(), engine);
+  BOOST_CHECK_EQUAL(exactSum(values), reference);
+
+  // merge of partial sums
+  for (std::size_t nParts: { 2U, 7U, 64U }) {
+    std::vector<sumdata::ExactSum> parts(nParts);
+    for (std::size_t i = 0; i < values.size(); ++i)
+      parts[i % nParts] += values[i];
+    sumdata::ExactSum total;
+    for (sumdata::ExactSum const& part: parts) total += part;
+    BOOST_CHECK_EQUAL(total.value(), reference);
+  }
+
+} // BOOST_AUTO_TEST_CASE(OrderIndependenceTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(POTSummaryAccumulatorTest) {
+
+  std::vector<sumdata::POTSummary> summaries;
+  for (int i = 0; i < 1000; ++i) {
+    sumdata::POTSummary summary;
+    summary.totpot = 1e20 / (i + 1);
+    summary.totgoodpot = summary.totpot * 0.9;
+    summary.totspills = i;
+    summary.goodspills = i / 2;
+    summaries.push_back(summary);
+  }
+
+  sumdata::POTSummaryAccumulator forward;
+  for (auto it = summaries.begin(); it != summaries.end(); ++it)
+    forward.add(*it);
+  sumdata::POTSummaryAccumulator odd, even;
+  for (auto it = summaries.rbegin(); it != summaries.rend(); ++it)
+    (((it - summaries.rbegin()) % 2)? odd: even).add(*it);
+  even.aggregate(odd);
+
+  sumdata::POTSummary const a = forward.summary();
+  sumdata::POTSummary const b = even.summary();
+  BOOST_CHECK_EQUAL(a.totpot, b.totpot);
+  BOOST_CHECK_EQUAL(a.totgoodpot, b.totgoodpot);
+  BOOST_CHECK_EQUAL(a.totspills, 999 * 1000 / 2);
+  BOOST_CHECK_EQUAL(b.totspills, a.totspills);
+  BOOST_CHECK_EQUAL(b.goodspills, a.goodspills);
+
+  // same as the plain sum, to within its rounding errors
+  sumdata::POTSummary plain;
+  for (sumdata::POTSummary const& summary: summaries) plain.aggregate(summary);
+  BOOST_CHECK_CLOSE(a.totpot, plain.totpot, 1e-12);
+
+} // BOOST_AUTO_TEST_CASE(POTSummaryAccumulatorTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(POTSummaryAccumulatorOverflowTest) {
+
+  sumdata::POTSummary large;
+  large.totspills = std::numeric_limits<int>::max();
+  large.goodspills = 1;
+
+  // the total fits a `long long`, but not the `int` of the summary
+  sumdata::POTSummaryAccumulator accumulator { large };
+  BOOST_CHECK_EQUAL(accumulator.summary().totspills, large.totspills);
+  sumdata::POTSummary one;
+  one.totspills = 1;
+  accumulator.add(one);
+  BOOST_CHECK_THROW(accumulator.summary(), std::overflow_error);
+
+  // same for the good spills, also on the negative side
+  sumdata::POTSummary negative;
+  negative.goodspills = std::numeric_limits<int>::min();
+  sumdata::POTSummaryAccumulator other { negative };
+  BOOST_CHECK_EQUAL(other.summary().goodspills, negative.goodspills);
+  other.add(negative);
+  BOOST_CHECK_THROW(other.summary(), std::overflow_error);
+
+} // BOOST_AUTO_TEST_CASE(POTSummaryAccumulatorOverflowTest)
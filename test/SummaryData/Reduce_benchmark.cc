@@ -0,0 +1,111 @@
+/**
+ * @file   Reduce_benchmark.cc
+ * @brief  Benchmark of sumdata::reduce() on POT summaries
+ * @date   October 18, 2026
+ *
+ * Usage:
+ *
+ *     Reduce_benchmark [nSummaries [grainSize [repeat]]]
+ *
+ * `nSummaries` `sumdata::POTSummary` objects are merged with:
+ *  * a plain loop calling `aggregate()`;
+ *  * `sumdata::reduce()` with the default (sequential) policy;
+ *  * `sumdata::reduce()` on 2, 4 and 8 threads and on all the cores.
+ *
+ * The time per summary (best of `repeat` passes) is printed, together with
+ * the relative difference of the total exposure from the plain loop.
+ * The program fails if the reductions do not agree with each other.
+ */
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/Reduce.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+#include "test/BenchmarkUtils.h" // bestTime()
+
+// C/C++ standard libraries
+#include <iostream>
+#include <iomanip> // std::setw()
+#include <vector>
+#include <string>
+#include <thread> // std::thread::hardware_concurrency()
+#include <cmath> // std::abs()
+#include <cstdlib> // std::strtoul(), EXIT_SUCCESS, EXIT_FAILURE
+
+
+//------------------------------------------------------------------------------
+/// Prints the time per summary of a method, and its difference from `ref`.
+void printResult(
+  std::string const& name, double time, std::size_t n,
+  sumdata::POTSummary const& total, sumdata::POTSummary const& ref
+) {
+  if (n == 0U) return;
+  double const diff = (ref.totpot == 0.0)
+    ? 0.0: std::abs(total.totpot - ref.totpot) / ref.totpot;
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+    << std::setw(10) << std::fixed << std::setprecision(2) << (time / n)
+    << " ns/summary    rel. difference: "
+    << std::scientific << std::setprecision(1) << diff << std::endl;
+} // printResult()
+
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+
+  std::size_t const n
+    = (argc > 1)? std::strtoul(argv[1], nullptr, 10): 1000000U;
+  std::size_t const grainSize
+    = (argc > 2)? std::strtoul(argv[2], nullptr, 10): 1024U;
+  unsigned int const repeat
+    = (argc > 3)? std::strtoul(argv[3], nullptr, 10): 5U;
+
+  std::vector<sumdata::POTSummary> summaries(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    sumdata::POTSummary& summary = summaries[i];
+    summary.totpot = 1e18 / (i + 1) + 3e16 * (i % 7);
+    summary.totgoodpot = summary.totpot / 3.0;
+    summary.totspills = 1;
+    summary.goodspills = (i % 5U)? 1: 0;
+  }
+
+  std::cout << "Merging " << n << " summaries (grain size: " << grainSize
+    << ", " << std::thread::hardware_concurrency() << " hardware threads):"
+    << std::endl;
+
+  sumdata::POTSummary plain;
+  printResult("plain loop", bestTime(repeat, [&](){
+      plain = sumdata::POTSummary{};
+      for (sumdata::POTSummary const& summary: summaries)
+        plain.aggregate(summary);
+    }), n, plain, plain);
+
+  sumdata::POTSummary reference;
+  sumdata::ReducePolicy policy;
+  policy.grainSize = grainSize;
+  printResult("reduce (default)", bestTime(repeat, [&](){
+      reference
+        = sumdata::reduce(summaries.begin(), summaries.end(), policy).value;
+    }), n, reference, plain);
+
+  for (unsigned int nThreads: { 2U, 4U, 8U, 0U }) {
+    policy.maxThreads = nThreads;
+    sumdata::POTSummary total;
+    double const time = bestTime(repeat, [&](){
+        total
+          = sumdata::reduce(summaries.begin(), summaries.end(), policy).value;
+      });
+    printResult(nThreads
+      ? ("reduce (" + std::to_string(nThreads) + " threads)")
+      : std::string{ "reduce (all cores)" },
+      time, n, total, plain);
+    if ((total.totpot != reference.totpot)
+      || (total.totspills != reference.totspills)
+    ) {
+      std::cerr << "Reduction on " << nThreads
+        << " threads differs from the sequential one." << std::endl;
+      return EXIT_FAILURE;
+    }
+  } // for threads
+
+  return EXIT_SUCCESS;
+
+} // main()
@@ -0,0 +1,122 @@
+/**
+ * @file   Reduce_test.cc
+ * @brief  Test of sumdata::reduce()
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( Reduce_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+#include <boost/test/tools/floating_point_comparison.hpp> // BOOST_CHECK_CLOSE()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/Reduce.h"
+#include "larcoreobj/SummaryData/POTSummary.h"
+#include "larcoreobj/SummaryData/POTSummaryAccumulator.h"
+#include "larcoreobj/SummaryData/RunData.h"
+
+// C/C++ standard libraries
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+std::vector<sumdata::POTSummary> makeSummaries(int n) {
+  std::vector<sumdata::POTSummary> summaries;
+  for (int i = 0; i < n; ++i) {
+    sumdata::POTSummary summary;
+    summary.totpot = 1e18 / (i + 1) + 3e16 * (i % 7);
+    summary.totgoodpot = summary.totpot / 3.0;
+    summary.totspills = i % 11;
+    summary.goodspills = i % 5;
+    summaries.push_back(summary);
+  }
+  return summaries;
+} // makeSummaries()
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(POTSummaryReduceTest) {
+
+  std::vector<sumdata::POTSummary> const summaries = makeSummaries(10000);
+
+  // the tree shape is fixed by the grain size, not by the number of threads
+  sumdata::ReducePolicy policy { 100U, 1U };
+  auto const reference = sumdata::reduce
+    (summaries.begin(), summaries.end(), policy);
+  BOOST_CHECK(reference);
+  for (unsigned int nThreads: { 2U, 3U, 8U }) {
+    policy.maxThreads = nThreads;
+    auto const result = sumdata::reduce
+      (summaries.begin(), summaries.end(), policy);
+    BOOST_CHECK_EQUAL(result.value.totpot, reference.value.totpot);
+    BOOST_CHECK_EQUAL(result.value.totgoodpot, reference.value.totgoodpot);
+    BOOST_CHECK_EQUAL(result.value.totspills, reference.value.totspills);
+    BOOST_CHECK_EQUAL(result.value.goodspills, reference.value.goodspills);
+  }
+
+  sumdata::POTSummary serial;
+  for (sumdata::POTSummary const& summary: summaries) serial.aggregate(summary);
+  BOOST_CHECK_EQUAL(reference.value.totspills, serial.totspills);
+  BOOST_CHECK_CLOSE(reference.value.totpot, serial.totpot, 1e-10);
+
+  // a single chunk is the same as the serial aggregation
+  auto const single = sumdata::reduce(summaries.begin(), summaries.end(),
+    { summaries.size(), 4U });
+  BOOST_CHECK_EQUAL(single.value.totpot, serial.totpot);
+
+  // the default policy is sequential; all the cores are used only on request
+  BOOST_CHECK_EQUAL(sumdata::ReducePolicy{}.maxThreads, 1U);
+  BOOST_CHECK_EQUAL(sumdata::ReducePolicy::parallel().maxThreads, 0U);
+  auto const allCores = sumdata::reduce(summaries.begin(), summaries.end(),
+    { 100U, 0U });
+  BOOST_CHECK_EQUAL(allCores.value.totpot, reference.value.totpot);
+
+  // empty range
+  auto const empty = sumdata::reduce(summaries.begin(), summaries.begin());
+  BOOST_CHECK(empty);
+  BOOST_CHECK_EQUAL(empty.value.totpot, 0.0);
+
+} // BOOST_AUTO_TEST_CASE(POTSummaryReduceTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(ReproducibleReduceTest) {
+
+  std::vector<sumdata::POTSummaryAccumulator> accumulators;
+  for (sumdata::POTSummary const& summary: makeSummaries(5000))
+    accumulators.emplace_back(summary);
+
+  auto const reference = sumdata::reduce(accumulators.begin(),
+    accumulators.end(), sumdata::ReducePolicy::sequential());
+  for (std::size_t grain: { 1U, 7U, 300U }) {
+    auto const result = sumdata::reduce
+      (accumulators.begin(), accumulators.end(), { grain, 4U });
+    BOOST_CHECK_EQUAL
+      (result.value.summary().totpot, reference.value.summary().totpot);
+  }
+
+} // BOOST_AUTO_TEST_CASE(ReproducibleReduceTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RunDataReduceTest) {
+
+  std::vector<sumdata::RunData> runs(50U, sumdata::RunData{ "detector" });
+
+  auto const result = sumdata::reduce(runs.begin(), runs.end(), { 4U, 4U });
+  BOOST_CHECK(result);
+  BOOST_CHECK_EQUAL(result.value.DetName(), "detector");
+
+  runs[17] = sumdata::RunData{ "other" };
+  runs[30] = sumdata::RunData{ "another" };
+  auto const conflict = sumdata::reduce(runs.begin(), runs.end());
+  BOOST_CHECK(!conflict);
+  BOOST_CHECK(conflict.conflict);
+  BOOST_CHECK_EQUAL(conflict.conflict->first, 0U);
+  BOOST_CHECK_EQUAL(conflict.conflict->second, 17U);
+
+  BOOST_CHECK(runs[0].isCompatible(runs[1]));
+  BOOST_CHECK(!runs[0].isCompatible(runs[17]));
+
+} // BOOST_AUTO_TEST_CASE(RunDataReduceTest)
@@ -0,0 +1,61 @@
+/**
+ * @file   RunData_test.cc
+ * @brief  Test of sumdata::RunData
+ * @date   October 18, 2026
+ */
+
+// Boost libraries
+#define BOOST_TEST_MODULE ( RunData_test )
+#include <cetlib/quiet_unit_test.hpp> // BOOST_AUTO_TEST_CASE()
+#include <boost/test/test_tools.hpp> // BOOST_CHECK(), BOOST_CHECK_EQUAL()
+
+// LArSoft libraries
+#include "larcoreobj/SummaryData/RunData.h"
+
+// C/C++ standard libraries
+#include <stdexcept> // std::runtime_error
+#include <string>
+#include <type_traits> // std::is_trivially_copyable_v
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(InternedNameTest) {
+
+  std::string const name { "dune10kt_v1_1x2x6" }; // longer than the SSO buffer
+  std::string const* handle = sumdata::details::internDetectorName(name);
+  BOOST_CHECK_EQUAL(*handle, name);
+  BOOST_CHECK_EQUAL(sumdata::details::internDetectorName(name), handle);
+  BOOST_CHECK_EQUAL
+    (sumdata::details::internDetectorName(std::string{ name }), handle);
+  BOOST_CHECK(sumdata::details::internDetectorName("another") != handle);
+
+} // BOOST_AUTO_TEST_CASE(InternedNameTest)
+
+
+//------------------------------------------------------------------------------
+BOOST_AUTO_TEST_CASE(RunDataTest) {
+
+  static_assert(std::is_trivially_copyable_v<sumdata::RunData>);
+
+  sumdata::RunData const def;
+  BOOST_CHECK_EQUAL(def.DetName(), "nodetectorname");
+  BOOST_CHECK(def.isCompatible(sumdata::RunData{}));
+  BOOST_CHECK(def.isCompatible(sumdata::RunData{ "nodetectorname" }));
+
+  sumdata::RunData a { "detector" };
+  sumdata::RunData const b { std::string{ "detec" } + "tor" };
+  sumdata::RunData const c { "other" };
+  sumdata::RunData const copy = a;
+
+  BOOST_CHECK_EQUAL(copy.DetName(), "detector");
+  BOOST_CHECK_EQUAL(&copy.DetName(), &a.DetName());
+  BOOST_CHECK_EQUAL(&b.DetName(), &a.DetName());
+  BOOST_CHECK(a.isCompatible(b));
+  BOOST_CHECK(a.isCompatible(copy));
+  BOOST_CHECK(!a.isCompatible(c));
+  BOOST_CHECK(!a.isCompatible(def));
+
+  BOOST_CHECK_NO_THROW(a.aggregate(b));
+  BOOST_CHECK_THROW(a.aggregate(c), std::runtime_error);
+
+} // BOOST_AUTO_TEST_CASE(RunDataTest)